@@ -13,6 +13,11 @@
 #define USE_GPU_SKINNING 0
 #endif
 
+// 자동 인스턴싱 변형: 월드 행렬/오브젝트 ID를 t14 인스턴스 버퍼에서 읽는다 (FMeshAutoInstancing 참고)
+#ifndef USE_INSTANCING
+#define USE_INSTANCING 0
+#endif
+
 // --- Material 구조체 (OBJ 머티리얼 정보) ---
 // 주의: SPECULAR_COLOR 매크로에서 사용하므로 include 전에 정의 필요
 struct FMaterial
@@ -53,6 +58,7 @@ cbuffer ColorBuffer : register(b3)
 {
     float4 LerpColor;   // 블렌드할 색상 (알파가 블렌드 양 제어)
     uint UUID;
+    uint InstanceOffset; // 인스턴스 드로우가 읽기 시작할 g_InstanceData 위치
 };
 
 // b4: PixelConstBuffer (VS+PS) - OBJ 파일의 머티리얼 정보
@@ -113,6 +119,18 @@ Texture2D<float2> g_VSMShadowAtlas : register(t10);
 TextureCubeArray<float2> g_VSMShadowCube : register(t11);   // TODO: 지금은 전달 안 되고, 안 쓰는 중
 // (IBL removed)
 
+#if USE_INSTANCING
+// FMeshInstanceData와 정확히 일치해야 함 (144 bytes)
+struct FInstanceData
+{
+    row_major float4x4 World;
+    row_major float4x4 WorldInverseTranspose;
+    uint ObjectID;
+    uint3 InstancePadding;
+};
+StructuredBuffer<FInstanceData> g_InstanceData : register(t14);
+#endif
+
 #if USE_GPU_SKINNING
 StructuredBuffer<float4x4> g_SkinnedMatrices : register(t12);
 StructuredBuffer<float4x4> g_SkinnedNormalMatrices : register(t13);
@@ -174,6 +192,9 @@ struct VS_INPUT
     uint4 BoneIndices : BLENDINDICES0;
     float4 BoneWeights : BLENDWEIGHT0;
 #endif        
+#if USE_INSTANCING
+    uint InstanceID : SV_InstanceID;
+#endif
 };
 
 struct PS_INPUT
@@ -184,6 +205,9 @@ struct PS_INPUT
     row_major float3x3 TBN : TBN;
     float4 Color : COLOR;
     float2 TexCoord : TEXCOORD0;
+#if USE_INSTANCING
+    nointerpolation uint InstanceUUID : INSTANCE_UUID;
+#endif
 };
 
 struct PS_OUTPUT
@@ -245,7 +269,17 @@ PS_INPUT mainVS(VS_INPUT Input)
     float3 ModelTangent = Input.Tangent.xyz;
 #endif
 
-    float4 WorldPos = mul(float4(ModelPosition, 1.0f), WorldMatrix);
+#if USE_INSTANCING
+    FInstanceData Instance = g_InstanceData[InstanceOffset + Input.InstanceID];
+    float4x4 World = Instance.World;
+    float4x4 WorldInvTranspose = Instance.WorldInverseTranspose;
+    Out.InstanceUUID = Instance.ObjectID;
+#else
+    float4x4 World = WorldMatrix;
+    float4x4 WorldInvTranspose = WorldInverseTranspose;
+#endif
+
+    float4 WorldPos = mul(float4(ModelPosition, 1.0f), World);
 
     // Apply wind displacement in world space
     WorldPos.xyz += CalculateWindDisplacement(ModelPosition, WorldPos.xyz);
@@ -255,10 +289,10 @@ PS_INPUT mainVS(VS_INPUT Input)
     float4 ViewPos = mul(WorldPos, ViewMatrix);
     Out.Position = mul(ViewPos, ProjectionMatrix);
 
-    float3 WorldNormal = normalize(mul(ModelNormal, (float3x3)WorldInverseTranspose));
+    float3 WorldNormal = normalize(mul(ModelNormal, (float3x3)WorldInvTranspose));
     Out.Normal = WorldNormal;
 
-    float3 Tangent = normalize(mul(ModelTangent, (float3x3)WorldMatrix));
+    float3 Tangent = normalize(mul(ModelTangent, (float3x3)World));
     float3 BiTangent = normalize(cross(WorldNormal, Tangent) * Input.Tangent.w);
     row_major float3x3 TBN;
     TBN._m00_m01_m02 = Tangent;
@@ -345,7 +379,11 @@ PS_INPUT mainVS(VS_INPUT Input)
 PS_OUTPUT mainPS(PS_INPUT Input)
 {
     PS_OUTPUT Output;
+#if USE_INSTANCING
+    Output.UUID = Input.InstanceUUID;
+#else
     Output.UUID = UUID;
+#endif
     
     //CSM 구간 시각화
     float3 Color[2] =
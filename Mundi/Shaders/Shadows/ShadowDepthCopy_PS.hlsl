@@ -0,0 +1,11 @@
+// 섀도우 아틀라스 깊이 복사 PS (FullScreenTriangle_VS와 함께 사용)
+// 뷰포트로 지정한 영역의 깊이를 같은 픽셀 좌표의 원본에서 읽어 SV_Depth로 그대로 출력합니다.
+// 원본과 대상은 같은 크기/배치의 아틀라스이므로 좌표 변환이 필요 없습니다.
+// C++ 코드에서 AlwaysWrite 깊이 상태로 Draw(6, 0) 호출해야 합니다.
+
+Texture2D<float> SourceDepth : register(t0);
+
+float mainPS(float4 Position : SV_POSITION) : SV_Depth
+{
+    return SourceDepth.Load(int3(Position.xy, 0));
+}
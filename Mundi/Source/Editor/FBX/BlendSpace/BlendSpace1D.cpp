@@ -2,6 +2,7 @@
 #include "BlendSpace1D.h"
 #include "Source/Runtime/Engine/Animation/AnimSequence.h"
 #include "Source/Runtime/Engine/Animation/AnimDateModel.h"
+#include "Source/Runtime/Engine/Animation/AnimPosePool.h"
 
 IMPLEMENT_CLASS(UBlendSpace1D)
 
@@ -146,9 +147,9 @@ void UBlendSpace1D::Update(float Parameter, float DeltaTime, TArray<FTransform>&
 	// Alpha > 0.5: SampleB가 지배적 (가중치 Alpha > 0.5)
 	DominantSequence = (Alpha <= 0.5f) ? SampleA->Animation : SampleB->Animation;
 
-	// Extract pose from each sample
-	TArray<FTransform> PoseA;
-	TArray<FTransform> PoseB;
+	// Extract pose from each sample (임시 포즈는 스레드별 풀에서 빌림)
+	FScopedPoseBuffer PoseA;
+	FScopedPoseBuffer PoseB;
 
 	EvaluateAnimation(SampleA->Animation, CurrentPlayTime, PoseA);
 	EvaluateAnimation(SampleB->Animation, CurrentPlayTime, PoseB);
@@ -255,19 +256,12 @@ void UBlendSpace1D::EvaluateAnimation(UAnimSequence* Animation, float Time, TArr
 		NormalizedTime += PlayLength;
 	}
 
-	// Extract transform for each bone
-	const TArray<FBoneAnimationTrack>& BoneTracks = DataModel->GetBoneAnimationTracks();
-	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
-	{
-		if (BoneIndex < BoneTracks.Num())
-		{
-			OutPose[BoneIndex] = DataModel->EvaluateBoneTrackTransform(BoneTracks[BoneIndex].Name, NormalizedTime);
-		}
-		else
-		{
-			OutPose[BoneIndex] = FTransform();
-		}
-	}
+	// 트랙 인덱스 순서로 모든 본을 한 번에 평가 (본마다 이름으로 트랙을 찾지 않음)
+	FAnimExtractContext ExtractContext(NormalizedTime, false);
+	FPoseContext PoseContext;
+	PoseContext.Pose.swap(OutPose);
+	Animation->GetAnimationPose(PoseContext, ExtractContext);
+	OutPose.swap(PoseContext.Pose);
 }
 
 void UBlendSpace1D::BlendPoses(const TArray<FTransform>& PoseA,
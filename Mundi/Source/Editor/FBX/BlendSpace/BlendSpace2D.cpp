@@ -5,6 +5,16 @@
 
 IMPLEMENT_CLASS(UBlendSpace2D)
 
+namespace
+{
+	/** 파라미터 값 -> 격자 좌표 (범위 밖은 가장자리 셀) */
+	int32 ToLookupCoord(float Value, float GridMin, float InvCellSize, int32 Resolution)
+	{
+		const int32 Coord = FMath::FloorToInt((Value - GridMin) * InvCellSize);
+		return FMath::Clamp(Coord, 0, Resolution - 1);
+	}
+}
+
 // ============================================================
 // Parameter Setting
 // ============================================================
@@ -35,6 +45,7 @@ int32 UBlendSpace2D::AddSample(UAnimSequence* Animation, float X, float Y)
 	int32 Index = Samples.Num();
 	Samples.Add(FBlendSample2D(Animation, X, Y));
 	bTriangulationDirty = true;
+	bLookupGridDirty = true;
 
 	//UE_LOG("UBlendSpace2D::AddSample - Added '%s' at (%.1f, %.1f) (Total: %d samples)", Animation->ObjectName.ToString().c_str(), X, Y, Samples.Num());
 
@@ -48,6 +59,7 @@ void UBlendSpace2D::ClearSamples()
 	CurrentPlayTime = 0.0f;
 	PreviousPlayTime = 0.0f;
 	bTriangulationDirty = true;
+	bLookupGridDirty = true;
 }
 
 const FBlendSample2D* UBlendSpace2D::GetSample(int32 Index) const
@@ -69,6 +81,7 @@ bool UBlendSpace2D::SetSamplePosition(int32 Index, float X, float Y)
 	Samples[Index].Position.X = X;
 	Samples[Index].Position.Y = Y;
 	bTriangulationDirty = true;
+	bLookupGridDirty = true;
 	return true;
 }
 
@@ -97,6 +110,7 @@ bool UBlendSpace2D::RemoveSample(int32 Index)
 
 	Samples.RemoveAt(Index);
 	bTriangulationDirty = true;
+	bLookupGridDirty = true;
 	return true;
 }
 
@@ -122,6 +136,8 @@ void UBlendSpace2D::SetParameterRange(const FVector2D& InMin, const FVector2D& I
 		MinParameter.Y = MaxParameter.Y;
 		MaxParameter.Y = Temp;
 	}
+
+	bLookupGridDirty = true;
 }
 
 // ============================================================
@@ -156,6 +172,7 @@ void UBlendSpace2D::AddTriangle(int32 A, int32 B, int32 C)
 	}
 
 	Triangles.Add(FBlendTriangle(A, B, C));
+	bLookupGridDirty = true;
 	//UE_LOG("UBlendSpace2D::AddTriangle - Added triangle (%d, %d, %d)", A, B, C);
 }
 
@@ -167,17 +184,20 @@ bool UBlendSpace2D::RemoveTriangle(int32 Index)
 	}
 
 	Triangles.RemoveAt(Index);
+	bLookupGridDirty = true;
 	return true;
 }
 
 void UBlendSpace2D::ClearTriangles()
 {
 	Triangles.Empty();
+	bLookupGridDirty = true;
 }
 
 void UBlendSpace2D::PerformDelaunayTriangulation()
 {
 	Triangles.Empty();
+	bLookupGridDirty = true;
 
 	if (Samples.Num() < 3)
 	{
@@ -324,6 +344,21 @@ bool UBlendSpace2D::IsPointInCircumcircle(const FVector2D& Point, const FBlendTr
 
 int32 UBlendSpace2D::FindContainingTriangle(const FVector2D& Point) const
 {
+	// 격자가 최신이면 점이 속한 셀의 후보만 검사 (후보는 삼각형 인덱스 순이라 선형 탐색과 결과가 같다)
+	if (!bLookupGridDirty && !LookupCellStart.IsEmpty())
+	{
+		const int32 Cell = GetLookupCell(Point.X, Point.Y);
+		for (int32 i = LookupCellStart[Cell]; i < LookupCellStart[Cell + 1]; ++i)
+		{
+			const int32 TriIndex = LookupTriangles[i];
+			if (IsPointInTriangle(Point, Triangles[TriIndex]))
+			{
+				return TriIndex;
+			}
+		}
+		return -1;
+	}
+
 	for (int32 i = 0; i < Triangles.Num(); ++i)
 	{
 		if (IsPointInTriangle(Point, Triangles[i]))
@@ -334,6 +369,91 @@ int32 UBlendSpace2D::FindContainingTriangle(const FVector2D& Point) const
 	return -1;
 }
 
+int32 UBlendSpace2D::GetLookupCell(float X, float Y) const
+{
+	const int32 CellX = ToLookupCoord(X, LookupGridMin.X, LookupInvCellSize.X, LookupGridResolution);
+	const int32 CellY = ToLookupCoord(Y, LookupGridMin.Y, LookupInvCellSize.Y, LookupGridResolution);
+	return CellY * LookupGridResolution + CellX;
+}
+
+void UBlendSpace2D::BuildLookupGrid()
+{
+	bLookupGridDirty = false;
+
+	// 파라미터는 Update에서 범위로 클램프되므로 격자는 범위만 덮으면 된다
+	const int32 NumCells = LookupGridResolution * LookupGridResolution;
+	const float ExtentX = MaxParameter.X - MinParameter.X;
+	const float ExtentY = MaxParameter.Y - MinParameter.Y;
+	LookupGridMin = MinParameter;
+	LookupInvCellSize.X = ExtentX > KINDA_SMALL_NUMBER ? static_cast<float>(LookupGridResolution) / ExtentX : 0.0f;
+	LookupInvCellSize.Y = ExtentY > KINDA_SMALL_NUMBER ? static_cast<float>(LookupGridResolution) / ExtentY : 0.0f;
+
+	LookupCellStart.SetNum(NumCells + 1);
+	std::fill(LookupCellStart.begin(), LookupCellStart.end(), 0);
+	LookupTriangles.Empty();
+
+	// 삼각형 바운드가 덮는 셀 범위 (샘플 인덱스가 잘못된 수동 삼각형은 제외)
+	auto GetCellRange = [this](const FBlendTriangle& Tri, int32& OutMinX, int32& OutMinY, int32& OutMaxX, int32& OutMaxY)
+	{
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			if (Tri.Indices[Corner] < 0 || Tri.Indices[Corner] >= Samples.Num())
+			{
+				return false;
+			}
+		}
+
+		const FVector2D& A = Samples[Tri.Indices[0]].Position;
+		const FVector2D& B = Samples[Tri.Indices[1]].Position;
+		const FVector2D& C = Samples[Tri.Indices[2]].Position;
+		OutMinX = ToLookupCoord(FMath::Min(A.X, FMath::Min(B.X, C.X)), LookupGridMin.X, LookupInvCellSize.X, LookupGridResolution);
+		OutMaxX = ToLookupCoord(FMath::Max(A.X, FMath::Max(B.X, C.X)), LookupGridMin.X, LookupInvCellSize.X, LookupGridResolution);
+		OutMinY = ToLookupCoord(FMath::Min(A.Y, FMath::Min(B.Y, C.Y)), LookupGridMin.Y, LookupInvCellSize.Y, LookupGridResolution);
+		OutMaxY = ToLookupCoord(FMath::Max(A.Y, FMath::Max(B.Y, C.Y)), LookupGridMin.Y, LookupInvCellSize.Y, LookupGridResolution);
+		return true;
+	};
+
+	// 1. 셀별 후보 수
+	int32 MinX, MinY, MaxX, MaxY;
+	for (const FBlendTriangle& Tri : Triangles)
+	{
+		if (!GetCellRange(Tri, MinX, MinY, MaxX, MaxY))
+		{
+			continue;
+		}
+		for (int32 CellY = MinY; CellY <= MaxY; ++CellY)
+		{
+			for (int32 CellX = MinX; CellX <= MaxX; ++CellX)
+			{
+				++LookupCellStart[CellY * LookupGridResolution + CellX + 1];
+			}
+		}
+	}
+
+	// 2. 누적해서 셀별 시작 위치로 바꾼 뒤 삼각형 인덱스 순서대로 채움
+	for (int32 Cell = 0; Cell < NumCells; ++Cell)
+	{
+		LookupCellStart[Cell + 1] += LookupCellStart[Cell];
+	}
+	LookupTriangles.SetNum(LookupCellStart[NumCells]);
+
+	TArray<int32> Cursor(LookupCellStart.begin(), LookupCellStart.end() - 1);
+	for (int32 TriIndex = 0; TriIndex < Triangles.Num(); ++TriIndex)
+	{
+		if (!GetCellRange(Triangles[TriIndex], MinX, MinY, MaxX, MaxY))
+		{
+			continue;
+		}
+		for (int32 CellY = MinY; CellY <= MaxY; ++CellY)
+		{
+			for (int32 CellX = MinX; CellX <= MaxX; ++CellX)
+			{
+				LookupTriangles[Cursor[CellY * LookupGridResolution + CellX]++] = TriIndex;
+			}
+		}
+	}
+}
+
 bool UBlendSpace2D::IsPointInTriangle(const FVector2D& Point, const FBlendTriangle& Tri) const
 {
 	const FVector2D& A = Samples[Tri.Indices[0]].Position;
@@ -447,112 +567,87 @@ void UBlendSpace2D::EvaluateAnimation(UAnimSequence* Animation, float Time, TArr
 		NormalizedTime += PlayLength;
 	}
 
-	const TArray<FBoneAnimationTrack>& BoneTracks = DataModel->GetBoneAnimationTracks();
-	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
-	{
-		if (BoneIndex < BoneTracks.Num())
-		{
-			OutPose[BoneIndex] = DataModel->EvaluateBoneTrackTransform(BoneTracks[BoneIndex].Name, NormalizedTime);
-		}
-		else
-		{
-			OutPose[BoneIndex] = FTransform();
-		}
-	}
+	// 트랙 인덱스 순서로 모든 본을 한 번에 평가 (본마다 이름으로 트랙을 찾지 않음)
+	FAnimExtractContext ExtractContext(NormalizedTime, false);
+	FPoseContext PoseContext;
+	PoseContext.Pose.swap(OutPose);
+	Animation->GetAnimationPose(PoseContext, ExtractContext);
+	OutPose.swap(PoseContext.Pose);
 }
 
-void UBlendSpace2D::BlendPosesBarycentric(
-	const TArray<FTransform>& PoseA,
-	const TArray<FTransform>& PoseB,
-	const TArray<FTransform>& PoseC,
-	float U, float V, float W,
-	TArray<FTransform>& OutPose)
+void UBlendSpace2D::BlendWeightedSamples(const int32* SampleIndices, const float* Weights, int32 NumSamples,
+                                          float Time, TArray<FTransform>& OutPose)
 {
-	int32 NumBones = PoseA.Num();
-	if (PoseB.Num() < NumBones) NumBones = PoseB.Num();
-	if (PoseC.Num() < NumBones) NumBones = PoseC.Num();
+	// 두 번째 샘플부터 평가 결과를 받는 스크래치 (스레드별로 재사용, 첫 샘플은 OutPose에 바로 평가)
+	thread_local TArray<FTransform> SamplePose;
 
-	OutPose.SetNum(NumBones);
+	int32 NumBlended = 0;
+	int32 NumBones = 0;
+	float FirstWeight = 0.0f;
+	float TotalWeight = 0.0f;
 
-	for (int32 i = 0; i < NumBones; ++i)
+	for (int32 i = 0; i < NumSamples; ++i)
 	{
-		// Position: weighted average
-		FVector BlendedPos =
-			PoseA[i].Translation * U +
-			PoseB[i].Translation * V +
-			PoseC[i].Translation * W;
-
-		// Scale: weighted average
-		FVector BlendedScale =
-			PoseA[i].Scale3D * U +
-			PoseB[i].Scale3D * V +
-			PoseC[i].Scale3D * W;
-
-		// Rotation: sequential Slerp based on largest weight
-		FQuat BlendedRot;
-		if (U >= V && U >= W)
+		const float Weight = Weights[i];
+		UAnimSequence* Animation = Samples[SampleIndices[i]].Animation;
+		if (Weight <= ZeroWeightThreshold || !Animation)
 		{
-			// A has largest weight
-			float TotalVW = V + W;
-			if (TotalVW > 0.001f)
-			{
-				FQuat BC = FQuat::Slerp(PoseB[i].Rotation, PoseC[i].Rotation, W / TotalVW);
-				BlendedRot = FQuat::Slerp(PoseA[i].Rotation, BC, TotalVW);
-			}
-			else
-			{
-				BlendedRot = PoseA[i].Rotation;
-			}
+			continue;
 		}
-		else if (V >= W)
+
+		if (NumBlended == 0)
 		{
-			// B has largest weight
-			float TotalUW = U + W;
-			if (TotalUW > 0.001f)
-			{
-				FQuat AC = FQuat::Slerp(PoseA[i].Rotation, PoseC[i].Rotation, W / TotalUW);
-				BlendedRot = FQuat::Slerp(PoseB[i].Rotation, AC, TotalUW);
-			}
-			else
-			{
-				BlendedRot = PoseB[i].Rotation;
-			}
+			EvaluateAnimation(Animation, Time, OutPose);
+			NumBones = OutPose.Num();
+			FirstWeight = Weight;
 		}
 		else
 		{
-			// C has largest weight
-			float TotalUV = U + V;
-			if (TotalUV > 0.001f)
+			// 블렌드할 샘플이 하나뿐이면 곱셈이 필요 없으므로 두 번째 샘플이 올 때 첫 샘플에 가중치를 적용
+			if (NumBlended == 1)
 			{
-				FQuat AB = FQuat::Slerp(PoseA[i].Rotation, PoseB[i].Rotation, V / TotalUV);
-				BlendedRot = FQuat::Slerp(PoseC[i].Rotation, AB, TotalUV);
+				for (int32 Bone = 0; Bone < NumBones; ++Bone)
+				{
+					FTransform& Out = OutPose[Bone];
+					Out.Translation = Out.Translation * FirstWeight;
+					Out.Scale3D = Out.Scale3D * FirstWeight;
+					Out.Rotation = Out.Rotation * FirstWeight;
+				}
 			}
-			else
+
+			EvaluateAnimation(Animation, Time, SamplePose);
+			NumBones = FMath::Min(NumBones, SamplePose.Num());
+
+			for (int32 Bone = 0; Bone < NumBones; ++Bone)
 			{
-				BlendedRot = PoseC[i].Rotation;
+				FTransform& Out = OutPose[Bone];
+				const FTransform& Sample = SamplePose[Bone];
+				Out.Translation = Out.Translation + Sample.Translation * Weight;
+				Out.Scale3D = Out.Scale3D + Sample.Scale3D * Weight;
+
+				// 누적 중인 회전과 반대 반구면 부호를 뒤집어 최단 경로로 섞음
+				const float RotationWeight = FQuat::Dot(Out.Rotation, Sample.Rotation) < 0.0f ? -Weight : Weight;
+				Out.Rotation = Out.Rotation + Sample.Rotation * RotationWeight;
 			}
 		}
 
-		OutPose[i] = FTransform(BlendedPos, BlendedRot, BlendedScale);
+		TotalWeight += Weight;
+		++NumBlended;
 	}
-}
 
-void UBlendSpace2D::BlendTwoPoses(
-	const TArray<FTransform>& PoseA,
-	const TArray<FTransform>& PoseB,
-	float Alpha,
-	TArray<FTransform>& OutPose)
-{
-	int32 NumBones = FMath::Min(PoseA.Num(), PoseB.Num());
-	OutPose.SetNum(NumBones);
-
-	for (int32 i = 0; i < NumBones; ++i)
+	if (NumBlended <= 1)
 	{
-		FVector BlendedPos = FVector::Lerp(PoseA[i].Translation, PoseB[i].Translation, Alpha);
-		FQuat BlendedRot = FQuat::Slerp(PoseA[i].Rotation, PoseB[i].Rotation, Alpha);
-		FVector BlendedScale = FVector::Lerp(PoseA[i].Scale3D, PoseB[i].Scale3D, Alpha);
+		return;
+	}
 
-		OutPose[i] = FTransform(BlendedPos, BlendedRot, BlendedScale);
+	// 건너뛴 샘플 몫까지 합이 1이 되도록 다시 나누고 회전 정규화
+	OutPose.SetNum(NumBones);
+	const float InvTotalWeight = 1.0f / TotalWeight;
+	for (FTransform& Out : OutPose)
+	{
+		Out.Translation = Out.Translation * InvTotalWeight;
+		Out.Scale3D = Out.Scale3D * InvTotalWeight;
+		Out.Rotation.Normalize();
 	}
 }
 
@@ -610,10 +705,9 @@ void UBlendSpace2D::Update(float X, float Y, float DeltaTime, TArray<FTransform>
 
 		DominantSequence = (Alpha <= 0.5f) ? Samples[0].Animation : Samples[1].Animation;
 
-		TArray<FTransform> PoseA, PoseB;
-		EvaluateAnimation(Samples[0].Animation, CurrentPlayTime, PoseA);
-		EvaluateAnimation(Samples[1].Animation, CurrentPlayTime, PoseB);
-		BlendTwoPoses(PoseA, PoseB, Alpha, OutPose);
+		const int32 SampleIndices[2] = { 0, 1 };
+		const float Weights[2] = { 1.0f - Alpha, Alpha };
+		BlendWeightedSamples(SampleIndices, Weights, 2, CurrentPlayTime, OutPose);
 
 		float PlayLengthA = Samples[0].Animation ? Samples[0].Animation->GetPlayLength() : 0.0f;
 		float PlayLengthB = Samples[1].Animation ? Samples[1].Animation->GetPlayLength() : 0.0f;
@@ -635,6 +729,11 @@ void UBlendSpace2D::Update(float X, float Y, float DeltaTime, TArray<FTransform>
 		bTriangulationDirty = false;
 	}
 
+	if (bLookupGridDirty)
+	{
+		BuildLookupGrid();
+	}
+
 	// Find containing triangle
 	int32 TriIndex = FindContainingTriangle(CurrentParameter);
 
@@ -694,14 +793,9 @@ void UBlendSpace2D::Update(float X, float Y, float DeltaTime, TArray<FTransform>
 		DominantSequence = Samples[Tri.Indices[2]].Animation;
 	}
 
-	// Evaluate three poses
-	TArray<FTransform> PoseA, PoseB, PoseC;
-	EvaluateAnimation(Samples[Tri.Indices[0]].Animation, CurrentPlayTime, PoseA);
-	EvaluateAnimation(Samples[Tri.Indices[1]].Animation, CurrentPlayTime, PoseB);
-	EvaluateAnimation(Samples[Tri.Indices[2]].Animation, CurrentPlayTime, PoseC);
-
-	// Blend with barycentric weights
-	BlendPosesBarycentric(PoseA, PoseB, PoseC, U, V, W, OutPose);
+	// Blend with barycentric weights (가중치가 0인 꼭짓점은 평가하지 않음)
+	const float Weights[3] = { U, V, W };
+	BlendWeightedSamples(Tri.Indices, Weights, 3, CurrentPlayTime, OutPose);
 
 	// Update play time
 	float PlayLengthA = Samples[Tri.Indices[0]].Animation ? Samples[Tri.Indices[0]].Animation->GetPlayLength() : 0.0f;
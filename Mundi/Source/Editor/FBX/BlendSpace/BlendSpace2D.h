@@ -55,6 +55,7 @@ struct FBlendTriangle
  * - Blends multiple animations based on two parameters (X: Direction, Y: Speed)
  * - Uses Delaunay triangulation for dynamic sample placement
  * - Barycentric interpolation within triangles
+ * - 삼각형 탐색은 파라미터 범위를 나눈 격자(셀 -> 후보 삼각형)로 하고, 가중치가 0이 아닌 샘플만 평가해 출력 포즈에 바로 누적
  *
  * @example Usage
  *
@@ -182,14 +183,34 @@ private:
 	                          float& OutU, float& OutV, float& OutW) const;
 	int32 FindClosestSample(const FVector2D& Point) const;
 
+	/** 삼각형 바운드가 겹치는 셀마다 후보 삼각형 목록을 만듦 (삼각분할/샘플 위치/범위가 바뀌면 다시 구움) */
+	void BuildLookupGrid();
+	/** 점이 속한 셀 인덱스 (범위 밖이면 가장자리 셀로 클램프) */
+	int32 GetLookupCell(float X, float Y) const;
+
 	void EvaluateAnimation(UAnimSequence* Animation, float Time, TArray<FTransform>& OutPose);
-	void BlendPosesBarycentric(const TArray<FTransform>& PoseA,
-	                           const TArray<FTransform>& PoseB,
-	                           const TArray<FTransform>& PoseC,
-	                           float U, float V, float W,
-	                           TArray<FTransform>& OutPose);
-	void BlendTwoPoses(const TArray<FTransform>& PoseA,
-	                   const TArray<FTransform>& PoseB,
-	                   float Alpha,
-	                   TArray<FTransform>& OutPose);
+
+	/**
+	 * 샘플별 가중치로 포즈를 블렌드해 OutPose에 바로 누적
+	 * - 가중치가 ZeroWeightThreshold 이하인 샘플은 평가하지 않음
+	 * - 위치/스케일은 가중 합, 회전은 최단 경로 부호를 맞춘 가중 합을 정규화
+	 */
+	void BlendWeightedSamples(const int32* SampleIndices, const float* Weights, int32 NumSamples,
+	                          float Time, TArray<FTransform>& OutPose);
+
+	// ============================================================
+	// Lookup Grid
+	// ============================================================
+
+	/** 격자 한 변의 셀 수 */
+	static constexpr int32 LookupGridResolution = 16;
+	/** 이 값 이하의 가중치는 0으로 보고 샘플을 건너뜀 */
+	static constexpr float ZeroWeightThreshold = 1.0e-5f;
+
+	/** 셀별 후보 삼각형 구간 [LookupCellStart[Cell], LookupCellStart[Cell + 1]) (삼각형 인덱스 오름차순) */
+	TArray<int32> LookupCellStart;
+	TArray<int32> LookupTriangles;
+	FVector2D LookupGridMin = FVector2D(0.0f, 0.0f);
+	FVector2D LookupInvCellSize = FVector2D(0.0f, 0.0f);
+	bool bLookupGridDirty = true;
 };
@@ -8,6 +8,13 @@
 #include "PathUtils.h"
 #include <filesystem>
 
+namespace
+{
+	// 파일 앞에 두는 포맷 식별자. 버전이 다르면(압축 이전 캐시 포함) 로드를 실패시켜 FBX에서 다시 추출하게 한다
+	constexpr uint32 AnimCacheMagic = 0x4D494E41; // "ANIM"
+	constexpr uint32 AnimCacheVersion = 3;        // 2: 압축 트랙 (FCompressedAnimTrack), 3: 벡터 트랙 float 폴백 (RawValues)
+}
+
 bool FBXAnimationCache::TryLoadAnimationsFromCache(const FString& NormalizedPath, TArray<UAnimSequence*>& OutAnimations)
 {
 #ifdef USE_OBJ_CACHE
@@ -44,6 +51,8 @@ bool FBXAnimationCache::TryLoadAnimationsFromCache(const FString& NormalizedPath
 			{
 				UE_LOG("Animation cache already registered: %s", AnimKey.c_str());
 			}
+			// 노티파이 메타는 파일 경로가 정해진 지금 게임 스레드에서 읽어 둔다 (워커의 노티파이 수집은 로드하지 않음)
+			CachedAnim->EnsureNotifiesLoaded();
 
 			OutAnimations.Add(CachedAnim);
 			bLoadedAny = true;
@@ -80,6 +89,10 @@ bool FBXAnimationCache::SaveAnimationToCache(UAnimSequence* Animation, const FSt
 			return false;
 		}
 
+		uint32 Magic = AnimCacheMagic;
+		uint32 Version = AnimCacheVersion;
+		Writer << Magic << Version;
+
 		// 애니메이션 이름 먼저 쓰기
 		FString AnimName = Animation->ObjectName.ToString();
 		Serialization::WriteString(Writer, AnimName);
@@ -116,20 +129,13 @@ bool FBXAnimationCache::SaveAnimationToCache(UAnimSequence* Animation, const FSt
 			FString BoneName = Track.Name.ToString();
 			Serialization::WriteString(Writer, BoneName);
 
-			// 위치 키 쓰기
-			Serialization::WriteArray(Writer, Track.InternalTrack.PosKeys);
-
-			// 회전 키 쓰기 (FQuat는 직접 직렬화)
-			TArray<FQuat>& RotKeys = Track.InternalTrack.RotKeys;
-			uint32 NumRotKeys = (uint32)RotKeys.Num();
-			Writer << NumRotKeys;
-			for (FQuat& Rot : RotKeys)
+			// 압축 트랙 쓰기 (아직 압축 전인 트랙은 기본 설정으로 압축한 사본을 씀)
+			FCompressedAnimTrack Compressed = Track.CompressedTrack;
+			if (!Compressed.bValid)
 			{
-				Writer << Rot.X << Rot.Y << Rot.Z << Rot.W;
+				Compressed.Compress(Track.InternalTrack, FAnimCompressionSettings());
 			}
-
-			// 스케일 키 쓰기
-			Serialization::WriteArray(Writer, Track.InternalTrack.ScaleKeys);
+			Writer << Compressed;
 		}
 
 		Writer.Close();
@@ -153,6 +159,15 @@ UAnimSequence* FBXAnimationCache::LoadAnimationFromCache(const FString& CachePat
 			return nullptr;
 		}
 
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		Reader << Magic << Version;
+		if (Magic != AnimCacheMagic || Version != AnimCacheVersion)
+		{
+			UE_LOG("Animation cache is outdated (version %u), re-extracting: %s", Version, CachePath.c_str());
+			return nullptr;
+		}
+
 		// 새 애니메이션 시퀀스 생성
 		UAnimSequence* Animation = NewObject<UAnimSequence>();
 
@@ -209,28 +224,10 @@ UAnimSequence* FBXAnimationCache::LoadAnimationFromCache(const FString& CachePat
 			// 본 트랙 추가
 			DataModel->AddBoneTrack(BoneName);
 
-			// 위치 키 읽기
-			TArray<FVector> PosKeys;
-			Serialization::ReadArray(Reader, PosKeys);
-
-			// 회전 키 읽기
-			uint32 NumRotKeys;
-			Reader << NumRotKeys;
-			TArray<FQuat> RotKeys;
-			RotKeys.resize(NumRotKeys);
-			for (uint32 j = 0; j < NumRotKeys; ++j)
-			{
-				float X, Y, Z, W;
-				Reader << X << Y << Z << W;
-				RotKeys[j] = FQuat(X, Y, Z, W);
-			}
-
-			// 스케일 키 읽기
-			TArray<FVector> ScaleKeys;
-			Serialization::ReadArray(Reader, ScaleKeys);
-
-			// 데이터 모델에 키 설정
-			DataModel->SetBoneTrackKeys(BoneName, PosKeys, RotKeys, ScaleKeys);
+			// 압축 트랙 읽기 (원본 키로 풀지 않고 그대로 평가에 사용)
+			FCompressedAnimTrack Compressed;
+			Reader << Compressed;
+			DataModel->SetBoneTrackCompressed(BoneName, Compressed);
 		}
 
 		Reader.Close();
@@ -173,6 +173,14 @@ void FBXAnimationLoader::ProcessAnimations(FbxScene* Scene, const FSkeletalMeshD
 
 		UE_LOG("Extracted animation data for %d bones", ExtractedBones);
 
+		// 키 제거 + 양자화 (원본 키는 여기서 해제되고, 캐시에도 압축 트랙이 저장됨)
+		const FAnimCompressionStats Stats = DataModel->CompressTracks();
+		UE_LOG("Compressed animation '%s': %.1f KB -> %.1f KB (x%.1f), keys %d -> %d, constant channels %d/%d",
+			AnimStackName.c_str(),
+			static_cast<double>(Stats.RawBytes) / 1024.0, static_cast<double>(Stats.CompressedBytes) / 1024.0,
+			Stats.CompressedBytes > 0 ? static_cast<double>(Stats.RawBytes) / static_cast<double>(Stats.CompressedBytes) : 0.0,
+			Stats.RawKeys, Stats.CompressedKeys, Stats.NumConstantChannels, Stats.NumTracks * 3);
+
 		// 호환성 검사를 위해 본 이름 저장
 		TArray<FName> BoneNames;
 		for (const FBone& Bone : MeshData.Skeleton.Bones)
@@ -184,6 +192,8 @@ void FBXAnimationLoader::ProcessAnimations(FbxScene* Scene, const FSkeletalMeshD
 		// ResourceManager에 애니메이션 등록
 		FString AnimKey = FilePath + "_" + AnimStackName;
 		RESOURCE.Add<UAnimSequence>(AnimKey, AnimSequence);
+		// 노티파이 메타는 파일 경로가 정해진 지금 게임 스레드에서 읽어 둔다 (워커의 노티파이 수집은 로드하지 않음)
+		AnimSequence->EnsureNotifiesLoaded();
 
 		OutAnimations.Add(AnimSequence);
 		UE_LOG("Extracted animation: %s (Duration: %.2fs, Frames: %d, Bones: %d) -> Key: %s",
@@ -63,6 +63,9 @@ bool USkeletalMesh::Load(const FString& InFilePath, ID3D11Device* InDevice)
     IndexCount = static_cast<uint32>(Data->Indices.size());
     CPUSkinnedVertexStride = sizeof(FVertexDynamic);
     GPUSkinnedVertexStride = sizeof(FSkinnedVertex);
+    BuildInverseBindPoses();
+    FCPUSkinning::BuildCompactInfluences(Data->Vertices, Data->Skeleton.Bones.Num(), CompactSkinInfluences);
+    BuildBoneLODs();
     return true;
 }
 
@@ -166,6 +169,43 @@ void USkeletalMesh::BuildLocalAABBs()
     }
 }
 
+void USkeletalMesh::BuildInverseBindPoses()
+{
+    // FBone은 이름 등과 섞여 있어 본 4개씩 SIMD로 읽으려면 행렬만 따로 연속 배열로 둔다
+    InverseBindPoses.Empty();
+    if (!Data)
+    {
+        return;
+    }
+
+    InverseBindPoses.Reserve(Data->Skeleton.Bones.Num());
+    for (const FBone& Bone : Data->Skeleton.Bones)
+    {
+        InverseBindPoses.Add(Bone.InverseBindPose);
+    }
+}
+
+void USkeletalMesh::BuildBoneLODs()
+{
+    BoneMaxLODs.Empty();
+    BindPoseBounds = FAABB();
+    if (!Data || Data->Vertices.IsEmpty())
+    {
+        return;
+    }
+
+    FAnimUpdateRate::BuildBoneMaxLODs(*Data, BoneMaxLODs);
+
+    FVector Min = Data->Vertices[0].Position;
+    FVector Max = Min;
+    for (const FSkinnedVertex& Vertex : Data->Vertices)
+    {
+        Min = Min.ComponentMin(Vertex.Position);
+        Max = Max.ComponentMax(Vertex.Position);
+    }
+    BindPoseBounds = FAABB(Min, Max);
+}
+
 void USkeletalMesh::CreateIndexBuffer(FSkeletalMeshData* InSkeletalMesh, ID3D11Device* InDevice)
 {
     HRESULT hr = D3D11RHI::CreateIndexBuffer(InDevice, InSkeletalMesh, &IndexBuffer);
@@ -1,6 +1,8 @@
 ﻿#pragma once
 #include "ResourceBase.h"
 #include "../Physics/PhysicsAsset.h"
+#include "Source/Runtime/Engine/Animation/CPUSkinning.h"
+#include "Source/Runtime/Engine/Animation/AnimUpdateRate.h"
 
 class USkeletalMesh : public UResourceBase
 {
@@ -38,9 +40,22 @@ public:
 
     void BuildLocalAABBs();
     const TArray<FAABB>& GetLocalAABBs() const { return BoneLocalAABBs; }
+
+    /** 본 순서대로 연속 저장한 InverseBindPose (스키닝 팔레트 SIMD 커널 입력) */
+    const TArray<FMatrix>& GetInverseBindPoses() const { return InverseBindPoses; }
+
+    /** CPU 스키닝용 8비트 인덱스/가중치 스트림 (본 256개 초과면 nullptr -> 스칼라 경로) */
+    const FCompactSkinInfluence* GetCompactSkinInfluences() const { return CompactSkinInfluences.IsEmpty() ? nullptr : CompactSkinInfluences.data(); }
+
+    /** 본별로 평가를 유지하는 최대 본 LOD (FAnimUpdateRateParams::IsBoneRequired 입력) */
+    const TArray<uint8>& GetBoneMaxLODs() const { return BoneMaxLODs; }
+    /** 바인드 포즈 정점 바운드 (컴포넌트 공간, URO 화면 크기 계산용) */
+    const FAABB& GetBindPoseBounds() const { return BindPoseBounds; }
     
 private:
     void CreateIndexBuffer(FSkeletalMeshData* InSkeletalMesh, ID3D11Device* InDevice);
+    void BuildInverseBindPoses();
+    void BuildBoneLODs();
     void ReleaseResources();
     
 public:
@@ -58,6 +73,10 @@ private:
     uint32 GPUSkinnedVertexStride = 0;
 
     TArray<FAABB> BoneLocalAABBs;
+    TArray<FMatrix> InverseBindPoses;
+    TArray<FCompactSkinInfluence> CompactSkinInfluences;
+    TArray<uint8> BoneMaxLODs;
+    FAABB BindPoseBounds;
     
     // CPU 리소스
     FSkeletalMeshData* Data = nullptr;
@@ -0,0 +1,145 @@
+﻿#include "pch.h"
+#include "ContainerBenchmark.h"
+#include "PlatformTime.h"
+#include <random>
+
+namespace
+{
+	// 엔진 쓰임새 기준 크기: 액터/라이트 수십 개 ~ 스태틱 메시 수만 개
+	constexpr int32 BenchSizes[] = { 64, 1024, 16384, 131072 };
+
+	struct FOpTimes
+	{
+		double InsertMs = 0.0;
+		double FindHitMs = 0.0;
+		double FindMissMs = 0.0;
+		double IterateMs = 0.0;
+		double EraseMs = 0.0;
+		uint64 Checksum = 0;
+	};
+
+	uint64 KeyBits(const void* Key) { return reinterpret_cast<uint64>(Key); }
+	uint64 KeyBits(const FString& Key) { return Key.size(); }
+
+	/** 같은 키 세트로 맵 하나를 측정 (MapType은 TMap 또는 TStableMap) */
+	template<typename MapType, typename KeyType>
+	FOpTimes MeasureMap(const TArray<KeyType>& Keys, const TArray<KeyType>& LookupOrder, const TArray<KeyType>& MissKeys, int32 Iterations)
+	{
+		FOpTimes Times;
+		for (int32 It = 0; It < Iterations; ++It)
+		{
+			MapType Map;
+
+			uint64 Start = FPlatformTime::Cycles64();
+			for (int32 i = 0; i < Keys.Num(); ++i)
+			{
+				Map.Add(Keys[i], i);
+			}
+			Times.InsertMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+			Start = FPlatformTime::Cycles64();
+			for (const KeyType& Key : LookupOrder)
+			{
+				if (const int32* Found = Map.Find(Key))
+				{
+					Times.Checksum += static_cast<uint64>(*Found);
+				}
+			}
+			Times.FindHitMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+			Start = FPlatformTime::Cycles64();
+			for (const KeyType& Key : MissKeys)
+			{
+				Times.Checksum += Map.Contains(Key) ? 1 : 0;
+			}
+			Times.FindMissMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+			Start = FPlatformTime::Cycles64();
+			for (int32 Pass = 0; Pass < 4; ++Pass)
+			{
+				for (const auto& Pair : Map)
+				{
+					Times.Checksum += KeyBits(Pair.first) + static_cast<uint64>(Pair.second);
+				}
+			}
+			Times.IterateMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+			Start = FPlatformTime::Cycles64();
+			for (const KeyType& Key : LookupOrder)
+			{
+				Map.Remove(Key);
+			}
+			Times.EraseMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+		}
+		return Times;
+	}
+
+	template<typename KeyType>
+	void RunKeySet(const char* KeyName, const TArray<KeyType>& AllKeys, int32 Count, int32 Iterations, std::mt19937& Rng)
+	{
+		// 앞쪽 Count개는 삽입, 뒤쪽 Count개는 미스 조회용
+		TArray<KeyType> Keys(AllKeys.begin(), AllKeys.begin() + Count);
+		TArray<KeyType> MissKeys(AllKeys.begin() + Count, AllKeys.begin() + Count * 2);
+		TArray<KeyType> LookupOrder = Keys;
+		std::shuffle(LookupOrder.begin(), LookupOrder.end(), Rng);
+
+		const FOpTimes Flat = MeasureMap<TMap<KeyType, int32>>(Keys, LookupOrder, MissKeys, Iterations);
+		const FOpTimes Std = MeasureMap<TStableMap<KeyType, int32>>(Keys, LookupOrder, MissKeys, Iterations);
+
+		char Buf[512];
+		const auto Ratio = [](double StdMs, double FlatMs) { return FlatMs > 0.0 ? StdMs / FlatMs : 0.0; };
+		std::snprintf(Buf, sizeof(Buf),
+			"[Container Bench] %-6s n=%-6d | insert %7.3f/%7.3f ms (x%.2f) | find %7.3f/%7.3f (x%.2f) | miss %7.3f/%7.3f (x%.2f) | iterate %7.3f/%7.3f (x%.2f) | erase %7.3f/%7.3f (x%.2f)%s\r\n",
+			KeyName, Count,
+			Flat.InsertMs, Std.InsertMs, Ratio(Std.InsertMs, Flat.InsertMs),
+			Flat.FindHitMs, Std.FindHitMs, Ratio(Std.FindHitMs, Flat.FindHitMs),
+			Flat.FindMissMs, Std.FindMissMs, Ratio(Std.FindMissMs, Flat.FindMissMs),
+			Flat.IterateMs, Std.IterateMs, Ratio(Std.IterateMs, Flat.IterateMs),
+			Flat.EraseMs, Std.EraseMs, Ratio(Std.EraseMs, Flat.EraseMs),
+			Flat.Checksum == Std.Checksum ? "" : " (MISMATCH)");
+		UE_LOG(Buf);
+	}
+}
+
+void FContainerBenchmark::Run(int32 Iterations)
+{
+	std::mt19937 Rng(12345);
+	const int32 MaxCount = BenchSizes[std::size(BenchSizes) - 1];
+
+	// 포인터 키: 실제 힙 객체 주소처럼 정렬된 값 (UPrimitiveComponent*, AActor* 등)
+	TArray<const void*> PointerStorage;
+	PointerStorage.Reserve(MaxCount * 2);
+	{
+		TArray<uint64> Slots(MaxCount * 2);
+		for (int32 i = 0; i < Slots.Num(); ++i)
+		{
+			Slots[i] = 0x10000000ull + static_cast<uint64>(i) * 592; // 컴포넌트 크기 정도 간격
+		}
+		std::shuffle(Slots.begin(), Slots.end(), Rng);
+		for (uint64 Slot : Slots)
+		{
+			PointerStorage.Add(reinterpret_cast<const void*>(Slot));
+		}
+	}
+
+	// 문자열 키: 리소스 경로 (UMeshLoader::MeshCache, 리소스 맵 등)
+	TArray<FString> StringStorage;
+	StringStorage.Reserve(MaxCount * 2);
+	for (int32 i = 0; i < MaxCount * 2; ++i)
+	{
+		StringStorage.Add("Data/Model/Props/Mesh_" + std::to_string(Rng() % 100000) + "_" + std::to_string(i) + ".obj");
+	}
+
+	char Buf[256];
+	std::snprintf(Buf, sizeof(Buf), "[Container Bench] TMap (open addressing) / TStableMap (std::unordered_map), iterations=%d, x = std/flat\r\n", Iterations);
+	UE_LOG(Buf);
+
+	for (int32 Count : BenchSizes)
+	{
+		RunKeySet("ptr", PointerStorage, Count, Iterations, Rng);
+	}
+	for (int32 Count : BenchSizes)
+	{
+		RunKeySet("string", StringStorage, Count, Iterations, Rng);
+	}
+}
@@ -0,0 +1,12 @@
+﻿#pragma once
+
+/**
+ * @brief TMap/TSet(오픈 어드레싱)과 TStableMap(std::unordered_map 기반) 비교 벤치마크
+ * - 엔진에서 자주 쓰는 키 형태(컴포넌트 포인터, 리소스 경로 문자열)로 삽입/조회/삭제/순회 시간을 측정
+ * - 콘솔 명령 "BENCH CONTAINERS"로 실행, 결과는 UE_LOG로 출력
+ */
+class FContainerBenchmark
+{
+public:
+	static void Run(int32 Iterations = 8);
+};
@@ -0,0 +1,418 @@
+﻿#pragma once
+
+/**
+ * @brief TMap/TSet 공용 오픈 어드레싱 해시 테이블
+ * - 원소는 하나의 연속 배열(Elements)에 삽입 순서대로 저장, 순회는 배열을 그대로 훑음
+ * - 인덱스 테이블(Buckets)은 Robin Hood 선형 탐사. 버킷마다 (탐사 거리 | 8비트 지문, 원소 인덱스)만 들고 있어
+ *   키 비교 전에 지문으로 대부분 걸러냄
+ * - 삭제는 버킷 backward shift + 마지막 원소를 빈 자리로 옮기는 swap-remove (툼스톤 없음)
+ * - 노드 기반 std::unordered_map과 달리 삽입/삭제 시 다른 원소의 주소가 바뀔 수 있음
+ *   (값 포인터를 오래 들고 있어야 하면 TStableMap 사용)
+ * - erase(It)는 옮겨 온 원소를 가리키는 같은 위치를 반환하므로 `It = Map.erase(It)` 순회 패턴은 그대로 동작
+ * - 키가 const인 원소(TMap의 pair<const K, V>)도 담을 수 있도록 원소는 대입 없이 이동 생성으로만 옮김
+ */
+template<typename KeyType, typename ElementType, typename KeyFuncs, bool bConstIterator>
+class TFlatHashTable
+{
+    struct FBucket
+    {
+        uint32 DistAndFingerprint = 0; // 상위 24비트: 탐사 거리 + 1, 하위 8비트: 해시 지문 (0이면 빈 버킷)
+        uint32 ElementIndex = 0;
+    };
+
+    static constexpr uint32 DistInc = 1u << 8;
+    static constexpr uint32 FingerprintMask = DistInc - 1;
+    static constexpr uint32 MinBucketCount = 16;
+
+public:
+    using key_type = KeyType;
+    using value_type = ElementType;
+    using size_type = SIZE_T;
+    using difference_type = std::ptrdiff_t;
+    using hasher = std::hash<KeyType>;
+    using key_equal = std::equal_to<KeyType>;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using const_iterator = typename std::vector<ElementType>::const_iterator;
+    using iterator = std::conditional_t<bConstIterator, const_iterator, typename std::vector<ElementType>::iterator>;
+
+    TFlatHashTable() = default;
+    TFlatHashTable(const TFlatHashTable&) = default;
+
+    TFlatHashTable& operator=(const TFlatHashTable& Other)
+    {
+        // 원소가 대입 불가(const 키)일 수 있으므로 복사 생성 후 교체
+        if (this != &Other)
+        {
+            TFlatHashTable Copy(Other);
+            swap(Copy);
+        }
+        return *this;
+    }
+
+    TFlatHashTable(TFlatHashTable&& Other) noexcept
+        : Elements(std::move(Other.Elements))
+        , Buckets(std::move(Other.Buckets))
+        , Shift(Other.Shift)
+    {
+        Other.Reset();
+    }
+
+    TFlatHashTable& operator=(TFlatHashTable&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Elements = std::move(Other.Elements);
+            Buckets = std::move(Other.Buckets);
+            Shift = Other.Shift;
+            Other.Reset();
+        }
+        return *this;
+    }
+
+    TFlatHashTable(std::initializer_list<ElementType> InitList)
+    {
+        insert(InitList.begin(), InitList.end());
+    }
+
+    template<typename InputIt>
+    TFlatHashTable(InputIt First, InputIt Last)
+    {
+        insert(First, Last);
+    }
+
+    /** 순회 (삽입 순서, 삭제가 있으면 마지막 원소가 빈 자리로 이동) */
+    iterator begin() { return Elements.begin(); }
+    iterator end() { return Elements.end(); }
+    const_iterator begin() const { return Elements.begin(); }
+    const_iterator end() const { return Elements.end(); }
+    const_iterator cbegin() const { return Elements.cbegin(); }
+    const_iterator cend() const { return Elements.cend(); }
+
+    SIZE_T size() const { return Elements.size(); }
+    bool empty() const { return Elements.empty(); }
+
+    /** 원소만 비우고 버킷 배열 크기는 유지 (메모리까지 돌려받으려면 새 객체를 대입) */
+    void clear()
+    {
+        Elements.clear();
+        std::fill(Buckets.begin(), Buckets.end(), FBucket{});
+    }
+
+    void reserve(SIZE_T Count)
+    {
+        Elements.reserve(Count);
+        const SIZE_T Required = BucketCountFor(Count);
+        if (Required > Buckets.size())
+        {
+            Rehash(Required);
+        }
+    }
+
+    void swap(TFlatHashTable& Other) noexcept
+    {
+        Elements.swap(Other.Elements);
+        Buckets.swap(Other.Buckets);
+        std::swap(Shift, Other.Shift);
+    }
+
+    /** 검색 */
+    iterator find(const KeyType& Key)
+    {
+        const int32 Index = FindElementIndex(Key);
+        return Index != InvalidIndex ? Elements.begin() + Index : Elements.end();
+    }
+
+    const_iterator find(const KeyType& Key) const
+    {
+        const int32 Index = FindElementIndex(Key);
+        return Index != InvalidIndex ? Elements.cbegin() + Index : Elements.cend();
+    }
+
+    SIZE_T count(const KeyType& Key) const
+    {
+        return FindElementIndex(Key) != InvalidIndex ? 1 : 0;
+    }
+
+    bool contains(const KeyType& Key) const
+    {
+        return FindElementIndex(Key) != InvalidIndex;
+    }
+
+    /** 삽입 (이미 있으면 기존 원소를 가리키고 second == false) */
+    std::pair<iterator, bool> insert(const ElementType& Element)
+    {
+        return InsertElement(KeyFuncs::GetKey(Element), [&]() { Elements.push_back(Element); });
+    }
+
+    std::pair<iterator, bool> insert(ElementType&& Element)
+    {
+        return InsertElement(KeyFuncs::GetKey(Element), [&]() { Elements.push_back(std::move(Element)); });
+    }
+
+    template<typename InputIt>
+    void insert(InputIt First, InputIt Last)
+    {
+        for (; First != Last; ++First)
+        {
+            insert(*First);
+        }
+    }
+
+    void insert(std::initializer_list<ElementType> InitList)
+    {
+        insert(InitList.begin(), InitList.end());
+    }
+
+    template<typename... ArgTypes>
+    std::pair<iterator, bool> emplace(ArgTypes&&... Args)
+    {
+        ElementType Element(std::forward<ArgTypes>(Args)...);
+        return insert(std::move(Element));
+    }
+
+    /** 제거 */
+    SIZE_T erase(const KeyType& Key)
+    {
+        uint32 BucketIndex;
+        if (!FindBucket(Key, BucketIndex))
+        {
+            return 0;
+        }
+        EraseAtBucket(BucketIndex);
+        return 1;
+    }
+
+    iterator erase(const_iterator It)
+    {
+        const SIZE_T ElementIndex = static_cast<SIZE_T>(It - Elements.cbegin());
+        uint32 BucketIndex;
+        if (FindBucket(KeyFuncs::GetKey(*It), BucketIndex))
+        {
+            EraseAtBucket(BucketIndex);
+        }
+        return Elements.begin() + ElementIndex;
+    }
+
+    bool operator==(const TFlatHashTable& Other) const
+    {
+        if (size() != Other.size())
+        {
+            return false;
+        }
+        for (const ElementType& Element : Elements)
+        {
+            const int32 Index = Other.FindElementIndex(KeyFuncs::GetKey(Element));
+            if (Index == InvalidIndex || !(Other.Elements[Index] == Element))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool operator!=(const TFlatHashTable& Other) const
+    {
+        return !(*this == Other);
+    }
+
+protected:
+    static constexpr int32 InvalidIndex = -1;
+
+    /** 키에 해당하는 원소 인덱스 (없으면 InvalidIndex) */
+    int32 FindElementIndex(const KeyType& Key) const
+    {
+        uint32 BucketIndex;
+        return FindBucket(Key, BucketIndex) ? static_cast<int32>(Buckets[BucketIndex].ElementIndex) : InvalidIndex;
+    }
+
+    /** 키가 없을 때만 MakeElement로 원소를 만들어 넣음 (맵의 try_emplace/operator[]용) */
+    template<typename MakeFunc>
+    std::pair<iterator, bool> InsertElement(const KeyType& Key, MakeFunc&& MakeElement)
+    {
+        // MakeElement가 키를 담은 원소를 옮길 수 있으므로 해시를 먼저 구해둠
+        const uint64 Hash = HashKey(Key);
+        uint32 BucketIndex;
+        if (FindBucket(Key, Hash, BucketIndex))
+        {
+            return { Elements.begin() + Buckets[BucketIndex].ElementIndex, false };
+        }
+
+        if (Elements.size() + 1 > MaxElementsFor(Buckets.size()))
+        {
+            Rehash(Buckets.empty() ? MinBucketCount : Buckets.size() * 2);
+        }
+
+        const uint32 NewIndex = static_cast<uint32>(Elements.size());
+        MakeElement();
+        PlaceNewBucket(Hash, NewIndex);
+        return { Elements.begin() + NewIndex, true };
+    }
+
+    std::vector<ElementType> Elements;
+
+private:
+    static uint64 HashKey(const KeyType& Key)
+    {
+        // std::hash 결과를 섞어서 사용 (포인터/정수 키는 하위 비트가 고르지 않음)
+        uint64 Hash = static_cast<uint64>(hasher()(Key));
+        Hash ^= Hash >> 33;
+        Hash *= 0xff51afd7ed558ccdull;
+        Hash ^= Hash >> 33;
+        Hash *= 0xc4ceb9fe1a85ec53ull;
+        Hash ^= Hash >> 33;
+        return Hash;
+    }
+
+    static SIZE_T MaxElementsFor(SIZE_T BucketCount)
+    {
+        // 최대 적재율 0.8
+        return BucketCount * 4 / 5;
+    }
+
+    static SIZE_T BucketCountFor(SIZE_T Count)
+    {
+        SIZE_T BucketCount = MinBucketCount;
+        while (MaxElementsFor(BucketCount) < Count)
+        {
+            BucketCount *= 2;
+        }
+        return BucketCount;
+    }
+
+    uint32 HomeBucket(uint64 Hash) const
+    {
+        // 상위 비트로 버킷 선택, 하위 8비트는 지문으로 사용
+        return static_cast<uint32>(Hash >> Shift);
+    }
+
+    uint32 NextBucket(uint32 BucketIndex) const
+    {
+        return (BucketIndex + 1) & static_cast<uint32>(Buckets.size() - 1);
+    }
+
+    bool FindBucket(const KeyType& Key, uint32& OutBucketIndex) const
+    {
+        return !Elements.empty() && FindBucket(Key, HashKey(Key), OutBucketIndex);
+    }
+
+    bool FindBucket(const KeyType& Key, uint64 Hash, uint32& OutBucketIndex) const
+    {
+        if (Elements.empty())
+        {
+            return false;
+        }
+
+        uint32 DistAndFingerprint = DistInc | static_cast<uint32>(Hash & FingerprintMask);
+        uint32 BucketIndex = HomeBucket(Hash);
+
+        // Robin Hood 불변식: 내 거리보다 짧은 버킷을 만나면 그 뒤에는 내 키가 없음
+        while (true)
+        {
+            const FBucket& Bucket = Buckets[BucketIndex];
+            if (Bucket.DistAndFingerprint == DistAndFingerprint &&
+                key_equal()(KeyFuncs::GetKey(Elements[Bucket.ElementIndex]), Key))
+            {
+                OutBucketIndex = BucketIndex;
+                return true;
+            }
+            if (Bucket.DistAndFingerprint < DistAndFingerprint)
+            {
+                return false;
+            }
+            DistAndFingerprint += DistInc;
+            BucketIndex = NextBucket(BucketIndex);
+        }
+    }
+
+    void PlaceNewBucket(uint64 Hash, uint32 ElementIndex)
+    {
+        FBucket Entry{ DistInc | static_cast<uint32>(Hash & FingerprintMask), ElementIndex };
+        uint32 BucketIndex = HomeBucket(Hash);
+
+        // 나보다 멀리서 온 버킷은 건너뛰고, 가까운 버킷 자리를 빼앗아 나머지를 한 칸씩 밀어냄
+        while (Entry.DistAndFingerprint <= Buckets[BucketIndex].DistAndFingerprint)
+        {
+            Entry.DistAndFingerprint += DistInc;
+            BucketIndex = NextBucket(BucketIndex);
+        }
+        while (Buckets[BucketIndex].DistAndFingerprint != 0)
+        {
+            std::swap(Entry, Buckets[BucketIndex]);
+            Entry.DistAndFingerprint += DistInc;
+            BucketIndex = NextBucket(BucketIndex);
+        }
+        Buckets[BucketIndex] = Entry;
+    }
+
+    void EraseAtBucket(uint32 BucketIndex)
+    {
+        const uint32 ElementIndex = Buckets[BucketIndex].ElementIndex;
+
+        // backward shift: 뒤따르는 버킷 중 제자리가 아닌 것들을 한 칸씩 당김
+        uint32 Next = NextBucket(BucketIndex);
+        while (Buckets[Next].DistAndFingerprint >= DistInc * 2)
+        {
+            Buckets[BucketIndex] = { Buckets[Next].DistAndFingerprint - DistInc, Buckets[Next].ElementIndex };
+            BucketIndex = Next;
+            Next = NextBucket(Next);
+        }
+        Buckets[BucketIndex] = {};
+
+        // 마지막 원소를 빈 자리로 옮기고, 그 원소를 가리키던 버킷의 인덱스를 고침
+        const uint32 LastIndex = static_cast<uint32>(Elements.size() - 1);
+        if (ElementIndex != LastIndex)
+        {
+            uint32 MovedBucket = HomeBucket(HashKey(KeyFuncs::GetKey(Elements[LastIndex])));
+            while (Buckets[MovedBucket].ElementIndex != LastIndex || Buckets[MovedBucket].DistAndFingerprint == 0)
+            {
+                MovedBucket = NextBucket(MovedBucket);
+            }
+            Buckets[MovedBucket].ElementIndex = ElementIndex;
+            // 키가 const라 대입할 수 없으므로 빈 자리를 파괴하고 그 위에 이동 생성
+            std::destroy_at(&Elements[ElementIndex]);
+            std::construct_at(&Elements[ElementIndex], std::move(Elements[LastIndex]));
+        }
+        Elements.pop_back();
+    }
+
+    void Rehash(SIZE_T NewBucketCount)
+    {
+        Buckets.assign(NewBucketCount, FBucket{});
+        uint32 Log2 = 0;
+        while ((SIZE_T(1) << Log2) < NewBucketCount)
+        {
+            ++Log2;
+        }
+        Shift = 64 - Log2;
+
+        for (uint32 Index = 0; Index < static_cast<uint32>(Elements.size()); ++Index)
+        {
+            PlaceNewBucket(HashKey(KeyFuncs::GetKey(Elements[Index])), Index);
+        }
+    }
+
+    void Reset()
+    {
+        Elements.clear();
+        Buckets.clear();
+        Shift = 64;
+    }
+
+    std::vector<FBucket> Buckets;
+    uint32 Shift = 64;
+};
+
+/** TMap 원소(TPair<const KeyType, ValueType>)에서 키를 꺼내는 정책 */
+template<typename KeyType, typename ValueType>
+struct TMapKeyFuncs
+{
+    static const KeyType& GetKey(const std::pair<const KeyType, ValueType>& Element) { return Element.first; }
+};
+
+/** TSet 원소 자체가 키 */
+template<typename KeyType>
+struct TSetKeyFuncs
+{
+    static const KeyType& GetKey(const KeyType& Element) { return Element; }
+};
@@ -68,12 +68,12 @@ using TPair = std::pair<T1, T2>;
 template<typename T, SIZE_T N>
 using TStaticArray = std::array<T, N>;
 
-/** TArray 구현 */
-template<typename T>
-class TArray : public std::vector<T>
+/** TArray 구현 (AllocatorType: 프레임 아레나 등 STL 호환 할당기, 기본은 전역 힙) */
+template<typename T, typename AllocatorType = std::allocator<T>>
+class TArray : public std::vector<T, AllocatorType>
 {
 public:
-    using std::vector<T>::vector; /** 생성자 상속 */
+    using std::vector<T, AllocatorType>::vector; /** 생성자 상속 */
 
     /** 요소 추가 */
     int32 Add(const T& Item)
@@ -101,7 +101,7 @@ public:
     }
 
     /** 배열 병합 */
-    void Append(const TArray<T>& Other)
+    void Append(const TArray& Other)
     {
         this->insert(this->end(), Other.begin(), Other.end());
     }
@@ -264,12 +264,16 @@ public:
     }
 };
 
-/** TSet - 해시 기반 집합 */
+#include "HashTable.h"
+
+/** TSet - 해시 기반 집합 (오픈 어드레싱, HashTable.h 참고) */
 template<typename T>
-class TSet : public std::unordered_set<T>
+class TSet : public TFlatHashTable<T, T, TSetKeyFuncs<T>, true>
 {
+    using Super = TFlatHashTable<T, T, TSetKeyFuncs<T>, true>;
+
 public:
-    using std::unordered_set<T>::unordered_set;
+    using Super::Super;
 
     /** 요소 추가 */
     void Add(const T& Item)
@@ -302,7 +306,7 @@ public:
     /** 검색 */
     bool Contains(const T& Item) const
     {
-        return this->find(Item) != this->end();
+        return this->contains(Item);
     }
 
     /** 집합 연산 */
@@ -345,19 +349,176 @@ public:
     /** 배열로 변환 */
     TArray<T> Array() const
     {
-        TArray<T> Result;
-        Result.Reserve(this->size());
-        for (const auto& Item : *this)
+        return TArray<T>(this->begin(), this->end());
+    }
+};
+
+/**
+ * TMap - 해시 기반 연관 컨테이너 (오픈 어드레싱, HashTable.h 참고)
+ * 원소는 TPair<const KeyType, ValueType>이고 std::unordered_map과 같은 인터페이스(find/insert/emplace/operator[]/erase)를 제공
+ * 키는 const라 반복자로 바꿀 수 없음 (키를 바꾸면 버킷 위치가 어긋나므로 Remove 후 다시 Add)
+ * 삽입/삭제 시 다른 값의 주소가 바뀔 수 있으므로 Find() 포인터는 다음 삽입/삭제 전까지만 사용
+ */
+template<typename KeyType, typename ValueType>
+class TMap : public TFlatHashTable<KeyType, std::pair<const KeyType, ValueType>, TMapKeyFuncs<KeyType, ValueType>, false>
+{
+    using Super = TFlatHashTable<KeyType, std::pair<const KeyType, ValueType>, TMapKeyFuncs<KeyType, ValueType>, false>;
+
+public:
+    using mapped_type = ValueType;
+    using typename Super::iterator;
+    using typename Super::const_iterator;
+    using Super::Super;
+
+    /** std::unordered_map 호환 */
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const KeyType& Key, Args&&... args)
+    {
+        return this->InsertElement(Key, [&]()
         {
-            Result.Add(Item);
+            this->Elements.emplace_back(std::piecewise_construct, std::forward_as_tuple(Key), std::forward_as_tuple(std::forward<Args>(args)...));
+        });
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(KeyType&& Key, Args&&... args)
+    {
+        return this->InsertElement(Key, [&]()
+        {
+            this->Elements.emplace_back(std::piecewise_construct, std::forward_as_tuple(std::move(Key)), std::forward_as_tuple(std::forward<Args>(args)...));
+        });
+    }
+
+    template<typename MappedType>
+    std::pair<iterator, bool> insert_or_assign(const KeyType& Key, MappedType&& Value)
+    {
+        auto Result = try_emplace(Key, std::forward<MappedType>(Value));
+        if (!Result.second)
+        {
+            Result.first->second = std::forward<MappedType>(Value);
         }
         return Result;
     }
+
+    ValueType& operator[](const KeyType& Key)
+    {
+        return try_emplace(Key).first->second;
+    }
+
+    ValueType& operator[](KeyType&& Key)
+    {
+        return try_emplace(std::move(Key)).first->second;
+    }
+
+    ValueType& at(const KeyType& Key)
+    {
+        auto it = this->find(Key);
+        if (it == this->end())
+        {
+            throw std::out_of_range("TMap::at - key not found");
+        }
+        return it->second;
+    }
+
+    const ValueType& at(const KeyType& Key) const
+    {
+        auto it = this->find(Key);
+        if (it == this->end())
+        {
+            throw std::out_of_range("TMap::at - key not found");
+        }
+        return it->second;
+    }
+
+    /** 요소 추가/수정 */
+    void Add(const KeyType& Key, const ValueType& Value)
+    {
+        (*this)[Key] = Value;
+    }
+
+    template<typename... Args>
+    void Emplace(const KeyType& Key, Args&&... args)
+    {
+        this->emplace(Key, ValueType(std::forward<Args>(args)...));
+    }
+
+    /** 제거 */
+    bool Remove(const KeyType& Key)
+    {
+        return this->erase(Key) > 0;
+    }
+
+    /** 크기 관련 */
+    int32 Num() const
+    {
+        return static_cast<int32>(this->size());
+    }
+
+    bool IsEmpty() const
+    {
+        return this->empty();
+    }
+
+    void Empty()
+    {
+        this->clear();
+    }
+
+    /** 검색 */
+    bool Contains(const KeyType& Key) const
+    {
+        return this->contains(Key);
+    }
+
+    ValueType* Find(const KeyType& Key)
+    {
+        const int32 Index = this->FindElementIndex(Key);
+        return Index != Super::InvalidIndex ? &this->Elements[Index].second : nullptr;
+    }
+
+    const ValueType* Find(const KeyType& Key) const
+    {
+        const int32 Index = this->FindElementIndex(Key);
+        return Index != Super::InvalidIndex ? &this->Elements[Index].second : nullptr;
+    }
+
+    /** 찾거나 기본값 반환 */
+    ValueType FindRef(const KeyType& Key) const
+    {
+        const ValueType* Found = Find(Key);
+        return Found ? *Found : ValueType{};
+    }
+
+    /** 키/값 배열 반환 */
+    TArray<KeyType> GetKeys() const
+    {
+        TArray<KeyType> Keys;
+        Keys.Reserve(this->size());
+        for (const auto& Pair : *this)
+        {
+            Keys.Add(Pair.first);
+        }
+        return Keys;
+    }
+
+    TArray<ValueType> GetValues() const
+    {
+        TArray<ValueType> Values;
+        Values.Reserve(this->size());
+        for (const auto& Pair : *this)
+        {
+            Values.Add(Pair.second);
+        }
+        return Values;
+    }
 };
 
-/** TMap - 해시 기반 연관 컨테이너 */
+/**
+ * TStableMap - 노드 기반 해시 맵 (std::unordered_map 래퍼)
+ * 삽입/삭제 후에도 값의 주소가 유지됨. Find() 결과나 값 포인터를 다른 삽입 이후까지 들고 있어야 할 때만 사용
+ */
 template<typename KeyType, typename ValueType>
-class TMap : public std::unordered_map<KeyType, ValueType>
+class TStableMap : public std::unordered_map<KeyType, ValueType>
 {
 public:
     using std::unordered_map<KeyType, ValueType>::unordered_map;
@@ -725,6 +886,39 @@ public:
 #define TPriorityQueue(T) TQueue<T, EQueueMode::Priority>
 #define TPriorityQueueWithCompare(T, Compare) TQueue<T, EQueueMode::Priority, Compare>
 
+/** TFunctionRef - 호출 가능한 객체에 대한 비소유 참조 (std::function과 달리 할당 없음)
+ *  참조 대상은 호출하는 동안만 살아있으면 되므로 함수 인자로만 사용할 것 */
+template<typename FuncType>
+class TFunctionRef;
+
+template<typename RetType, typename... ParamTypes>
+class TFunctionRef<RetType(ParamTypes...)>
+{
+public:
+    template<typename FunctorType,
+        typename = std::enable_if_t<!std::is_same_v<std::decay_t<FunctorType>, TFunctionRef>>>
+    TFunctionRef(FunctorType&& Functor)
+        : Callable(const_cast<void*>(static_cast<const void*>(std::addressof(Functor))))
+        , Invoker(&Invoke<std::remove_reference_t<FunctorType>>)
+    {
+    }
+
+    RetType operator()(ParamTypes... Params) const
+    {
+        return Invoker(Callable, std::forward<ParamTypes>(Params)...);
+    }
+
+private:
+    template<typename FunctorType>
+    static RetType Invoke(void* InCallable, ParamTypes... Params)
+    {
+        return (*static_cast<FunctorType*>(InCallable))(std::forward<ParamTypes>(Params)...);
+    }
+
+    void* Callable;
+    RetType (*Invoker)(void*, ParamTypes...);
+};
+
 
 // ANSI 문자열을 UTF-8로 변환하는 유틸리티 함수
 // TODO (동민, 한글) - 혹시나 프로젝트 설정의 /utf-8 옵션을 끈다면 이 설정이 무의미해집니다.
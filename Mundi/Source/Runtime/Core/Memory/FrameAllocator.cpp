@@ -0,0 +1,148 @@
+﻿#include "pch.h"
+#include "FrameAllocator.h"
+#include "MemoryManager.h"
+#include <algorithm>
+
+namespace
+{
+	// 시작 버퍼 크기 (버퍼당), 넘치면 리셋 때 최대 사용량의 1.25배를 2의 거듭제곱으로 올려 재할당
+	constexpr SIZE_T InitialFrameBufferBytes = 1024 * 1024;
+	// 넘친 요청을 받는 추가 블록의 최소 크기
+	constexpr SIZE_T OverflowBlockBytes = 256 * 1024;
+	constexpr SIZE_T FrameBufferAlignment = 64;
+
+	SIZE_T AlignOffset(SIZE_T Value, SIZE_T Alignment)
+	{
+		return (Value + Alignment - 1) & ~(Alignment - 1);
+	}
+
+	SIZE_T RoundUpPow2(SIZE_T Value)
+	{
+		SIZE_T Result = 1;
+		while (Result < Value)
+		{
+			Result <<= 1;
+		}
+		return Result;
+	}
+}
+
+FFrameAllocator::FFrameAllocator()
+{
+	for (FBuffer& Buffer : Buffers)
+	{
+		Buffer.Memory = static_cast<uint8*>(FMemoryManager::Allocate(InitialFrameBufferBytes, FrameBufferAlignment));
+		Buffer.Capacity = Buffer.Memory ? InitialFrameBufferBytes : 0;
+	}
+}
+
+FFrameAllocator::~FFrameAllocator()
+{
+	for (FBuffer& Buffer : Buffers)
+	{
+		ResetBuffer(Buffer, 0);
+		FMemoryManager::Deallocate(Buffer.Memory);
+		Buffer.Memory = nullptr;
+		Buffer.Capacity = 0;
+	}
+}
+
+void FFrameAllocator::BeginFrame()
+{
+	// 이번 프레임이 끝나는 버퍼의 사용량 기록
+	FBuffer& Finished = Buffers[CurrentIndex.load(std::memory_order_relaxed)];
+	{
+		std::lock_guard<std::mutex> Lock(OverflowMutex);
+		LastFrameBytes = Finished.Offset.load(std::memory_order_relaxed) + Finished.OverflowBytes;
+		LastFrameOverflowCount = static_cast<uint32>(Finished.OverflowBlocks.Num());
+	}
+	HighWaterMark = std::max(HighWaterMark, LastFrameBytes);
+
+	// 두 프레임 전 버퍼를 리셋한 뒤 현재 버퍼로 전환
+	const uint32 NextIndex = CurrentIndex.load(std::memory_order_relaxed) ^ 1u;
+	ResetBuffer(Buffers[NextIndex], HighWaterMark);
+	CurrentIndex.store(NextIndex, std::memory_order_release);
+	FrameNumber.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void FFrameAllocator::ResetBuffer(FBuffer& Buffer, SIZE_T UsedBytes)
+{
+	std::lock_guard<std::mutex> Lock(OverflowMutex);
+
+	const bool bOverflowed = !Buffer.OverflowBlocks.IsEmpty();
+	for (void* Block : Buffer.OverflowBlocks)
+	{
+		FMemoryManager::Deallocate(Block);
+	}
+	Buffer.OverflowBlocks.Empty();
+	Buffer.OverflowCursor = nullptr;
+	Buffer.OverflowEnd = nullptr;
+	Buffer.OverflowBytes = 0;
+	Buffer.Offset.store(0, std::memory_order_relaxed);
+
+	// 이 버퍼가 넘친 적이 있으면 최대 사용량에 맞춰 키워서 다음부터는 추가 블록 없이 처리
+	if (bOverflowed && UsedBytes > Buffer.Capacity)
+	{
+		const SIZE_T NewCapacity = RoundUpPow2(UsedBytes + UsedBytes / 4);
+		if (uint8* NewMemory = static_cast<uint8*>(FMemoryManager::Allocate(NewCapacity, FrameBufferAlignment)))
+		{
+			FMemoryManager::Deallocate(Buffer.Memory);
+			Buffer.Memory = NewMemory;
+			Buffer.Capacity = NewCapacity;
+		}
+	}
+}
+
+void* FFrameAllocator::Allocate(SIZE_T Size, SIZE_T Alignment)
+{
+	if (Size == 0)
+	{
+		Size = 1;
+	}
+	Alignment = std::max<SIZE_T>(Alignment, alignof(std::max_align_t));
+
+	FBuffer& Buffer = Buffers[CurrentIndex.load(std::memory_order_acquire)];
+
+	// 주 버퍼: CAS로 오프셋만 밀어서 락 없이 할당
+	const SIZE_T Base = reinterpret_cast<SIZE_T>(Buffer.Memory);
+	SIZE_T Current = Buffer.Offset.load(std::memory_order_relaxed);
+	while (true)
+	{
+		const SIZE_T Aligned = AlignOffset(Base + Current, Alignment) - Base;
+		const SIZE_T NewOffset = Aligned + Size;
+		if (NewOffset > Buffer.Capacity)
+		{
+			break;
+		}
+		if (Buffer.Offset.compare_exchange_weak(Current, NewOffset, std::memory_order_relaxed))
+		{
+			return Buffer.Memory + Aligned;
+		}
+	}
+
+	return AllocateOverflow(Buffer, Size, Alignment);
+}
+
+void* FFrameAllocator::AllocateOverflow(FBuffer& Buffer, SIZE_T Size, SIZE_T Alignment)
+{
+	std::lock_guard<std::mutex> Lock(OverflowMutex);
+
+	uint8* Aligned = reinterpret_cast<uint8*>(AlignOffset(reinterpret_cast<SIZE_T>(Buffer.OverflowCursor), Alignment));
+	if (!Buffer.OverflowCursor || Aligned + Size > Buffer.OverflowEnd)
+	{
+		const SIZE_T BlockBytes = std::max(OverflowBlockBytes, Size + Alignment);
+		uint8* Block = static_cast<uint8*>(FMemoryManager::Allocate(BlockBytes, FrameBufferAlignment));
+		if (!Block)
+		{
+			return nullptr;
+		}
+		Buffer.OverflowBlocks.Add(Block);
+		Buffer.OverflowCursor = Block;
+		Buffer.OverflowEnd = Block + BlockBytes;
+		Aligned = reinterpret_cast<uint8*>(AlignOffset(reinterpret_cast<SIZE_T>(Block), Alignment));
+	}
+
+	Buffer.OverflowBytes += static_cast<SIZE_T>(Aligned + Size - Buffer.OverflowCursor);
+	Buffer.OverflowCursor = Aligned + Size;
+	return Aligned;
+}
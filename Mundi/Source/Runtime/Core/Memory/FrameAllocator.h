@@ -0,0 +1,99 @@
+﻿#pragma once
+#include <atomic>
+#include <mutex>
+#include "UEContainer.h"
+
+/**
+ * @brief 프레임 단위 선형 아레나 (더블 버퍼)
+ * - 할당은 오프셋 증가뿐이고 개별 해제는 없음. BeginFrame에서 두 프레임 전에 쓰던 버퍼를 통째로 리셋
+ * - 프레임 N에 할당한 메모리는 프레임 N+1이 끝날 때까지 유효 (비동기 작업이 한 프레임 늦게 읽는 경우 대비)
+ * - 버퍼가 모자라면 FMemoryManager에서 추가 블록을 받아 이어 쓰고, 다음 리셋 때 최대 사용량에 맞춰 버퍼를 키움
+ * - Allocate는 여러 스레드에서 동시에 호출해도 안전, BeginFrame은 게임 스레드에서만 호출
+ */
+class FFrameAllocator
+{
+public:
+	static FFrameAllocator& Get()
+	{
+		static FFrameAllocator Instance;
+		return Instance;
+	}
+
+	// 프레임 시작 (메인 루프에서 Tick 전에 호출)
+	void BeginFrame();
+
+	void* Allocate(SIZE_T Size, SIZE_T Alignment);
+
+	uint64 GetFrameNumber() const { return FrameNumber.load(std::memory_order_acquire); }
+
+	// 직전 프레임 사용량 / 지금까지 한 프레임 최대 사용량 (출시 빌드 아레나 크기 결정용)
+	SIZE_T GetLastFrameBytes() const { return LastFrameBytes; }
+	SIZE_T GetHighWaterMark() const { return HighWaterMark; }
+	SIZE_T GetCapacity() const { return Buffers[CurrentIndex.load(std::memory_order_acquire)].Capacity; }
+	uint32 GetLastFrameOverflowCount() const { return LastFrameOverflowCount; }
+
+private:
+	FFrameAllocator();
+	~FFrameAllocator();
+	FFrameAllocator(const FFrameAllocator&) = delete;
+	FFrameAllocator& operator=(const FFrameAllocator&) = delete;
+
+	struct FBuffer
+	{
+		uint8* Memory = nullptr;
+		SIZE_T Capacity = 0;
+		std::atomic<SIZE_T> Offset{ 0 };
+
+		// 주 버퍼를 넘친 요청용 추가 블록 (OverflowMutex 보호)
+		TArray<void*> OverflowBlocks;
+		uint8* OverflowCursor = nullptr;
+		uint8* OverflowEnd = nullptr;
+		SIZE_T OverflowBytes = 0;
+	};
+
+	void* AllocateOverflow(FBuffer& Buffer, SIZE_T Size, SIZE_T Alignment);
+	void ResetBuffer(FBuffer& Buffer, SIZE_T UsedBytes);
+
+	FBuffer Buffers[2];
+	std::atomic<uint32> CurrentIndex{ 0 };
+	std::atomic<uint64> FrameNumber{ 0 };
+	std::mutex OverflowMutex;
+
+	// Stats
+	SIZE_T LastFrameBytes = 0;
+	SIZE_T HighWaterMark = 0;
+	uint32 LastFrameOverflowCount = 0;
+};
+
+/**
+ * @brief FFrameAllocator를 쓰는 STL 호환 할당기
+ * - deallocate는 아무것도 하지 않음. 원소 소멸자가 리셋된 메모리를 건드리지 않도록 자명하게 소멸 가능한 타입만 허용
+ * - 컨테이너 자체도 두 프레임 안에 버려야 함 (멤버로 오래 들고 있지 말 것)
+ */
+template<typename T>
+class TFrameAllocator
+{
+public:
+	using value_type = T;
+
+	TFrameAllocator() noexcept = default;
+	template<typename U>
+	TFrameAllocator(const TFrameAllocator<U>&) noexcept {}
+
+	T* allocate(SIZE_T Count)
+	{
+		static_assert(std::is_trivially_destructible_v<T>, "TFrameAllocator elements must be trivially destructible");
+		return static_cast<T*>(FFrameAllocator::Get().Allocate(Count * sizeof(T), alignof(T)));
+	}
+
+	void deallocate(T*, SIZE_T) noexcept {}
+
+	template<typename U>
+	bool operator==(const TFrameAllocator<U>&) const noexcept { return true; }
+	template<typename U>
+	bool operator!=(const TFrameAllocator<U>&) const noexcept { return false; }
+};
+
+/** 프레임 아레나에 올라가는 임시 배열 (프레임마다 버리는 수집 목록용) */
+template<typename T>
+using TFrameArray = TArray<T, TFrameAllocator<T>>;
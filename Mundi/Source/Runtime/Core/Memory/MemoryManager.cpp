@@ -3,28 +3,369 @@
 #include <cstddef>
 #include <malloc.h>
 #include <algorithm>
+#include <mutex>
 
-uint32 FMemoryManager::TotalAllocationBytes = 0;
-uint32 FMemoryManager::TotalAllocationCount = 0;
+std::atomic<uint64> FMemoryManager::TotalAllocationBytes{ 0 };
+std::atomic<uint32> FMemoryManager::TotalAllocationCount{ 0 };
 
-void* FMemoryManager::Allocate(SIZE_T Size, SIZE_T Alignment)
+namespace
 {
-	SIZE_T TotalSize = Size + sizeof(SIZE_T);
-	SIZE_T FinalAlignment = std::max(Alignment, alignof(SIZE_T));
+	// 모든 블록 앞에 붙는 헤더 (16바이트라 사용자 포인터의 16 정렬이 유지됨)
+	struct alignas(16) FAllocHeader
+	{
+		uint64 Size;		// 요청 크기
+		uint32 SizeClass;	// LargeSizeClass면 _aligned_malloc 직접 할당
+		uint32 Offset;		// 큰 블록: Raw 포인터 ~ 사용자 포인터 거리
+	};
+	static_assert(sizeof(FAllocHeader) == 16, "FAllocHeader must stay 16 bytes");
+
+	constexpr SIZE_T HeaderSize = sizeof(FAllocHeader);
+	constexpr SIZE_T SmallAlignment = 16;
+	constexpr uint32 LargeSizeClass = 0xFFFFFFFFu;
+
+	// 블록 크기 (헤더 포함). 구간마다 4단계씩 늘려 내부 단편화를 최대 25% 안쪽으로 유지
+	constexpr SIZE_T SizeClassBytes[] =
+	{
+		16, 32, 48, 64, 80, 96, 112, 128,
+		160, 192, 224, 256, 320, 384, 448, 512,
+		640, 768, 896, 1024, 1280, 1536, 1792, 2048,
+		2560, 3072, 3584, 4096, 5120, 6144, 7168, 8192,
+		10240, 12288, 14336, 16384, 20480, 24576, 28672, 32768
+	};
+	constexpr int32 NumSizeClasses = static_cast<int32>(sizeof(SizeClassBytes) / sizeof(SizeClassBytes[0]));
+	constexpr SIZE_T MaxSmallBlockBytes = SizeClassBytes[NumSizeClasses - 1];
+
+	// (블록 크기 / 16) -> 사이즈 클래스 조회 테이블
+	struct FSizeClassTable
+	{
+		uint8 Index[MaxSmallBlockBytes / SmallAlignment + 1] = {};
+
+		constexpr FSizeClassTable()
+		{
+			int32 Class = 0;
+			for (SIZE_T Slot = 0; Slot <= MaxSmallBlockBytes / SmallAlignment; ++Slot)
+			{
+				while (SizeClassBytes[Class] < Slot * SmallAlignment)
+				{
+					++Class;
+				}
+				Index[Slot] = static_cast<uint8>(Class);
+			}
+		}
+	};
+	constexpr FSizeClassTable SizeClassTable;
 
+	// 전역 풀이 OS에서 한 번에 받아오는 청크 크기 (큰 클래스는 최소 8블록)
+	constexpr SIZE_T ChunkBytes = 64 * 1024;
+	// 스레드 캐시 한도 (클래스별 바이트), 넘치면 절반을 전역 풀로 반납
+	constexpr SIZE_T ThreadCacheBytesPerClass = 64 * 1024;
+
+	SIZE_T GetChunkBytes(int32 Class)
+	{
+		return std::max(ChunkBytes, SizeClassBytes[Class] * 8);
+	}
+
+	uint32 GetThreadCacheLimit(int32 Class)
+	{
+		return static_cast<uint32>(std::max<SIZE_T>(4, ThreadCacheBytesPerClass / SizeClassBytes[Class]));
+	}
+
+	void* SystemAlloc(SIZE_T Size, SIZE_T Alignment)
+	{
 #if defined(_MSC_VER) && defined(_DEBUG)
-	void* Raw = _aligned_malloc_dbg(TotalSize, FinalAlignment, nullptr, 0);
+		return _aligned_malloc_dbg(Size, Alignment, nullptr, 0);
 #else
-	void* Raw = _aligned_malloc(TotalSize, FinalAlignment);
+		return _aligned_malloc(Size, Alignment);
 #endif
-	if (!Raw)
-		return nullptr;
+	}
+
+	void SystemFree(void* Ptr)
+	{
+#if defined(_MSC_VER) && defined(_DEBUG)
+		_aligned_free_dbg(Ptr);
+#else
+		_aligned_free(Ptr);
+#endif
+	}
+
+	struct FFreeBlock
+	{
+		FFreeBlock* Next;
+	};
+
+	// 사이즈 클래스별 통계 (스레드 간 false sharing 방지용 캐시라인 정렬)
+	struct alignas(64) FSizeClassStats
+	{
+		std::atomic<uint32> CurrentBlocks{ 0 };
+		std::atomic<uint32> PeakBlocks{ 0 };
+		std::atomic<uint64> TotalAllocs{ 0 };
+		std::atomic<uint64> ReservedBytes{ 0 };
+	};
+
+	struct FLargeStats
+	{
+		std::atomic<uint64> CurrentBytes{ 0 };
+		std::atomic<uint64> PeakBytes{ 0 };
+		std::atomic<uint32> CurrentBlocks{ 0 };
+		std::atomic<uint64> TotalAllocs{ 0 };
+	};
+
+	template<typename T>
+	void UpdatePeak(std::atomic<T>& Peak, T Value)
+	{
+		T Prev = Peak.load(std::memory_order_relaxed);
+		while (Value > Prev && !Peak.compare_exchange_weak(Prev, Value, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	// 사이즈 클래스 하나의 전역 free list
+	struct FSizeClassPool
+	{
+		std::mutex Mutex;
+		FFreeBlock* FreeList = nullptr;
+		uint32 FreeCount = 0;
+	};
+
+	struct FGlobalPools
+	{
+		FSizeClassPool Pools[NumSizeClasses];
+		FSizeClassStats Stats[NumSizeClasses];
+		FLargeStats Large;
+	};
+
+	// 종료 시점의 정적 소멸 순서와 무관하게 쓰도록 의도적으로 해제하지 않음 (청크도 프로세스 종료 시 회수)
+	FGlobalPools& GetGlobalPools()
+	{
+		static FGlobalPools* Pools = new FGlobalPools();
+		return *Pools;
+	}
+
+	// 전역 풀에서 최대 MaxCount개를 떼어 연결 리스트로 반환 (부족하면 새 청크를 잘라 채움)
+	FFreeBlock* PopBatchFromGlobal(int32 Class, uint32 MaxCount, uint32& OutCount)
+	{
+		FGlobalPools& Global = GetGlobalPools();
+		FSizeClassPool& Pool = Global.Pools[Class];
+		std::lock_guard<std::mutex> Lock(Pool.Mutex);
+
+		if (!Pool.FreeList)
+		{
+			const SIZE_T BlockBytes = SizeClassBytes[Class];
+			const SIZE_T ChunkSize = GetChunkBytes(Class);
+			uint8* Chunk = static_cast<uint8*>(SystemAlloc(ChunkSize, 64));
+			if (!Chunk)
+			{
+				OutCount = 0;
+				return nullptr;
+			}
+			Global.Stats[Class].ReservedBytes.fetch_add(ChunkSize, std::memory_order_relaxed);
+
+			const uint32 NumBlocks = static_cast<uint32>(ChunkSize / BlockBytes);
+			for (uint32 i = NumBlocks; i > 0; --i)
+			{
+				FFreeBlock* Block = reinterpret_cast<FFreeBlock*>(Chunk + (i - 1) * BlockBytes);
+				Block->Next = Pool.FreeList;
+				Pool.FreeList = Block;
+			}
+			Pool.FreeCount += NumBlocks;
+		}
+
+		FFreeBlock* Head = Pool.FreeList;
+		FFreeBlock* Tail = Head;
+		uint32 Count = 1;
+		while (Count < MaxCount && Tail->Next)
+		{
+			Tail = Tail->Next;
+			++Count;
+		}
+		Pool.FreeList = Tail->Next;
+		Pool.FreeCount -= Count;
+		Tail->Next = nullptr;
+
+		OutCount = Count;
+		return Head;
+	}
+
+	void PushBatchToGlobal(int32 Class, FFreeBlock* Head, FFreeBlock* Tail, uint32 Count)
+	{
+		FSizeClassPool& Pool = GetGlobalPools().Pools[Class];
+		std::lock_guard<std::mutex> Lock(Pool.Mutex);
+		Tail->Next = Pool.FreeList;
+		Pool.FreeList = Head;
+		Pool.FreeCount += Count;
+	}
+
+	// 스레드별 free list 캐시. 자명한 타입이라 스레드 종료 후에도 접근 가능 (bDisabled로 우회)
+	struct FThreadCache
+	{
+		FFreeBlock* Head[NumSizeClasses];
+		uint32 Count[NumSizeClasses];
+		bool bRegistered;
+		bool bDisabled;
+	};
+	thread_local FThreadCache GThreadCache = {};
+
+	void FlushCacheClass(FThreadCache& Cache, int32 Class, uint32 KeepCount)
+	{
+		if (Cache.Count[Class] <= KeepCount)
+		{
+			return;
+		}
+
+		// 앞쪽 KeepCount개는 남기고 나머지를 한 번에 반납
+		FFreeBlock* Keep = nullptr;
+		FFreeBlock* Release = Cache.Head[Class];
+		for (uint32 i = 0; i < KeepCount; ++i)
+		{
+			Keep = Release;
+			Release = Release->Next;
+		}
+		if (Keep)
+		{
+			Keep->Next = nullptr;
+		}
+		else
+		{
+			Cache.Head[Class] = nullptr;
+		}
+
+		FFreeBlock* Tail = Release;
+		while (Tail->Next)
+		{
+			Tail = Tail->Next;
+		}
+		PushBatchToGlobal(Class, Release, Tail, Cache.Count[Class] - KeepCount);
+		Cache.Count[Class] = KeepCount;
+	}
+
+	void FlushThreadCacheInternal(FThreadCache& Cache)
+	{
+		for (int32 Class = 0; Class < NumSizeClasses; ++Class)
+		{
+			FlushCacheClass(Cache, Class, 0);
+		}
+	}
+
+	// 스레드 종료 시 캐시를 전역 풀로 돌려주고, 이후 할당/해제는 전역 풀을 직접 사용
+	struct FThreadCacheReleaser
+	{
+		bool bTouched = false;
+
+		~FThreadCacheReleaser()
+		{
+			FlushThreadCacheInternal(GThreadCache);
+			GThreadCache.bDisabled = true;
+		}
+	};
+	thread_local FThreadCacheReleaser GThreadCacheReleaser;
+
+	FThreadCache* GetThreadCache()
+	{
+		FThreadCache& Cache = GThreadCache;
+		if (Cache.bDisabled)
+		{
+			return nullptr;
+		}
+		if (!Cache.bRegistered)
+		{
+			// thread_local 소멸자 등록을 위해 처음 한 번 접근
+			Cache.bRegistered = true;
+			GThreadCacheReleaser.bTouched = true;
+		}
+		return &Cache;
+	}
 
-	*reinterpret_cast<SIZE_T*>(Raw) = Size;
-	TotalAllocationBytes += static_cast<uint32>(Size);
-	TotalAllocationCount++;
+	void* AllocateSmall(int32 Class)
+	{
+		FFreeBlock* Block = nullptr;
+		if (FThreadCache* Cache = GetThreadCache())
+		{
+			if (!Cache->Head[Class])
+			{
+				uint32 Count = 0;
+				Cache->Head[Class] = PopBatchFromGlobal(Class, std::max<uint32>(1, GetThreadCacheLimit(Class) / 2), Count);
+				Cache->Count[Class] = Count;
+			}
+			Block = Cache->Head[Class];
+			if (Block)
+			{
+				Cache->Head[Class] = Block->Next;
+				--Cache->Count[Class];
+			}
+		}
+		else
+		{
+			uint32 Count = 0;
+			Block = PopBatchFromGlobal(Class, 1, Count);
+		}
+		return Block;
+	}
 
-	return static_cast<void*>(static_cast<unsigned char*>(Raw) + sizeof(SIZE_T));
+	void DeallocateSmall(void* BlockPtr, int32 Class)
+	{
+		FFreeBlock* Block = static_cast<FFreeBlock*>(BlockPtr);
+		if (FThreadCache* Cache = GetThreadCache())
+		{
+			Block->Next = Cache->Head[Class];
+			Cache->Head[Class] = Block;
+			const uint32 Limit = GetThreadCacheLimit(Class);
+			if (++Cache->Count[Class] > Limit)
+			{
+				FlushCacheClass(*Cache, Class, Limit / 2);
+			}
+			return;
+		}
+		PushBatchToGlobal(Class, Block, Block, 1);
+	}
+}
+
+void* FMemoryManager::Allocate(SIZE_T Size, SIZE_T Alignment)
+{
+	FGlobalPools& Global = GetGlobalPools();
+	const SIZE_T BlockBytes = Size + HeaderSize;
+
+	FAllocHeader* Header = nullptr;
+	if (Alignment <= SmallAlignment && BlockBytes <= MaxSmallBlockBytes)
+	{
+		const int32 Class = SizeClassTable.Index[(BlockBytes + SmallAlignment - 1) / SmallAlignment];
+		void* Block = AllocateSmall(Class);
+		if (!Block)
+			return nullptr;
+
+		Header = static_cast<FAllocHeader*>(Block);
+		Header->SizeClass = static_cast<uint32>(Class);
+		Header->Offset = 0;
+
+		FSizeClassStats& Stats = Global.Stats[Class];
+		const uint32 Current = Stats.CurrentBlocks.fetch_add(1, std::memory_order_relaxed) + 1;
+		UpdatePeak(Stats.PeakBlocks, Current);
+		Stats.TotalAllocs.fetch_add(1, std::memory_order_relaxed);
+	}
+	else
+	{
+		// 헤더가 사용자 포인터 바로 앞에 오도록 정렬 단위만큼 앞을 비움
+		const SIZE_T FinalAlignment = std::max(Alignment, SmallAlignment);
+		const SIZE_T Offset = std::max(FinalAlignment, HeaderSize);
+		uint8* Raw = static_cast<uint8*>(SystemAlloc(Size + Offset, FinalAlignment));
+		if (!Raw)
+			return nullptr;
+
+		Header = reinterpret_cast<FAllocHeader*>(Raw + Offset - HeaderSize);
+		Header->SizeClass = LargeSizeClass;
+		Header->Offset = static_cast<uint32>(Offset);
+
+		FLargeStats& Stats = Global.Large;
+		const uint64 Current = Stats.CurrentBytes.fetch_add(Size, std::memory_order_relaxed) + Size;
+		UpdatePeak(Stats.PeakBytes, Current);
+		Stats.CurrentBlocks.fetch_add(1, std::memory_order_relaxed);
+		Stats.TotalAllocs.fetch_add(1, std::memory_order_relaxed);
+	}
+	Header->Size = Size;
+
+	TotalAllocationBytes.fetch_add(Size, std::memory_order_relaxed);
+	TotalAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+	return Header + 1;
 }
 
 void FMemoryManager::Deallocate(void* Ptr)
@@ -32,16 +373,95 @@ void FMemoryManager::Deallocate(void* Ptr)
 	if (!Ptr)
 		return;
 
-	unsigned char* UserPtr = static_cast<unsigned char*>(Ptr);
-	unsigned char* Raw = UserPtr - sizeof(SIZE_T);
-	SIZE_T Size = *reinterpret_cast<SIZE_T*>(Raw);
+	FAllocHeader* Header = static_cast<FAllocHeader*>(Ptr) - 1;
+	const SIZE_T Size = static_cast<SIZE_T>(Header->Size);
+	const uint32 SizeClass = Header->SizeClass;
 
-	TotalAllocationBytes -= static_cast<uint32>(Size);
-	TotalAllocationCount--;
+	TotalAllocationBytes.fetch_sub(Size, std::memory_order_relaxed);
+	TotalAllocationCount.fetch_sub(1, std::memory_order_relaxed);
 
-#if defined(_MSC_VER) && defined(_DEBUG)
-	_aligned_free_dbg(Raw);
-#else
-	_aligned_free(Raw);
-#endif
-}
\ No newline at end of file
+	FGlobalPools& Global = GetGlobalPools();
+	if (SizeClass == LargeSizeClass)
+	{
+		Global.Large.CurrentBytes.fetch_sub(Size, std::memory_order_relaxed);
+		Global.Large.CurrentBlocks.fetch_sub(1, std::memory_order_relaxed);
+		SystemFree(reinterpret_cast<uint8*>(Header + 1) - Header->Offset);
+		return;
+	}
+
+	const int32 Class = static_cast<int32>(SizeClass);
+	Global.Stats[Class].CurrentBlocks.fetch_sub(1, std::memory_order_relaxed);
+	DeallocateSmall(Header, Class);
+}
+
+void FMemoryManager::FlushThreadCache()
+{
+	if (FThreadCache* Cache = GetThreadCache())
+	{
+		FlushThreadCacheInternal(*Cache);
+	}
+}
+
+uint64 FMemoryManager::GetPoolReservedBytes()
+{
+	FGlobalPools& Global = GetGlobalPools();
+	uint64 Reserved = 0;
+	for (int32 Class = 0; Class < NumSizeClasses; ++Class)
+	{
+		Reserved += Global.Stats[Class].ReservedBytes.load(std::memory_order_relaxed);
+	}
+	return Reserved;
+}
+
+void FMemoryManager::DumpStats()
+{
+	FGlobalPools& Global = GetGlobalPools();
+	char Buf[256];
+
+	UE_LOG("===== FMemoryManager Size Class Stats =====\r\n");
+	UE_LOG("  Block(B) |  Current |     Peak |    TotalAllocs | Reserved(KB) | PeakUse%%\r\n");
+
+	uint64 PeakUsedBytes = 0;
+	uint64 ReservedBytes = 0;
+	for (int32 Class = 0; Class < NumSizeClasses; ++Class)
+	{
+		const FSizeClassStats& Stats = Global.Stats[Class];
+		const uint64 Reserved = Stats.ReservedBytes.load(std::memory_order_relaxed);
+		if (Reserved == 0)
+		{
+			continue;
+		}
+
+		const uint32 Current = Stats.CurrentBlocks.load(std::memory_order_relaxed);
+		const uint32 Peak = Stats.PeakBlocks.load(std::memory_order_relaxed);
+		const uint64 PeakBytes = static_cast<uint64>(Peak) * SizeClassBytes[Class];
+		PeakUsedBytes += PeakBytes;
+		ReservedBytes += Reserved;
+
+		// 최대 사용량 대비 예약 용량 비율이 낮을수록 해당 클래스에 놀고 있는 청크가 많음
+		std::snprintf(Buf, sizeof(Buf), "  %8zu | %8u | %8u | %14llu | %12.1f | %7.1f\r\n",
+			SizeClassBytes[Class], Current, Peak,
+			static_cast<unsigned long long>(Stats.TotalAllocs.load(std::memory_order_relaxed)),
+			static_cast<double>(Reserved) / 1024.0,
+			100.0 * static_cast<double>(PeakBytes) / static_cast<double>(Reserved));
+		UE_LOG(Buf);
+	}
+
+	std::snprintf(Buf, sizeof(Buf), "  Small: peak %.2f MB / reserved %.2f MB\r\n",
+		static_cast<double>(PeakUsedBytes) / (1024.0 * 1024.0),
+		static_cast<double>(ReservedBytes) / (1024.0 * 1024.0));
+	UE_LOG(Buf);
+
+	std::snprintf(Buf, sizeof(Buf), "  Large: current %.2f MB (%u blocks), peak %.2f MB, total allocs %llu\r\n",
+		static_cast<double>(Global.Large.CurrentBytes.load(std::memory_order_relaxed)) / (1024.0 * 1024.0),
+		Global.Large.CurrentBlocks.load(std::memory_order_relaxed),
+		static_cast<double>(Global.Large.PeakBytes.load(std::memory_order_relaxed)) / (1024.0 * 1024.0),
+		static_cast<unsigned long long>(Global.Large.TotalAllocs.load(std::memory_order_relaxed)));
+	UE_LOG(Buf);
+
+	std::snprintf(Buf, sizeof(Buf), "  Total: %.2f MB in %u allocations\r\n",
+		static_cast<double>(TotalAllocationBytes.load(std::memory_order_relaxed)) / (1024.0 * 1024.0),
+		TotalAllocationCount.load(std::memory_order_relaxed));
+	UE_LOG(Buf);
+	UE_LOG("===== FMemoryManager Size Class Stats END =====\r\n");
+}
@@ -1,7 +1,15 @@
 ﻿#pragma once
 #include <cstddef>
+#include <atomic>
 #include "UEContainer.h"
 
+/**
+ * @brief 엔진 공용 할당기
+ * - 작은 요청(정렬 16 이하, 헤더 포함 32KB 이하)은 사이즈 클래스 풀에서 할당
+ *   각 스레드가 클래스별 free list 캐시를 가지므로 대부분 락 없이 처리되고, 캐시가 비거나 넘치면 전역 풀과 묶음 단위로 교환
+ * - 큰 요청이나 16 초과 정렬은 _aligned_malloc으로 바로 전달
+ * - 통계는 원자 변수라 파티클 비동기 업데이트 등 워커 스레드에서 할당해도 안전
+ */
 class FMemoryManager
 {
 public:
@@ -9,7 +17,16 @@ public:
 	static void* Allocate(SIZE_T Size, SIZE_T Alignment);
 	static void  Deallocate(void* Ptr);
 
+	// 현재 스레드 캐시에 남은 블록을 전역 풀로 반납 (스레드 종료 시 자동 호출)
+	static void FlushThreadCache();
+
+	// 사이즈 클래스별 현재/최대 블록 수, 예약 청크 용량을 콘솔에 출력
+	static void DumpStats();
+
+	// 풀이 OS에서 예약한 청크 총량 (사용 중 + 캐시/free list 포함)
+	static uint64 GetPoolReservedBytes();
+
 public:
-	static uint32 TotalAllocationBytes;
-	static uint32 TotalAllocationCount;
-};
\ No newline at end of file
+	static std::atomic<uint64> TotalAllocationBytes;
+	static std::atomic<uint32> TotalAllocationCount;
+};
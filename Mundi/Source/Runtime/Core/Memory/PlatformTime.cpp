@@ -1,11 +1,15 @@
 ﻿
 #include "pch.h"
 #include "PlatformTime.h"
+#include <mutex>
 
 TMap<FString, FTimeProfile> TimeProfileMap;
+// 애니메이션 병렬 단계 등 워커 스레드에서도 TIME_PROFILE이 불리므로 누적은 잠금 후 수행
+static std::mutex TimeProfileMutex;
 //Map에 이미 있으면 시간, 콜스택 추가
 void FScopeCycleCounter::AddTimeProfile(const TStatId& Key, double InMilliseconds)
 {
+	std::lock_guard<std::mutex> Lock(TimeProfileMutex);
 	if (TimeProfileMap.Contains(Key.Key) == false)
 	{
 		TimeProfileMap[Key.Key] = FTimeProfile{ InMilliseconds, 1 };
@@ -19,6 +23,7 @@ void FScopeCycleCounter::AddTimeProfile(const TStatId& Key, double InMillisecond
 //시간, 콜스택 초기화
 void FScopeCycleCounter::TimeProfileInit()
 {
+	std::lock_guard<std::mutex> Lock(TimeProfileMutex);
 	const TArray<FString> Keys = TimeProfileMap.GetKeys();
 	for (const FString& Key : Keys)
 	{
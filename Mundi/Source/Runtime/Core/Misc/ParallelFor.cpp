@@ -0,0 +1,263 @@
+﻿#include "pch.h"
+#include "ParallelFor.h"
+
+thread_local int32 FWorkerPool::WorkerIndex = FWorkerPool::InvalidWorkerIndex;
+
+namespace
+{
+	// ParallelFor 한 번의 공유 상태. 늦게 시작한 헬퍼가 호출자 반환 뒤에 접근할 수 있으므로 힙에 두고 공유
+	struct FParallelForState
+	{
+		// 인덱스를 차지한 동안에만 호출 (호출자는 차지된 인덱스가 모두 끝나야 반환하므로 그동안 유효)
+		const TFunctionRef<void(int32)>* Body = nullptr;
+		int32 Num = 0;
+		std::atomic<int32> NextIndex{ 0 };
+		std::atomic<int32> NumCompleted{ 0 };
+	};
+}
+
+FWorkerPool::FWorkerPool()
+{
+	// 메인 스레드 몫 하나를 빼고 워커 생성
+	const uint32 HardwareThreads = std::thread::hardware_concurrency();
+	NumWorkers = std::clamp(static_cast<int32>(HardwareThreads) - 1, 1, 15);
+
+	Queues = std::make_unique<FTaskQueue[]>(NumWorkers + 1);
+
+	Workers.reserve(NumWorkers);
+	for (int32 i = 0; i < NumWorkers; ++i)
+	{
+		Workers.emplace_back([this, i]() { WorkerMain(i); });
+	}
+}
+
+FWorkerPool::~FWorkerPool()
+{
+	bShutdown.store(true, std::memory_order_release);
+	WorkSignal.fetch_add(1, std::memory_order_seq_cst);
+	WorkSignal.notify_all();
+
+	for (std::thread& Worker : Workers)
+	{
+		if (Worker.joinable())
+		{
+			Worker.join();
+		}
+	}
+}
+
+void FWorkerPool::ParallelFor(int32 Num, TFunctionRef<void(int32)> Body)
+{
+	if (Num <= 0)
+	{
+		return;
+	}
+
+	if (Num == 1 || NumWorkers == 0)
+	{
+		for (int32 i = 0; i < Num; ++i)
+		{
+			Body(i);
+		}
+		return;
+	}
+
+	// 인덱스는 공유 카운터로 나눠 가지고, 완료는 끝난 인덱스 수로 판단
+	// 헬퍼가 늦게 시작되면 남은 인덱스가 없어 Body를 건드리지 않고 바로 끝나므로 호출자가 헬퍼 실행을 기다리지 않음
+	std::shared_ptr<FParallelForState> State = std::make_shared<FParallelForState>();
+	State->Body = &Body;
+	State->Num = Num;
+
+	auto RunItems = [this](FParallelForState& InState)
+		{
+			while (true)
+			{
+				const int32 Index = InState.NextIndex.fetch_add(1, std::memory_order_relaxed);
+				if (Index >= InState.Num)
+				{
+					break;
+				}
+				(*InState.Body)(Index);
+
+				// 마지막 인덱스를 끝낸 스레드가 대기 중인 호출자를 깨움
+				if (InState.NumCompleted.fetch_add(1, std::memory_order_acq_rel) + 1 == InState.Num)
+				{
+					NotifyCompletion();
+				}
+			}
+		};
+
+	const int32 NumHelpers = std::min(Num - 1, NumWorkers);
+	for (int32 i = 0; i < NumHelpers; ++i)
+	{
+		PushTask(FTask{ [State, RunItems]() { RunItems(*State); }, nullptr }, true);
+	}
+
+	// 호출 스레드도 작업 분배에 참여
+	RunItems(*State);
+	WaitUntil([&State, Num]() { return State->NumCompleted.load(std::memory_order_acquire) == Num; });
+}
+
+void FWorkerPool::Launch(FTaskGroup& Group, std::function<void()> Task)
+{
+	Group.Pending.fetch_add(1, std::memory_order_relaxed);
+	PushTask(FTask{ std::move(Task), &Group }, false);
+}
+
+void FWorkerPool::PushTask(FTask&& Task, bool bFront)
+{
+	// 워커 안에서 만든 태스크는 자기 큐로 (다른 워커가 훔쳐 갈 수 있음), 그 외는 주입 큐로
+	const int32 QueueIndex = IsInWorkerThread() ? WorkerIndex : NumWorkers;
+	{
+		FTaskQueue& Queue = Queues[QueueIndex];
+		std::lock_guard<std::mutex> Lock(Queue.Mutex);
+		if (bFront && QueueIndex == NumWorkers)
+		{
+			Queue.Tasks.push_front(std::move(Task));
+		}
+		else
+		{
+			Queue.Tasks.push_back(std::move(Task));
+		}
+	}
+	NotifyWork();
+}
+
+void FWorkerPool::Wait(FTaskGroup& Group)
+{
+	WaitUntil([&Group]() { return Group.IsDone(); });
+}
+
+void FWorkerPool::WaitUntil(TFunctionRef<bool()> IsDone)
+{
+	const bool bWorker = IsInWorkerThread();
+
+	// 워커는 새 태스크에도 깨어나야 하므로 WorkSignal, 그 외 스레드는 완료 알림만 기다림
+	std::atomic<uint32>& WakeSignal = bWorker ? WorkSignal : CompletionSignal;
+	while (true)
+	{
+		// 조건 확인 전에 신호를 읽어 둬야, 확인 직후 들어온 추가/완료 알림을 놓치지 않음
+		const uint32 SeenSignal = WakeSignal.load(std::memory_order_seq_cst);
+		if (IsDone())
+		{
+			return;
+		}
+
+		// 워커는 기다리는 동안 다른 태스크를 처리 (모든 워커가 서로를 기다리며 멈추는 것 방지)
+		if (bWorker)
+		{
+			FTask Task;
+			if (TryGetTask(WorkerIndex, Task))
+			{
+				ExecuteTask(Task);
+				continue;
+			}
+
+			// 대기 워커가 있으면 알림 측이 notify_all을 쓰도록 등록. 등록 뒤 신호를 다시 확인해 그 사이 알림을 놓치지 않음
+			NumSleepingWaiters.fetch_add(1, std::memory_order_seq_cst);
+			if (WorkSignal.load(std::memory_order_seq_cst) == SeenSignal)
+			{
+				WorkSignal.wait(SeenSignal, std::memory_order_acquire);
+			}
+			NumSleepingWaiters.fetch_sub(1, std::memory_order_seq_cst);
+			continue;
+		}
+
+		CompletionSignal.wait(SeenSignal, std::memory_order_acquire);
+	}
+}
+
+bool FWorkerPool::TryGetTask(int32 SelfIndex, FTask& OutTask)
+{
+	// 1) 자기 큐의 가장 최근 태스크 (캐시가 따뜻한 쪽)
+	{
+		FTaskQueue& Queue = Queues[SelfIndex];
+		std::lock_guard<std::mutex> Lock(Queue.Mutex);
+		if (!Queue.Tasks.empty())
+		{
+			OutTask = std::move(Queue.Tasks.back());
+			Queue.Tasks.pop_back();
+			return true;
+		}
+	}
+
+	// 2) 주입 큐와 다른 워커 큐에서 가장 오래된 태스크를 훔침 (옆 워커부터 순회해 경합 분산)
+	const int32 NumQueues = NumWorkers + 1;
+	for (int32 Offset = 1; Offset < NumQueues; ++Offset)
+	{
+		FTaskQueue& Queue = Queues[(SelfIndex + Offset) % NumQueues];
+		std::lock_guard<std::mutex> Lock(Queue.Mutex);
+		if (!Queue.Tasks.empty())
+		{
+			OutTask = std::move(Queue.Tasks.front());
+			Queue.Tasks.pop_front();
+			return true;
+		}
+	}
+	return false;
+}
+
+void FWorkerPool::ExecuteTask(FTask& Task)
+{
+	Task.Body();
+	Task.Body = nullptr;
+
+	// ParallelFor 헬퍼는 그룹 없이 인덱스 카운터로 완료를 알림
+	// 카운터를 내린 뒤에는 Group이 대기 측에서 파괴될 수 있으므로 다시 건드리지 않음
+	if (FTaskGroup* Group = Task.Group)
+	{
+		Group->Pending.fetch_sub(1, std::memory_order_acq_rel);
+		NotifyCompletion();
+	}
+}
+
+void FWorkerPool::NotifyWork()
+{
+	WorkSignal.fetch_add(1, std::memory_order_seq_cst);
+
+	// 태스크 하나에는 잠든 워커 하나면 충분. 대기 중인 워커가 있으면 그쪽이 못 깨어날 수 있으므로 모두 깨움
+	if (NumSleepingWaiters.load(std::memory_order_seq_cst) > 0)
+	{
+		WorkSignal.notify_all();
+	}
+	else
+	{
+		WorkSignal.notify_one();
+	}
+}
+
+void FWorkerPool::NotifyCompletion()
+{
+	CompletionSignal.fetch_add(1, std::memory_order_seq_cst);
+	CompletionSignal.notify_all();
+
+	// 대기 중인 워커는 WorkSignal에서 잠들어 있으므로 그쪽도 깨움
+	WorkSignal.fetch_add(1, std::memory_order_seq_cst);
+	if (NumSleepingWaiters.load(std::memory_order_seq_cst) > 0)
+	{
+		WorkSignal.notify_all();
+	}
+}
+
+void FWorkerPool::WorkerMain(int32 InWorkerIndex)
+{
+	WorkerIndex = InWorkerIndex;
+
+	while (true)
+	{
+		const uint32 SeenSignal = WorkSignal.load(std::memory_order_acquire);
+		if (bShutdown.load(std::memory_order_acquire))
+		{
+			return;
+		}
+
+		FTask Task;
+		if (TryGetTask(WorkerIndex, Task))
+		{
+			ExecuteTask(Task);
+			continue;
+		}
+
+		WorkSignal.wait(SeenSignal, std::memory_order_acquire);
+	}
+}
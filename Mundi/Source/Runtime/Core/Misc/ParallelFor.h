@@ -0,0 +1,122 @@
+﻿#pragma once
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+
+/**
+ * @brief FWorkerPool::Launch로 띄운 태스크 묶음의 완료 카운터
+ * - Launch마다 1 증가, 태스크가 끝나면 1 감소. 0이면 묶음 전체 완료
+ * - 태스크가 참조하는 동안 파괴되면 안 되므로 소멸자에서 완료를 기다림
+ */
+class FTaskGroup
+{
+public:
+	FTaskGroup() = default;
+	~FTaskGroup() { Wait(); }
+	FTaskGroup(const FTaskGroup&) = delete;
+	FTaskGroup& operator=(const FTaskGroup&) = delete;
+
+	bool IsDone() const { return Pending.load(std::memory_order_acquire) == 0; }
+
+	// 완료까지 대기 (워커 스레드에서 호출하면 기다리는 동안 다른 태스크를 처리)
+	void Wait();
+
+private:
+	friend class FWorkerPool;
+	std::atomic<int32> Pending{ 0 };
+};
+
+/**
+ * @brief 워크 스틸링 방식의 상주 워커 풀 (싱글톤)
+ * - 워커마다 태스크 큐를 두고, 자기 큐는 뒤에서(LIFO) 꺼내고 남의 큐는 앞에서(FIFO) 훔쳐 옴
+ * - 워커가 아닌 스레드(메인 스레드 등)에서 Launch한 태스크는 공용 주입 큐로 들어감
+ * - 워커 안에서 Launch한 태스크는 그 워커 큐에 쌓이므로, 큰 작업을 잘게 쪼개면 놀고 있는 워커가 가져감
+ * - 워커가 Wait/ParallelFor에서 기다리는 동안에는 다른 태스크를 대신 처리하므로 중첩 호출도 병렬로 돈다
+ * - 워커가 아닌 스레드는 기다리는 동안 남의 태스크를 집어 가지 않음 (메인 스레드가 긴 태스크에 묶이지 않도록)
+ * - ParallelFor는 헬퍼 태스크가 아니라 처리된 인덱스 수로 완료를 판단하고, 헬퍼는 주입 큐 앞에 넣음
+ *   (먼저 쌓인 긴 비동기 태스크가 빠질 때까지 메인 스레드의 ParallelFor가 묶이지 않도록)
+ */
+class FWorkerPool
+{
+public:
+	static FWorkerPool& GetInstance()
+	{
+		static FWorkerPool Instance;
+		return Instance;
+	}
+
+	// [0, Num) 인덱스마다 Body를 한 번씩 호출 (호출 순서는 보장하지 않음, 모든 인덱스가 끝나야 반환)
+	void ParallelFor(int32 Num, TFunctionRef<void(int32)> Body);
+
+	// Task를 비동기로 실행. 완료는 Group으로 확인/대기
+	void Launch(FTaskGroup& Group, std::function<void()> Task);
+
+	// Group의 태스크가 모두 끝날 때까지 대기
+	void Wait(FTaskGroup& Group);
+
+	// 호출 스레드를 제외한 워커 수
+	int32 GetNumWorkers() const { return NumWorkers; }
+
+	static bool IsInWorkerThread() { return WorkerIndex != InvalidWorkerIndex; }
+
+private:
+	FWorkerPool();
+	~FWorkerPool();
+	FWorkerPool(const FWorkerPool&) = delete;
+	FWorkerPool& operator=(const FWorkerPool&) = delete;
+
+	struct FTask
+	{
+		std::function<void()> Body;
+		FTaskGroup* Group = nullptr;
+	};
+
+	// 워커별 태스크 큐 (마지막 하나는 워커 외 스레드용 주입 큐)
+	struct FTaskQueue
+	{
+		std::mutex Mutex;
+		std::deque<FTask> Tasks;
+	};
+
+	void WorkerMain(int32 InWorkerIndex);
+	// bFront: 주입 큐 앞에 넣음 (ParallelFor 헬퍼용)
+	void PushTask(FTask&& Task, bool bFront);
+	bool TryGetTask(int32 SelfIndex, FTask& OutTask);
+	void ExecuteTask(FTask& Task);
+	// IsDone이 참이 될 때까지 대기 (워커 스레드면 그동안 다른 태스크 처리)
+	void WaitUntil(TFunctionRef<bool()> IsDone);
+	void NotifyWork();
+	void NotifyCompletion();
+
+	static constexpr int32 InvalidWorkerIndex = -1;
+
+	TArray<std::thread> Workers;
+	int32 NumWorkers = 0;
+	std::unique_ptr<FTaskQueue[]> Queues;
+
+	// 태스크 추가 때마다 증가. 잠든 워커(대기 중인 워커 포함)는 이 값이 바뀌길 기다림 (추가 하나에 워커 하나만 깨움)
+	std::atomic<uint32> WorkSignal{ 0 };
+	// 태스크/ParallelFor 완료 때마다 증가. 워커가 아닌 대기 스레드는 이 값이 바뀌길 기다림
+	std::atomic<uint32> CompletionSignal{ 0 };
+	// WaitUntil에서 WorkSignal로 잠든 워커 수. 있으면 추가/완료 알림을 모두에게 보냄
+	std::atomic<int32> NumSleepingWaiters{ 0 };
+	std::atomic<bool> bShutdown{ false };
+
+	static thread_local int32 WorkerIndex;
+};
+
+inline void FTaskGroup::Wait()
+{
+	if (!IsDone())
+	{
+		FWorkerPool::GetInstance().Wait(*this);
+	}
+}
+
+inline void ParallelFor(int32 Num, TFunctionRef<void(int32)> Body)
+{
+	FWorkerPool::GetInstance().ParallelFor(Num, Body);
+}
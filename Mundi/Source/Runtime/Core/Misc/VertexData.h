@@ -3,6 +3,7 @@
 #include "Vector.h"
 #include "Name.h"
 #include "Color.h"
+#include <atomic>
 
 #define  INDEX_NONE -1
 // 직렬화 포맷 (FVertexDynamic와 역할이 달라서 분리됨)
@@ -266,11 +267,38 @@ struct FBone
     }
 };
 
+/**
+ * @brief 스켈레톤 인스턴스 식별용 리비전
+ * 생성/복사/대입/로드마다 새 값을 받으므로, 해제된 스켈레톤 주소가 재사용돼도 캐시가 이전 것과 구분할 수 있다.
+ */
+struct FSkeletonRevision
+{
+    uint64 Value;
+
+    FSkeletonRevision() : Value(Next()) {}
+    FSkeletonRevision(const FSkeletonRevision&) : Value(Next()) {}
+    FSkeletonRevision& operator=(const FSkeletonRevision&)
+    {
+        Value = Next();
+        return *this;
+    }
+
+    void Bump() { Value = Next(); }
+
+private:
+    static uint64 Next()
+    {
+        static std::atomic<uint64> Counter{ 0 };
+        return Counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+};
+
 struct FSkeleton
 {
     FString Name; // 스켈레톤 이름
     TArray<FBone> Bones; // 본 배열
     TMap <FString, int32> BoneNameToIndex; // 이름으로 본 검색
+    FSkeletonRevision Revision; // 본 구성이 바뀌는 경로(복사/대입/로드)마다 새로 발급
 
     /**
      * @brief 본 이름으로 본 인덱스를 찾기
@@ -327,6 +355,8 @@ struct FSkeleton
                 Ar << bone;
             }
 
+            Skeleton.Revision.Bump();
+
             // BoneNameToIndex 재구축
             Skeleton.BoneNameToIndex.clear();
             for (int32 i = 0; i < static_cast<int32>(Skeleton.Bones.size()); ++i)
@@ -0,0 +1,396 @@
+﻿#include "pch.h"
+#include "AnimCompression.h"
+#include "AnimDateModel.h"
+
+namespace
+{
+    constexpr float QuantizeMax = 65535.0f;
+    constexpr float RotationQuantizeMax = 32767.0f;     // 15비트
+    constexpr float InvSqrt2 = 0.70710678118f;
+
+    float ComponentAt(const FVector& V, int32 Axis) { return Axis == 0 ? V.X : (Axis == 1 ? V.Y : V.Z); }
+    float ComponentAt(const FQuat& Q, int32 Axis) { return Axis == 0 ? Q.X : (Axis == 1 ? Q.Y : (Axis == 2 ? Q.Z : Q.W)); }
+
+    float MaxComponentError(const FVector& A, const FVector& B)
+    {
+        return FMath::Max(std::fabs(A.X - B.X), FMath::Max(std::fabs(A.Y - B.Y), std::fabs(A.Z - B.Z)));
+    }
+
+    /** q와 -q는 같은 회전이므로 부호를 맞춘 뒤 성분 오차를 잰다 */
+    float MaxComponentError(const FQuat& A, const FQuat& B)
+    {
+        const float Sign = FQuat::Dot(A, B) < 0.0f ? -1.0f : 1.0f;
+        float Error = 0.0f;
+        for (int32 Axis = 0; Axis < 4; ++Axis)
+        {
+            Error = FMath::Max(Error, std::fabs(ComponentAt(A, Axis) - Sign * ComponentAt(B, Axis)));
+        }
+        return Error;
+    }
+
+    FVector InterpolateKey(const FVector& A, const FVector& B, float Alpha) { return FVector::Lerp(A, B, Alpha); }
+    // 키 제거를 Nlerp 기준으로 검증하므로 평가도 Nlerp로 충분 (키 간격이 벌어져도 acos/sin 경로를 타지 않음)
+    FQuat InterpolateKey(const FQuat& A, const FQuat& B, float Alpha) { return FQuat::Nlerp(A, B, Alpha); }
+
+    /**
+     * 오차 한도 내 키 제거 (탐욕적 구간 확장)
+     * 마지막으로 남긴 키에서 시작해, 중간 프레임이 전부 양 끝 보간으로 MaxError 이내에 들어오는 한 구간을 늘린다.
+     * 평가 쪽 보간(Lerp/Nlerp)과 같은 함수로 비교하므로 제거된 프레임의 재생 오차가 MaxError를 넘지 않는다.
+     */
+    template<typename KeyType>
+    void ReduceKeys(const TArray<KeyType>& RawKeys, float MaxError, TArray<uint16>& OutKeyFrames)
+    {
+        // 한 구간을 너무 길게 잡으면 검사 비용이 제곱으로 늘어나므로 상한을 둔다 (임포트 시간 보호)
+        constexpr int32 MaxSegmentLength = 256;
+
+        // 프레임 번호를 uint16으로 저장하므로 그 이후 키는 버린다 (30fps 기준 36분)
+        const int32 NumKeys = FMath::Min(RawKeys.Num(), 65536);
+        OutKeyFrames.Empty();
+        OutKeyFrames.Add(0);
+
+        int32 Start = 0;
+        while (Start < NumKeys - 1)
+        {
+            int32 End = Start + 1;
+            while (End + 1 < NumKeys && End + 1 - Start <= MaxSegmentLength)
+            {
+                const int32 Candidate = End + 1;
+                const float InvLength = 1.0f / static_cast<float>(Candidate - Start);
+                bool bFits = true;
+                for (int32 i = Start + 1; i < Candidate; ++i)
+                {
+                    const KeyType Approx = InterpolateKey(RawKeys[Start], RawKeys[Candidate], static_cast<float>(i - Start) * InvLength);
+                    if (MaxComponentError(Approx, RawKeys[i]) > MaxError)
+                    {
+                        bFits = false;
+                        break;
+                    }
+                }
+                if (!bFits)
+                {
+                    break;
+                }
+                End = Candidate;
+            }
+
+            OutKeyFrames.Add(static_cast<uint16>(End));
+            Start = End;
+        }
+    }
+
+    template<typename KeyType>
+    bool IsConstantTrack(const TArray<KeyType>& RawKeys, float MaxError)
+    {
+        for (int32 i = 1; i < RawKeys.Num(); ++i)
+        {
+            if (MaxComponentError(RawKeys[0], RawKeys[i]) > MaxError)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    uint16 QuantizeUnit(float Value01, float MaxValue)
+    {
+        return static_cast<uint16>(FMath::Clamp(Value01, 0.0f, 1.0f) * MaxValue + 0.5f);
+    }
+
+    void PackQuat(const FQuat& InQuat, uint16* OutValues)
+    {
+        FQuat Q = InQuat;
+        Q.Normalize();
+
+        int32 Largest = 0;
+        for (int32 Axis = 1; Axis < 4; ++Axis)
+        {
+            if (std::fabs(ComponentAt(Q, Axis)) > std::fabs(ComponentAt(Q, Largest)))
+            {
+                Largest = Axis;
+            }
+        }
+
+        // 가장 큰 성분이 양수가 되도록 부호를 맞추면 복원 시 sqrt의 부호를 따로 저장할 필요가 없다
+        const float Sign = ComponentAt(Q, Largest) < 0.0f ? -1.0f : 1.0f;
+
+        uint64 Packed = static_cast<uint64>(Largest);
+        int32 Shift = 2;
+        for (int32 Axis = 0; Axis < 4; ++Axis)
+        {
+            if (Axis == Largest) { continue; }
+            // 나머지 성분은 [-1/sqrt2, 1/sqrt2] 범위
+            const float Unit = (Sign * ComponentAt(Q, Axis) * InvSqrt2 * 2.0f + 1.0f) * 0.5f;
+            Packed |= static_cast<uint64>(QuantizeUnit(Unit, RotationQuantizeMax)) << Shift;
+            Shift += 15;
+        }
+
+        OutValues[0] = static_cast<uint16>(Packed);
+        OutValues[1] = static_cast<uint16>(Packed >> 16);
+        OutValues[2] = static_cast<uint16>(Packed >> 32);
+    }
+
+    FQuat UnpackQuat(const uint16* Values)
+    {
+        const uint64 Packed = static_cast<uint64>(Values[0]) | (static_cast<uint64>(Values[1]) << 16) | (static_cast<uint64>(Values[2]) << 32);
+        constexpr float Scale = 2.0f * InvSqrt2 / RotationQuantizeMax;
+        const float A = static_cast<float>((Packed >> 2) & 0x7FFF) * Scale - InvSqrt2;
+        const float B = static_cast<float>((Packed >> 17) & 0x7FFF) * Scale - InvSqrt2;
+        const float C = static_cast<float>((Packed >> 32) & 0x7FFF) * Scale - InvSqrt2;
+        const float D = std::sqrt(FMath::Max(0.0f, 1.0f - A * A - B * B - C * C));
+
+        // 나머지 셋은 축 순서대로 들어 있으므로 가장 큰 성분 자리에만 D를 끼워 넣는다
+        switch (Packed & 0x3)
+        {
+        case 0:  return FQuat(D, A, B, C);
+        case 1:  return FQuat(A, D, B, C);
+        case 2:  return FQuat(A, B, D, C);
+        default: return FQuat(A, B, C, D);
+        }
+    }
+}
+
+// ============================================================
+// FCompressedTrackKeys
+// ============================================================
+
+void FCompressedTrackKeys::FindSegment(float FrameTime, int32& OutKey0, int32& OutKey1, float& OutAlpha) const
+{
+    const int32 LastKey = KeyFrames.Num() - 1;
+    if (FrameTime <= 0.0f || LastKey <= 0)
+    {
+        OutKey0 = OutKey1 = 0;
+        OutAlpha = 0.0f;
+        return;
+    }
+
+    if (FrameTime >= static_cast<float>(KeyFrames[LastKey]))
+    {
+        OutKey0 = OutKey1 = LastKey;
+        OutAlpha = 0.0f;
+        return;
+    }
+
+    // floor(FrameTime) 이하인 마지막 키를 분기 없는 이진 탐색으로 찾는다
+    // (본마다 재생 시간이 제각각이라 분기 예측이 거의 맞지 않으므로 cmov로 떨어지는 형태가 빠름)
+    const uint16 Frame = static_cast<uint16>(FrameTime);
+    const uint16* Base = KeyFrames.data();
+    int32 Length = KeyFrames.Num();
+    while (Length > 1)
+    {
+        const int32 Half = Length / 2;
+        Base = (Base[Half] <= Frame) ? Base + Half : Base;
+        Length -= Half;
+    }
+    OutKey0 = static_cast<int32>(Base - KeyFrames.data());
+    OutKey1 = OutKey0 + 1;
+
+    const float Frame0 = static_cast<float>(KeyFrames[OutKey0]);
+    const float Frame1 = static_cast<float>(KeyFrames[OutKey1]);
+    OutAlpha = (FrameTime - Frame0) / (Frame1 - Frame0);
+}
+
+// ============================================================
+// FCompressedVectorTrack
+// ============================================================
+
+void FCompressedVectorTrack::Compress(const TArray<FVector>& RawKeys, float MaxError, const FVector& DefaultValue)
+{
+    Keys.KeyFrames.Empty();
+    Keys.Values.Empty();
+    RawValues.Empty();
+    RangeExtent = FVector(0.0f, 0.0f, 0.0f);
+
+    if (RawKeys.IsEmpty() || IsConstantTrack(RawKeys, MaxError))
+    {
+        RangeMin = RawKeys.IsEmpty() ? DefaultValue : RawKeys[0];
+        return;
+    }
+
+    ReduceKeys(RawKeys, MaxError, Keys.KeyFrames);
+
+    // 범위 정규화: 남은 키 기준 AABB
+    FVector Min = RawKeys[0];
+    FVector Max = RawKeys[0];
+    for (uint16 Frame : Keys.KeyFrames)
+    {
+        const FVector& Key = RawKeys[Frame];
+        Min = FVector(FMath::Min(Min.X, Key.X), FMath::Min(Min.Y, Key.Y), FMath::Min(Min.Z, Key.Z));
+        Max = FVector(FMath::Max(Max.X, Key.X), FMath::Max(Max.Y, Key.Y), FMath::Max(Max.Z, Key.Z));
+    }
+    RangeMin = Min;
+    RangeExtent = Max - Min;
+
+    Keys.Values.Reserve(Keys.KeyFrames.Num() * 3);
+    for (uint16 Frame : Keys.KeyFrames)
+    {
+        const FVector& Key = RawKeys[Frame];
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            const float Extent = ComponentAt(RangeExtent, Axis);
+            const float Unit = Extent > 0.0f ? (ComponentAt(Key, Axis) - ComponentAt(RangeMin, Axis)) / Extent : 0.0f;
+            Keys.Values.Add(QuantizeUnit(Unit, QuantizeMax));
+        }
+    }
+
+    // 범위가 넓으면 16비트 한 칸이 허용 오차보다 커질 수 있으므로, 남은 키를 복원해 오차를 재고 넘으면 float 그대로 저장
+    float QuantizeError = 0.0f;
+    for (int32 KeyIndex = 0; KeyIndex < Keys.KeyFrames.Num(); ++KeyIndex)
+    {
+        QuantizeError = FMath::Max(QuantizeError, MaxComponentError(GetKey(KeyIndex), RawKeys[Keys.KeyFrames[KeyIndex]]));
+    }
+    if (QuantizeError > MaxError)
+    {
+        Keys.Values.Empty();
+        RawValues.Reserve(Keys.KeyFrames.Num());
+        for (uint16 Frame : Keys.KeyFrames)
+        {
+            RawValues.Add(RawKeys[Frame]);
+        }
+    }
+}
+
+FVector FCompressedVectorTrack::GetKey(int32 KeyIndex) const
+{
+    if (IsRaw())
+    {
+        return RawValues[KeyIndex];
+    }
+    const uint16* Value = &Keys.Values[KeyIndex * 3];
+    constexpr float InvMax = 1.0f / QuantizeMax;
+    return FVector(
+        RangeMin.X + static_cast<float>(Value[0]) * InvMax * RangeExtent.X,
+        RangeMin.Y + static_cast<float>(Value[1]) * InvMax * RangeExtent.Y,
+        RangeMin.Z + static_cast<float>(Value[2]) * InvMax * RangeExtent.Z);
+}
+
+FVector FCompressedVectorTrack::Evaluate(float FrameTime) const
+{
+    if (Keys.IsConstant())
+    {
+        return RangeMin;
+    }
+
+    int32 Key0, Key1;
+    float Alpha;
+    Keys.FindSegment(FrameTime, Key0, Key1, Alpha);
+    if (Key0 == Key1)
+    {
+        return GetKey(Key0);
+    }
+    return FVector::Lerp(GetKey(Key0), GetKey(Key1), Alpha);
+}
+
+void FCompressedVectorTrack::GetSegment(float FrameTime, FVector& OutKey0, FVector& OutKey1, float& OutAlpha) const
+{
+    if (Keys.IsConstant())
+    {
+        OutKey0 = OutKey1 = RangeMin;
+        OutAlpha = 0.0f;
+        return;
+    }
+
+    int32 Key0, Key1;
+    Keys.FindSegment(FrameTime, Key0, Key1, OutAlpha);
+    OutKey0 = GetKey(Key0);
+    OutKey1 = (Key0 == Key1) ? OutKey0 : GetKey(Key1);
+}
+
+// ============================================================
+// FCompressedRotationTrack
+// ============================================================
+
+void FCompressedRotationTrack::Compress(const TArray<FQuat>& RawKeys, float MaxError)
+{
+    Keys.KeyFrames.Empty();
+    Keys.Values.Empty();
+
+    if (RawKeys.IsEmpty() || IsConstantTrack(RawKeys, MaxError))
+    {
+        ConstantValue = RawKeys.IsEmpty() ? FQuat::Identity() : RawKeys[0];
+        ConstantValue.Normalize();
+        return;
+    }
+
+    ReduceKeys(RawKeys, MaxError, Keys.KeyFrames);
+
+    Keys.Values.SetNum(Keys.KeyFrames.Num() * 3);
+    for (int32 i = 0; i < Keys.KeyFrames.Num(); ++i)
+    {
+        PackQuat(RawKeys[Keys.KeyFrames[i]], &Keys.Values[i * 3]);
+    }
+}
+
+FQuat FCompressedRotationTrack::GetKey(int32 KeyIndex) const
+{
+    return UnpackQuat(&Keys.Values[KeyIndex * 3]);
+}
+
+FQuat FCompressedRotationTrack::Evaluate(float FrameTime) const
+{
+    if (Keys.IsConstant())
+    {
+        return ConstantValue;
+    }
+
+    int32 Key0, Key1;
+    float Alpha;
+    Keys.FindSegment(FrameTime, Key0, Key1, Alpha);
+    if (Key0 == Key1)
+    {
+        return GetKey(Key0);
+    }
+
+    return InterpolateKey(GetKey(Key0), GetKey(Key1), Alpha);
+}
+
+void FCompressedRotationTrack::GetSegment(float FrameTime, FQuat& OutKey0, FQuat& OutKey1, float& OutAlpha) const
+{
+    if (Keys.IsConstant())
+    {
+        OutKey0 = OutKey1 = ConstantValue;
+        OutAlpha = 0.0f;
+        return;
+    }
+
+    int32 Key0, Key1;
+    Keys.FindSegment(FrameTime, Key0, Key1, OutAlpha);
+    OutKey0 = GetKey(Key0);
+    OutKey1 = (Key0 == Key1) ? OutKey0 : GetKey(Key1);
+}
+
+// ============================================================
+// FCompressedAnimTrack
+// ============================================================
+
+void FCompressedAnimTrack::Compress(const FRawAnimSequenceTrack& RawTrack, const FAnimCompressionSettings& Settings)
+{
+    // 키 배열이 비어 있으면 원본 평가와 같은 기본값 (FTransform 기본 생성자)
+    Translation.Compress(RawTrack.PosKeys, Settings.MaxTranslationError, FVector(0.0f, 0.0f, 0.0f));
+    Rotation.Compress(RawTrack.RotKeys, Settings.MaxRotationError);
+    Scale.Compress(RawTrack.ScaleKeys, Settings.MaxScaleError, FVector(1.0f, 1.0f, 1.0f));
+    bValid = true;
+}
+
+FTransform FCompressedAnimTrack::Evaluate(float FrameTime) const
+{
+    return FTransform(Translation.Evaluate(FrameTime), Rotation.Evaluate(FrameTime), Scale.Evaluate(FrameTime));
+}
+
+void FCompressedAnimTrack::DecompressToRaw(int32 NumFrames, FRawAnimSequenceTrack& OutRawTrack) const
+{
+    OutRawTrack.PosKeys.SetNum(NumFrames);
+    OutRawTrack.RotKeys.SetNum(NumFrames);
+    OutRawTrack.ScaleKeys.SetNum(NumFrames);
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        const float FrameTime = static_cast<float>(Frame);
+        OutRawTrack.PosKeys[Frame] = Translation.Evaluate(FrameTime);
+        OutRawTrack.RotKeys[Frame] = Rotation.Evaluate(FrameTime);
+        OutRawTrack.ScaleKeys[Frame] = Scale.Evaluate(FrameTime);
+    }
+}
+
+SIZE_T FCompressedAnimTrack::GetAllocatedSize() const
+{
+    return sizeof(FCompressedAnimTrack) + Translation.GetAllocatedSize() + Rotation.Keys.GetAllocatedSize() + Scale.GetAllocatedSize();
+}
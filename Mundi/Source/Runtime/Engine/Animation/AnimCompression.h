@@ -0,0 +1,138 @@
+﻿#pragma once
+#include "Archive.h"
+
+struct FRawAnimSequenceTrack;
+
+/**
+ * @brief 애니메이션 트랙 압축 허용 오차
+ * - 키 제거는 원본 키와 제거 후 보간값의 차이가 이 값 이내일 때만 수행 (성분별 최대 오차)
+ */
+struct FAnimCompressionSettings
+{
+    float MaxTranslationError = 0.001f;
+    float MaxRotationError = 0.0005f;   // 쿼터니언 성분 오차 (약 0.06도)
+    float MaxScaleError = 0.0005f;
+};
+
+/**
+ * @brief 키 제거 후 남은 키들의 공통 저장소
+ * - KeyFrames: 남은 키의 원본 프레임 번호 (오름차순, 첫 키는 항상 0번 프레임)
+ * - Values: 키마다 uint16 3개 (벡터는 범위 정규화 XYZ, 회전은 48비트 smallest-three), 벡터 트랙이 float 저장이면 비어 있음
+ * - KeyFrames가 비어 있으면 상수 트랙
+ */
+struct FCompressedTrackKeys
+{
+    TArray<uint16> KeyFrames;
+    TArray<uint16> Values;
+
+    bool IsConstant() const { return KeyFrames.IsEmpty(); }
+    int32 GetNumKeys() const { return KeyFrames.Num(); }
+
+    /** FrameTime(프레임 단위 시간)을 감싸는 두 키와 그 사이 보간 비율 (마지막 키 이후는 마지막 키 유지) */
+    void FindSegment(float FrameTime, int32& OutKey0, int32& OutKey1, float& OutAlpha) const;
+
+    SIZE_T GetAllocatedSize() const { return KeyFrames.size() * sizeof(uint16) + Values.size() * sizeof(uint16); }
+
+    friend FArchive& operator<<(FArchive& Ar, FCompressedTrackKeys& Keys)
+    {
+        if (Ar.IsSaving())
+        {
+            Serialization::WriteArray(Ar, Keys.KeyFrames);
+            Serialization::WriteArray(Ar, Keys.Values);
+        }
+        else if (Ar.IsLoading())
+        {
+            Serialization::ReadArray(Ar, Keys.KeyFrames);
+            Serialization::ReadArray(Ar, Keys.Values);
+        }
+        return Ar;
+    }
+};
+
+/**
+ * 위치/스케일 트랙: 트랙별 [RangeMin, RangeMin + RangeExtent] 범위로 정규화해 성분당 16비트
+ * 범위가 넓어 16비트 복원 오차가 MaxError를 넘는 트랙은 남은 키 값을 float 그대로 RawValues에 둔다 (Keys.Values는 비움)
+ */
+struct FCompressedVectorTrack
+{
+    FVector RangeMin = FVector(0.0f, 0.0f, 0.0f);     // 상수 트랙이면 값 자체
+    FVector RangeExtent = FVector(0.0f, 0.0f, 0.0f);
+    FCompressedTrackKeys Keys;
+    TArray<FVector> RawValues;
+
+    bool IsRaw() const { return !RawValues.IsEmpty(); }
+    SIZE_T GetAllocatedSize() const { return Keys.GetAllocatedSize() + RawValues.size() * sizeof(FVector); }
+
+    void Compress(const TArray<FVector>& RawKeys, float MaxError, const FVector& DefaultValue);
+    FVector GetKey(int32 KeyIndex) const;
+    FVector Evaluate(float FrameTime) const;
+    /** FrameTime을 감싸는 두 키를 풀어서 반환 (배치 보간용, 상수 트랙이면 두 키가 같고 Alpha 0) */
+    void GetSegment(float FrameTime, FVector& OutKey0, FVector& OutKey1, float& OutAlpha) const;
+
+    friend FArchive& operator<<(FArchive& Ar, FCompressedVectorTrack& Track)
+    {
+        Ar << Track.RangeMin << Track.RangeExtent << Track.Keys;
+        if (Ar.IsSaving())
+        {
+            Serialization::WriteArray(Ar, Track.RawValues);
+        }
+        else if (Ar.IsLoading())
+        {
+            Serialization::ReadArray(Ar, Track.RawValues);
+        }
+        return Ar;
+    }
+};
+
+/** 회전 트랙: 가장 큰 성분을 빼고 나머지 셋을 15비트씩 저장 (인덱스 2비트 포함 48비트) */
+struct FCompressedRotationTrack
+{
+    FQuat ConstantValue = FQuat::Identity();
+    FCompressedTrackKeys Keys;
+
+    void Compress(const TArray<FQuat>& RawKeys, float MaxError);
+    FQuat GetKey(int32 KeyIndex) const;
+    FQuat Evaluate(float FrameTime) const;
+    /** FrameTime을 감싸는 두 키를 풀어서 반환 (배치 보간용, 상수 트랙이면 두 키가 같고 Alpha 0) */
+    void GetSegment(float FrameTime, FQuat& OutKey0, FQuat& OutKey1, float& OutAlpha) const;
+
+    friend FArchive& operator<<(FArchive& Ar, FCompressedRotationTrack& Track)
+    {
+        Ar << Track.ConstantValue.X << Track.ConstantValue.Y << Track.ConstantValue.Z << Track.ConstantValue.W;
+        Ar << Track.Keys;
+        return Ar;
+    }
+};
+
+/**
+ * @brief 본 하나의 압축 트랙 (FRawAnimSequenceTrack의 런타임/캐시 표현)
+ * - 상수 트랙 검출 -> 오차 한도 내 키 제거 -> 양자화 순으로 압축
+ * - 평가는 압축 데이터에서 바로 두 키만 풀어 보간 (원본 키 배열을 복원하지 않음)
+ */
+struct FCompressedAnimTrack
+{
+    FCompressedVectorTrack Translation;
+    FCompressedRotationTrack Rotation;
+    FCompressedVectorTrack Scale;
+    bool bValid = false;
+
+    void Compress(const FRawAnimSequenceTrack& RawTrack, const FAnimCompressionSettings& Settings);
+
+    /** FrameTime은 프레임 단위 시간 (Time * FrameRate) */
+    FTransform Evaluate(float FrameTime) const;
+
+    /** 원본 프레임 수만큼 다시 샘플링해 Raw 트랙으로 복원 (에디터/벤치마크용) */
+    void DecompressToRaw(int32 NumFrames, FRawAnimSequenceTrack& OutRawTrack) const;
+
+    SIZE_T GetAllocatedSize() const;
+
+    friend FArchive& operator<<(FArchive& Ar, FCompressedAnimTrack& Track)
+    {
+        Ar << Track.Translation << Track.Rotation << Track.Scale;
+        if (Ar.IsLoading())
+        {
+            Track.bValid = true;
+        }
+        return Ar;
+    }
+};
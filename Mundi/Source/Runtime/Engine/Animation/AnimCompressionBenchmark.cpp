@@ -0,0 +1,140 @@
+﻿#include "pch.h"
+#include "AnimCompressionBenchmark.h"
+#include "AnimSequence.h"
+#include "AnimDateModel.h"
+#include "PlatformTime.h"
+#include <random>
+
+namespace
+{
+	struct FClipResult
+	{
+		SIZE_T RawBytes = 0;
+		SIZE_T CompressedBytes = 0;
+		double RawMs = 0.0;
+		double CompressedMs = 0.0;
+		int64 Evaluations = 0;
+		double Checksum = 0.0;
+	};
+
+	double SumTransform(const FTransform& T)
+	{
+		return static_cast<double>(T.Translation.X + T.Rotation.W + T.Scale3D.Z);
+	}
+
+	bool MeasureClip(const UAnimDataModel* Model, int32 SamplesPerClip, std::mt19937& Rng, FClipResult& OutResult)
+	{
+		const int32 NumFrames = Model->GetNumberOfFrames();
+		const int32 FrameRate = Model->GetFrameRate();
+		if (NumFrames <= 0 || FrameRate <= 0)
+		{
+			return false;
+		}
+
+		// 원본 트랙은 임포트 때 해제되므로 압축 트랙을 프레임마다 다시 풀어 원본 레이아웃을 재구성
+		TArray<const FCompressedAnimTrack*> Compressed;
+		TArray<FRawAnimSequenceTrack> Raw;
+		for (const FBoneAnimationTrack& Track : Model->GetBoneAnimationTracks())
+		{
+			if (!Track.CompressedTrack.bValid) { continue; }
+			Compressed.Add(&Track.CompressedTrack);
+			Raw.Emplace();
+			Track.CompressedTrack.DecompressToRaw(NumFrames, Raw.Last());
+		}
+		if (Compressed.IsEmpty())
+		{
+			return false;
+		}
+
+		for (int32 i = 0; i < Compressed.Num(); ++i)
+		{
+			OutResult.RawBytes += sizeof(FRawAnimSequenceTrack) + Raw[i].GetAllocatedSize();
+			OutResult.CompressedBytes += Compressed[i]->GetAllocatedSize();
+		}
+
+		// 실제 재생처럼 프레임 사이 임의 시간 (두 경로에 같은 샘플)
+		std::uniform_real_distribution<float> Dist(0.0f, static_cast<float>(NumFrames - 1));
+		TArray<float> FrameTimes;
+		FrameTimes.Reserve(SamplesPerClip);
+		for (int32 i = 0; i < SamplesPerClip; ++i)
+		{
+			FrameTimes.Add(Dist(Rng));
+		}
+
+		uint64 Start = FPlatformTime::Cycles64();
+		for (float FrameTime : FrameTimes)
+		{
+			for (const FRawAnimSequenceTrack& Track : Raw)
+			{
+				OutResult.Checksum += SumTransform(Track.Evaluate(FrameTime));
+			}
+		}
+		OutResult.RawMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+		Start = FPlatformTime::Cycles64();
+		for (float FrameTime : FrameTimes)
+		{
+			for (const FCompressedAnimTrack* Track : Compressed)
+			{
+				OutResult.Checksum -= SumTransform(Track->Evaluate(FrameTime));
+			}
+		}
+		OutResult.CompressedMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+		OutResult.Evaluations += static_cast<int64>(FrameTimes.Num()) * Compressed.Num();
+		return true;
+	}
+
+	double NsPerEval(double Ms, int64 Evaluations)
+	{
+		return Evaluations > 0 ? Ms * 1.0e6 / static_cast<double>(Evaluations) : 0.0;
+	}
+}
+
+void FAnimCompressionBenchmark::Run(int32 SamplesPerClip)
+{
+	std::mt19937 Rng(12345);
+	FClipResult Total;
+	int32 NumClips = 0;
+
+	for (UAnimSequence* Sequence : RESOURCE.GetAll<UAnimSequence>())
+	{
+		const UAnimDataModel* Model = Sequence ? Sequence->GetDataModel() : nullptr;
+		if (!Model) { continue; }
+
+		FClipResult Clip;
+		if (!MeasureClip(Model, SamplesPerClip, Rng, Clip)) { continue; }
+
+		char Buf[512];
+		std::snprintf(Buf, sizeof(Buf),
+			"[Anim Bench] %-40s tracks=%-3d frames=%-5d | %8.1f KB -> %7.1f KB (x%.1f) | eval %6.1f -> %6.1f ns/track\r\n",
+			Sequence->ObjectName.ToString().c_str(), Model->GetNumBoneTracks(), Model->GetNumberOfFrames(),
+			static_cast<double>(Clip.RawBytes) / 1024.0, static_cast<double>(Clip.CompressedBytes) / 1024.0,
+			Clip.CompressedBytes > 0 ? static_cast<double>(Clip.RawBytes) / static_cast<double>(Clip.CompressedBytes) : 0.0,
+			NsPerEval(Clip.RawMs, Clip.Evaluations), NsPerEval(Clip.CompressedMs, Clip.Evaluations));
+		UE_LOG(Buf);
+
+		Total.RawBytes += Clip.RawBytes;
+		Total.CompressedBytes += Clip.CompressedBytes;
+		Total.RawMs += Clip.RawMs;
+		Total.CompressedMs += Clip.CompressedMs;
+		Total.Evaluations += Clip.Evaluations;
+		Total.Checksum += Clip.Checksum;
+		NumClips++;
+	}
+
+	if (NumClips == 0)
+	{
+		UE_LOG("[Anim Bench] no compressed animation loaded\r\n");
+		return;
+	}
+
+	char Buf[512];
+	std::snprintf(Buf, sizeof(Buf),
+		"[Anim Bench] total %d clips | raw %.2f MB -> compressed %.2f MB (x%.1f) | eval raw %.1f ns/track, compressed %.1f ns/track | checksum delta %.3f\r\n",
+		NumClips,
+		static_cast<double>(Total.RawBytes) / (1024.0 * 1024.0), static_cast<double>(Total.CompressedBytes) / (1024.0 * 1024.0),
+		Total.CompressedBytes > 0 ? static_cast<double>(Total.RawBytes) / static_cast<double>(Total.CompressedBytes) : 0.0,
+		NsPerEval(Total.RawMs, Total.Evaluations), NsPerEval(Total.CompressedMs, Total.Evaluations), Total.Checksum);
+	UE_LOG(Buf);
+}
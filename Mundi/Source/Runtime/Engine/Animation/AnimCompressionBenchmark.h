@@ -0,0 +1,12 @@
+﻿#pragma once
+
+/**
+ * @brief 압축 애니메이션 트랙과 원본(프레임당 FVector/FQuat/FVector) 트랙의 메모리/평가 비용 비교
+ * - 로드된 UAnimSequence마다 압축 트랙을 원본 프레임 수로 다시 풀어 같은 시간 샘플로 평가
+ * - 콘솔 명령 "BENCH ANIM"으로 실행, 결과는 UE_LOG로 출력
+ */
+class FAnimCompressionBenchmark
+{
+public:
+	static void Run(int32 SamplesPerClip = 256);
+};
@@ -76,6 +76,8 @@ bool UAnimDataModel::SetBoneTrackKeys(const FName& BoneName, const TArray<FVecto
     Track->InternalTrack.PosKeys = PosKeys;
     Track->InternalTrack.RotKeys = RotKeys;
     Track->InternalTrack.ScaleKeys = ScaleKeys;
+    // 새 키가 들어오면 이전 압축 결과는 무효 (다시 CompressTracks 할 때까지 원본으로 평가)
+    Track->CompressedTrack.bValid = false;
 
     return true;
 }
@@ -88,13 +90,20 @@ bool UAnimDataModel::GetBoneTrackTransform(const FName& BoneName, int32 KeyIndex
         return false;
     }
 
-    const FRawAnimSequenceTrack& RawTrack = Track->InternalTrack;
-
     if (KeyIndex < 0)
     {
         return false;
     }
 
+    if (Track->CompressedTrack.bValid)
+    {
+        // 키 번호 == 원본 프레임 번호 (마지막 키 이후는 마지막 키 유지)
+        OutTransform = Track->CompressedTrack.Evaluate(static_cast<float>(KeyIndex));
+        return true;
+    }
+
+    const FRawAnimSequenceTrack& RawTrack = Track->InternalTrack;
+
     FVector Position ;
     FQuat Rotation = FQuat::Identity();
     FVector Scale = FVector(1.0f,1.0f,1.0f);
@@ -143,8 +152,6 @@ FTransform UAnimDataModel::EvaluateBoneTrackTransform(const FName& BoneName, flo
         return FTransform();
     }
 
-    const FRawAnimSequenceTrack& RawTrack = Track->InternalTrack;
-
     // 시간 클램프
     float PlayLength = this->PlayLength;
     Time = FMath::Clamp(Time, 0.0f, PlayLength);
@@ -152,6 +159,75 @@ FTransform UAnimDataModel::EvaluateBoneTrackTransform(const FName& BoneName, flo
     // 시간을 프레임 번호로 변환
     float FrameTime = Time * static_cast<float>(FrameRate);
 
+    // 압축 트랙은 앞뒤 두 키만 풀어서 보간
+    if (Track->CompressedTrack.bValid)
+    {
+        return Track->CompressedTrack.Evaluate(FrameTime);
+    }
+
+    return Track->InternalTrack.Evaluate(FrameTime);
+}
+
+FAnimCompressionStats UAnimDataModel::CompressTracks(const FAnimCompressionSettings& Settings)
+{
+    FAnimCompressionStats Stats;
+
+    for (FBoneAnimationTrack& Track : BoneAnimationTracks)
+    {
+        if (Track.CompressedTrack.bValid && Track.InternalTrack.IsEmpty())
+        {
+            continue; // 이미 압축됨 (캐시에서 읽은 트랙 등)
+        }
+
+        FRawAnimSequenceTrack& RawTrack = Track.InternalTrack;
+        Track.CompressedTrack.Compress(RawTrack, Settings);
+
+        const FCompressedAnimTrack& Compressed = Track.CompressedTrack;
+        Stats.NumTracks++;
+        Stats.RawKeys += RawTrack.PosKeys.Num() + RawTrack.RotKeys.Num() + RawTrack.ScaleKeys.Num();
+        Stats.CompressedKeys += Compressed.Translation.Keys.GetNumKeys() + Compressed.Rotation.Keys.GetNumKeys() + Compressed.Scale.Keys.GetNumKeys();
+        Stats.NumConstantChannels += (Compressed.Translation.Keys.IsConstant() ? 1 : 0) + (Compressed.Rotation.Keys.IsConstant() ? 1 : 0) + (Compressed.Scale.Keys.IsConstant() ? 1 : 0);
+        Stats.RawBytes += sizeof(FRawAnimSequenceTrack) + RawTrack.GetAllocatedSize();
+        Stats.CompressedBytes += Compressed.GetAllocatedSize();
+
+        // 원본 키는 더 이상 평가에 쓰이지 않으므로 메모리까지 반환
+        TArray<FVector>().swap(RawTrack.PosKeys);
+        TArray<FQuat>().swap(RawTrack.RotKeys);
+        TArray<FVector>().swap(RawTrack.ScaleKeys);
+    }
+
+    return Stats;
+}
+
+bool UAnimDataModel::SetBoneTrackCompressed(const FName& BoneName, const FCompressedAnimTrack& CompressedTrack)
+{
+    FBoneAnimationTrack* Track = FindBoneTrack(BoneName);
+    if (!Track)
+    {
+        return false;
+    }
+
+    Track->CompressedTrack = CompressedTrack;
+    Track->CompressedTrack.bValid = true;
+    return true;
+}
+
+SIZE_T UAnimDataModel::GetTrackDataSize() const
+{
+    SIZE_T Bytes = 0;
+    for (const FBoneAnimationTrack& Track : BoneAnimationTracks)
+    {
+        Bytes += Track.InternalTrack.GetAllocatedSize();
+        if (Track.CompressedTrack.bValid)
+        {
+            Bytes += Track.CompressedTrack.GetAllocatedSize();
+        }
+    }
+    return Bytes;
+}
+
+FTransform FRawAnimSequenceTrack::Evaluate(float FrameTime) const
+{
     // 프레임 인덱스 계산 (KraftonGTL 방식)
     int32 FrameIndex0 = FMath::FloorToInt(FrameTime);
     int32 FrameIndex1 = FMath::CeilToInt(FrameTime);
@@ -160,38 +236,38 @@ FTransform UAnimDataModel::EvaluateBoneTrackTransform(const FName& BoneName, flo
     FTransform Result;
 
     // Position 보간 (Linear)
-    if (RawTrack.PosKeys.Num() > 0)
+    if (PosKeys.Num() > 0)
     {
-        int32 PosIdx0 = FMath::Clamp(FrameIndex0, 0, RawTrack.PosKeys.Num() - 1);
-        int32 PosIdx1 = FMath::Clamp(FrameIndex1, 0, RawTrack.PosKeys.Num() - 1);
+        int32 PosIdx0 = FMath::Clamp(FrameIndex0, 0, PosKeys.Num() - 1);
+        int32 PosIdx1 = FMath::Clamp(FrameIndex1, 0, PosKeys.Num() - 1);
 
-        const FVector& Pos0 = RawTrack.PosKeys[PosIdx0];
-        const FVector& Pos1 = RawTrack.PosKeys[PosIdx1];
+        const FVector& Pos0 = PosKeys[PosIdx0];
+        const FVector& Pos1 = PosKeys[PosIdx1];
 
         Result.Translation = FVector::Lerp(Pos0, Pos1, Alpha);
     }
 
     // Rotation 보간 (Slerp)
-    if (RawTrack.RotKeys.Num() > 0)
+    if (RotKeys.Num() > 0)
     {
-        int32 RotIdx0 = FMath::Clamp(FrameIndex0, 0, RawTrack.RotKeys.Num() - 1);
-        int32 RotIdx1 = FMath::Clamp(FrameIndex1, 0, RawTrack.RotKeys.Num() - 1);
+        int32 RotIdx0 = FMath::Clamp(FrameIndex0, 0, RotKeys.Num() - 1);
+        int32 RotIdx1 = FMath::Clamp(FrameIndex1, 0, RotKeys.Num() - 1);
 
-        const FQuat& Rot0 = RawTrack.RotKeys[RotIdx0];
-        const FQuat& Rot1 = RawTrack.RotKeys[RotIdx1];
+        const FQuat& Rot0 = RotKeys[RotIdx0];
+        const FQuat& Rot1 = RotKeys[RotIdx1];
 
         Result.Rotation = FQuat::Slerp(Rot0, Rot1, Alpha);
         Result.Rotation.Normalize();
     }
 
     // Scale 보간 (Linear)
-    if (RawTrack.ScaleKeys.Num() > 0)
+    if (ScaleKeys.Num() > 0)
     {
-        int32 ScaleIdx0 = FMath::Clamp(FrameIndex0, 0, RawTrack.ScaleKeys.Num() - 1);
-        int32 ScaleIdx1 = FMath::Clamp(FrameIndex1, 0, RawTrack.ScaleKeys.Num() - 1);
+        int32 ScaleIdx0 = FMath::Clamp(FrameIndex0, 0, ScaleKeys.Num() - 1);
+        int32 ScaleIdx1 = FMath::Clamp(FrameIndex1, 0, ScaleKeys.Num() - 1);
 
-        const FVector& Scale0 = RawTrack.ScaleKeys[ScaleIdx0];
-        const FVector& Scale1 = RawTrack.ScaleKeys[ScaleIdx1];
+        const FVector& Scale0 = ScaleKeys[ScaleIdx0];
+        const FVector& Scale1 = ScaleKeys[ScaleIdx1];
 
         Result.Scale3D = FVector::Lerp(Scale0, Scale1, Alpha);
     }
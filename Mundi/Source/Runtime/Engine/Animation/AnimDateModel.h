@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "Object.h"
+#include "AnimCompression.h"
 
 /**
  * @brief 애니메이션 클립이 순수 데이터 모델
@@ -16,12 +17,30 @@ struct FRawAnimSequenceTrack
     TArray<FVector> PosKeys;   // 위치 키프레임
     TArray<FQuat>   RotKeys;   // 회전 키프레임 (Quaternion)
     TArray<FVector> ScaleKeys; // 스케일 키프레임
+
+    /** FrameTime(프레임 단위 시간)의 앞뒤 키를 보간 (위치/스케일 Lerp, 회전 Slerp) */
+    FTransform Evaluate(float FrameTime) const;
+
+    bool IsEmpty() const { return PosKeys.IsEmpty() && RotKeys.IsEmpty() && ScaleKeys.IsEmpty(); }
+    SIZE_T GetAllocatedSize() const { return PosKeys.size() * sizeof(FVector) + RotKeys.size() * sizeof(FQuat) + ScaleKeys.size() * sizeof(FVector); }
 };
 
 struct FBoneAnimationTrack
 {
     FName Name;                        // Bone 이름
-    FRawAnimSequenceTrack InternalTrack; // 실제 애니메이션 데이터
+    FRawAnimSequenceTrack InternalTrack; // 실제 애니메이션 데이터 (압축 후에는 비워짐)
+    FCompressedAnimTrack CompressedTrack; // bValid면 평가는 이쪽에서 직접 수행
+};
+
+/** CompressTracks 결과 (임포트 로그/벤치마크용) */
+struct FAnimCompressionStats
+{
+    int32 NumTracks = 0;
+    int32 NumConstantChannels = 0;   // 상수로 접힌 위치/회전/스케일 채널 수
+    int32 RawKeys = 0;               // 채널별 원본 키 수 합
+    int32 CompressedKeys = 0;        // 채널별 남은 키 수 합
+    SIZE_T RawBytes = 0;
+    SIZE_T CompressedBytes = 0;
 };
 
 
@@ -64,6 +83,14 @@ public:
     // Interpolation
     FTransform EvaluateBoneTrackTransform(const FName& BoneName, float Time, bool bInterpolate = true) const;
 
+    // Compression
+    /** 모든 트랙을 압축하고 원본 키를 해제 (이후 SetBoneTrackKeys로 키를 다시 넣은 트랙은 원본으로 평가) */
+    FAnimCompressionStats CompressTracks(const FAnimCompressionSettings& Settings = FAnimCompressionSettings());
+    /** 캐시에서 읽은 압축 트랙을 그대로 설정 */
+    bool SetBoneTrackCompressed(const FName& BoneName, const FCompressedAnimTrack& CompressedTrack);
+    /** 현재 상주 중인 키 데이터 크기 (원본 + 압축) */
+    SIZE_T GetTrackDataSize() const;
+
 private:
     TArray<FBoneAnimationTrack> BoneAnimationTracks;
     float PlayLength = 0.0f;
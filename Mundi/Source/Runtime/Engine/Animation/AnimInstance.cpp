@@ -5,6 +5,7 @@
 #include "AnimationStateMachine.h"
 #include "AnimSequence.h"
 #include "AnimMontage.h"
+#include "AnimPosePool.h"
 // For notify dispatching
 #include "Source/Runtime/Engine/Animation/AnimNotify/AnimNotify.h"
 #include "Source/Runtime/Engine/GameFramework/PlayerCameraManager.h"
@@ -43,6 +44,15 @@ void UAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
     {
         AnimStateMachine->ProcessState(DeltaSeconds);
     }
+}
+
+void UAnimInstance::ParallelEvaluateAnimation(float DeltaSeconds)
+{
+    // 애니메이션이 일시정지된 경우 업데이트 스킵
+    if (bPaused)
+    {
+        return;
+    }
 
     // PoseProvider 또는 Sequence가 있어야 재생 가능
     if (!CurrentPlayState.PoseProvider && !CurrentPlayState.Sequence)
@@ -58,8 +68,9 @@ void UAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
 
     // ============================================================
     // 2. 기본 포즈 평가 (상태머신 결과)
+    // 임시 포즈는 스레드별 풀에서 빌려 쓰므로 정상 상태에서는 힙 할당이 없다
     // ============================================================
-    TArray<FTransform> BasePose;
+    FScopedPoseBuffer BasePose;
 
     const bool bIsBlending = (BlendTimeRemaining > 0.0f && (BlendTargetState.Sequence != nullptr || BlendTargetState.PoseProvider != nullptr));
 
@@ -71,8 +82,8 @@ void UAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
         float BlendAlpha = 1.0f - (BlendTimeRemaining / SafeTotalTime);
         BlendAlpha = FMath::Clamp(BlendAlpha, 0.0f, 1.0f);
 
-        TArray<FTransform> FromPose;
-        TArray<FTransform> TargetPose;
+        FScopedPoseBuffer FromPose;
+        FScopedPoseBuffer TargetPose;
         EvaluatePoseForState(CurrentPlayState, FromPose, DeltaSeconds);
         EvaluatePoseForState(BlendTargetState, TargetPose, DeltaSeconds);
 
@@ -97,28 +108,88 @@ void UAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
     // ============================================================
     // 3. 몽타주 처리 (상태머신 위에 오버레이)
     // ============================================================
-    TArray<FTransform> FinalPose = BasePose;
+    FScopedPoseBuffer MontageResultPose;
+    const TArray<FTransform>* FinalPose = &BasePose.Get();
 
     if (bMontageActive && MontageState.Montage)
     {
-        FinalPose = ProcessMontage(BasePose, DeltaSeconds);
+        ProcessMontage(BasePose, DeltaSeconds, MontageResultPose);
+        FinalPose = &MontageResultPose.Get();
     }
 
     // ============================================================
     // 4. 최종 포즈 적용
     // ============================================================
-    if (OwningComponent && FinalPose.Num() > 0)
+    if (OwningComponent && FinalPose->Num() > 0)
     {
-        OwningComponent->SetAnimationPose(FinalPose);
+        OwningComponent->SetAnimationPose(*FinalPose);
     }
 
     // ============================================================
-    // 5. 노티파이 & 커브
+    // 5. 노티파이 & 커브 (노티파이는 수집만, 실행은 DispatchQueuedAnimNotifies)
     // ============================================================
     TriggerAnimNotifies(DeltaSeconds);
     UpdateAnimationCurves();
 }
 
+void UAnimInstance::QueueAnimNotifies(const TArray<FPendingAnimNotify>& Notifies, UAnimSequence* Sequence)
+{
+    for (const FPendingAnimNotify& Pending : Notifies)
+    {
+        FQueuedAnimNotify Queued;
+        Queued.Pending = Pending;
+        Queued.Sequence = Sequence;
+        QueuedNotifies.Add(Queued);
+    }
+}
+
+void UAnimInstance::DispatchQueuedAnimNotifies()
+{
+    // 노티파이 안에서 몽타주 재생 등으로 다시 큐가 쓰일 수 있으므로 꺼내 놓고 실행
+    TArray<FQueuedAnimNotify> Notifies = std::move(QueuedNotifies);
+    QueuedNotifies.Empty();
+
+    if (!OwningComponent)
+    {
+        return;
+    }
+
+    for (const FQueuedAnimNotify& Queued : Notifies)
+    {
+        const FAnimNotifyEvent& Event = *Queued.Pending.Event;
+
+        switch (Queued.Pending.Type)
+        {
+        case EPendingNotifyType::Trigger:
+            if (Event.Notify)
+            {
+                Event.Notify->Notify(OwningComponent, Queued.Sequence);
+            }
+            break;
+        case EPendingNotifyType::StateBegin:
+            if (Event.NotifyState)
+            {
+                Event.NotifyState->NotifyBegin(OwningComponent, Queued.Sequence, Event.Duration);
+            }
+            break;
+        case EPendingNotifyType::StateTick:
+            if (Event.NotifyState)
+            {
+                Event.NotifyState->NotifyTick(OwningComponent, Queued.Sequence, Event.Duration);
+            }
+            break;
+        case EPendingNotifyType::StateEnd:
+            if (Event.NotifyState)
+            {
+                Event.NotifyState->NotifyEnd(OwningComponent, Queued.Sequence, Event.Duration);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+}
+
 
 void UAnimInstance::EvaluatePose(TArray<FTransform>& OutPose)
 {
@@ -366,60 +437,15 @@ void UAnimInstance::TriggerAnimNotifies(float DeltaSeconds)
 
     NotifySequence->GetAnimNotify(PrevTime, DeltaMove, PendingNotifies);
 
-    // 수집된 노티파이 처리
+    // 수집된 노티파이는 게임 스레드에서 실행 (DispatchQueuedAnimNotifies)
     for (const FPendingAnimNotify& Pending : PendingNotifies)
     {
         const FAnimNotifyEvent& Event = *Pending.Event;
 
         UE_LOG("AnimNotify Triggered: %s at %.2f (Type: %d)",
             Event.NotifyName.ToString().c_str(), Event.TriggerTime, (int)Pending.Type);
-
-        // Dispatch to notifies using the same policy as SkeletalMeshComponent
-        if (OwningComponent)
-        {
-            switch (Pending.Type)
-            {
-            case EPendingNotifyType::Trigger:
-                if (Event.Notify)
-                {
-                    Event.Notify->Notify(OwningComponent, NotifySequence);
-                }
-                break;
-            case EPendingNotifyType::StateBegin:
-                if (Event.NotifyState)
-                {
-                    Event.NotifyState->NotifyBegin(OwningComponent, NotifySequence, Event.Duration);
-                }
-                break;
-            case EPendingNotifyType::StateTick:
-                if (Event.NotifyState)
-                {
-                    Event.NotifyState->NotifyTick(OwningComponent, NotifySequence, Event.Duration);
-                }
-                break;
-            case EPendingNotifyType::StateEnd:
-                if (Event.NotifyState)
-                {
-                    Event.NotifyState->NotifyEnd(OwningComponent, NotifySequence, Event.Duration);
-                }
-                break;
-            default:
-                break;
-            }
-        }
-
-        // TODO: 노티파이 타입별 처리
-        // switch (Pending.Type)
-        // {
-        //     case EAnimNotifyEventType::Begin:
-        //         // 노티파이 시작
-        //         break;
-        //     case EAnimNotifyEventType::End:
-        //         // 노티파이 종료
-        //         break;
-        // }
     }
-
+    QueueAnimNotifies(PendingNotifies, NotifySequence);
 }
 
 void UAnimInstance::UpdateAnimationCurves()
@@ -488,11 +514,12 @@ void UAnimInstance::EvaluatePoseForState(const FAnimationPlayState& PlayState, T
     const int32 NumBones = DataModel->GetNumBoneTracks();
     OutPose.SetNum(NumBones);
 
+    // 호출자 버퍼에 바로 평가 (임시 포즈 배열 없이)
     FAnimExtractContext ExtractContext(PlayState.CurrentTime, PlayState.bIsLooping);
-    FPoseContext PoseContext(NumBones);
+    FPoseContext PoseContext;
+    PoseContext.Pose.swap(OutPose);
     PlayState.Sequence->GetAnimationPose(PoseContext, ExtractContext);
-
-    OutPose = PoseContext.Pose;
+    OutPose.swap(PoseContext.Pose);
 }
 
 void UAnimInstance::AdvancePlayState(FAnimationPlayState& PlayState, float DeltaSeconds)
@@ -611,15 +638,15 @@ void UAnimInstance::GetPoseForLayer(int32 LayerIndex, TArray<FTransform>& OutPos
         float BlendAlpha = 1.0f - (BlendTimeRemaining / SafeTotalTime);
         BlendAlpha = FMath::Clamp(BlendAlpha, 0.0f, 1.0f);
 
-        TArray<FTransform> FromPose;
-        TArray<FTransform> TargetPose;
+        FScopedPoseBuffer FromPose;
+        FScopedPoseBuffer TargetPose;
         EvaluatePoseForState(CurrentPlayState, FromPose, DeltaSeconds);
         EvaluatePoseForState(BlendTargetState, TargetPose, DeltaSeconds);
 
-        TArray<FTransform> BlendedPose;
+        FScopedPoseBuffer BlendedPose;
         BlendPoseArrays(FromPose, TargetPose, BlendAlpha, BlendedPose);
 
-        if (OwningComponent && BlendedPose.Num() > 0)
+        if (OwningComponent && BlendedPose.Get().Num() > 0)
         {
             OwningComponent->SetAnimationPose(BlendedPose);
         }
@@ -637,10 +664,10 @@ void UAnimInstance::GetPoseForLayer(int32 LayerIndex, TArray<FTransform>& OutPos
     }
     else if (OwningComponent)
     {
-        TArray<FTransform> Pose;
+        FScopedPoseBuffer Pose;
         EvaluatePoseForState(CurrentPlayState, Pose, DeltaSeconds);
 
-        if (Pose.Num() > 0)
+        if (Pose.Get().Num() > 0)
         {
             OwningComponent->SetAnimationPose(Pose);
         }
@@ -760,28 +787,28 @@ void UAnimInstance::Montage_SetPlayRate(float NewPlayRate)
     }
 }
 
-TArray<FTransform> UAnimInstance::ProcessMontage(const TArray<FTransform>& BasePose, float DeltaSeconds)
+void UAnimInstance::ProcessMontage(const TArray<FTransform>& BasePose, float DeltaSeconds, TArray<FTransform>& OutPose)
 {
-    TArray<FTransform> Result = BasePose;
+    OutPose = BasePose;
 
     if (!MontageState.bIsPlaying || !MontageState.Montage)
     {
         bMontageActive = false;
-        return Result;
+        return;
     }
 
     UAnimSequence* SourceSequence = MontageState.Montage->GetSourceSequence();
     if (!SourceSequence)
     {
         bMontageActive = false;
-        return Result;
+        return;
     }
 
     float PlayLength = MontageState.Montage->GetPlayLength();
     if (PlayLength <= 0.0f)
     {
         bMontageActive = false;
-        return Result;
+        return;
     }
 
     // ============================================================
@@ -810,42 +837,7 @@ TArray<FTransform> UAnimInstance::ProcessMontage(const TArray<FTransform>& BaseP
     float DeltaMove = DeltaSeconds * MontageState.PlayRate;
     TArray<FPendingAnimNotify> PendingNotifies;
     MontageState.Montage->GetAnimNotifiesInRange(MontageState.PreviousTime, DeltaMove, PendingNotifies);
-
-    for (const FPendingAnimNotify& Pending : PendingNotifies)
-    {
-        const FAnimNotifyEvent& Event = *Pending.Event;
-
-        if (OwningComponent)
-        {
-            switch (Pending.Type)
-            {
-            case EPendingNotifyType::Trigger:
-                if (Event.Notify)
-                {
-                    Event.Notify->Notify(OwningComponent, SourceSequence);
-                }
-                break;
-            case EPendingNotifyType::StateBegin:
-                if (Event.NotifyState)
-                {
-                    Event.NotifyState->NotifyBegin(OwningComponent, SourceSequence, Event.Duration);
-                }
-                break;
-            case EPendingNotifyType::StateTick:
-                if (Event.NotifyState)
-                {
-                    Event.NotifyState->NotifyTick(OwningComponent, SourceSequence, Event.Duration);
-                }
-                break;
-            case EPendingNotifyType::StateEnd:
-                if (Event.NotifyState)
-                {
-                    Event.NotifyState->NotifyEnd(OwningComponent, SourceSequence, Event.Duration);
-                }
-                break;
-            }
-        }
-    }
+    QueueAnimNotifies(PendingNotifies, SourceSequence);
 
     // ============================================================
     // 가중치 계산 (블렌드 인/아웃)
@@ -879,7 +871,8 @@ TArray<FTransform> UAnimInstance::ProcessMontage(const TArray<FTransform>& BaseP
     // ============================================================
     // 몽타주 포즈 평가 (원본 시퀀스에서)
     // ============================================================
-    TArray<FTransform> MontagePose;
+    FScopedPoseBuffer MontagePoseBuffer;
+    TArray<FTransform>& MontagePose = MontagePoseBuffer;
 
     UAnimDataModel* DataModel = SourceSequence->GetDataModel();
     if (DataModel && BasePose.Num() > 0)
@@ -891,9 +884,10 @@ TArray<FTransform> UAnimInstance::ProcessMontage(const TArray<FTransform>& BaseP
         float MaxEvalTime = (MontageState.EffectivePlayLength > 0.0f) ? MontageState.EffectivePlayLength : PlayLength;
         float PoseEvalTime = MontageState.bIsLooping ? MontageState.CurrentTime : FMath::Min(MontageState.CurrentTime, MaxEvalTime);
         FAnimExtractContext Context(PoseEvalTime, MontageState.bIsLooping);
-        FPoseContext PoseContext(NumBones);
+        FPoseContext PoseContext;
+        PoseContext.Pose.swap(MontagePose);
         SourceSequence->GetAnimationPose(PoseContext, Context);
-        MontagePose = PoseContext.Pose;
+        MontagePose.swap(PoseContext.Pose);
     }
 
     // ============================================================
@@ -906,24 +900,24 @@ TArray<FTransform> UAnimInstance::ProcessMontage(const TArray<FTransform>& BaseP
         {
             // 상체만 몽타주 적용, 하체는 BasePose 유지
             const int32 NumBones = FMath::Min(FMath::Min(BasePose.Num(), MontagePose.Num()), UpperBodyMask.Num());
-            Result.SetNum(BasePose.Num());
+            OutPose.SetNum(BasePose.Num());
 
             for (int32 i = 0; i < BasePose.Num(); ++i)
             {
                 if (i < NumBones && UpperBodyMask[i])  // 상체 본
                 {
-                    Result[i] = FTransform::Lerp(BasePose[i], MontagePose[i], MontageState.CurrentWeight);
+                    OutPose[i] = FTransform::Lerp(BasePose[i], MontagePose[i], MontageState.CurrentWeight);
                 }
                 else  // 하체 본 - 스테이트머신 포즈 유지
                 {
-                    Result[i] = BasePose[i];
+                    OutPose[i] = BasePose[i];
                 }
             }
         }
         else
         {
             // 기존 전신 블렌딩
-            BlendPoseArrays(BasePose, MontagePose, MontageState.CurrentWeight, Result);
+            BlendPoseArrays(BasePose, MontagePose, MontageState.CurrentWeight, OutPose);
         }
     }
 
@@ -960,6 +954,4 @@ TArray<FTransform> UAnimInstance::ProcessMontage(const TArray<FTransform>& BaseP
 
         UE_LOG("Montage finished: %s (RootMotion disabled)", MontageState.Montage->ObjectName.ToString().c_str());
     }
-
-    return Result;
 }
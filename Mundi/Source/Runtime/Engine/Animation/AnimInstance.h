@@ -144,7 +144,7 @@ struct FMontagePlayState
  * AnimInstance->SetStateMachine(StateMachine);
  *
  * // 7. 게임플레이 루프에서 파라미터 업데이트
- * // (TickComponent는 자동으로 AnimInstance->NativeUpdateAnimation 호출)
+ * // (TickComponent가 AnimInstance->NativeUpdateAnimation 호출, 포즈 평가는 UWorld의 애니메이션 단계에서 병렬로 수행)
  * AnimInstance->SetMovementSpeed(PlayerVelocity.Length());
  * AnimInstance->SetIsMoving(PlayerVelocity.Length() > 0.1f);
  */
@@ -180,11 +180,25 @@ public:
     // ============================================================
 
     /**
-     * @brief 애니메이션 업데이트 (매 프레임 호출)
+     * @brief 애니메이션 업데이트 (매 프레임 게임 스레드에서 호출)
+     * 파라미터/상태머신 전이만 처리하고, 포즈 평가는 ParallelEvaluateAnimation에서 수행
      * @param DeltaSeconds 프레임 시간
      */
     virtual void NativeUpdateAnimation(float DeltaSeconds);
 
+    /**
+     * @brief 포즈 평가 (워커 스레드에서 호출될 수 있음)
+     * 재생 시간 진행, 블렌드, 몽타주 합성 후 소유 컴포넌트에 포즈를 적용한다.
+     * 이 인스턴스와 소유 컴포넌트만 수정하며, 노티파이는 실행하지 않고 큐에 모아 둔다.
+     * @param DeltaSeconds 프레임 시간
+     */
+    void ParallelEvaluateAnimation(float DeltaSeconds);
+
+    /**
+     * @brief ParallelEvaluateAnimation에서 모아 둔 노티파이 실행 (게임 스레드)
+     */
+    void DispatchQueuedAnimNotifies();
+
     /**
      * @brief 현재 포즈를 평가하여 반환
      * @param OutPose 출력 포즈
@@ -263,7 +277,7 @@ public:
     // ============================================================
 
     /**
-     * @brief 애니메이션 노티파이 트리거
+     * @brief 이번 프레임 구간의 애니메이션 노티파이를 수집해 큐에 추가
      * @param DeltaSeconds 프레임 시간
      */
     void TriggerAnimNotifies(float DeltaSeconds);
@@ -428,8 +442,11 @@ protected:
     void BlendPoseArrays(const TArray<FTransform>& FromPose, const TArray<FTransform>& ToPose, float Alpha, TArray<FTransform>& OutPose) const;
     void GetPoseForLayer(int32 LayerIndex, TArray<FTransform>& OutPose, float DeltaSeconds);
 
-    // 몽타주 헬퍼
-    TArray<FTransform> ProcessMontage(const TArray<FTransform>& BasePose, float DeltaSeconds);
+    // 몽타주 헬퍼 (BasePose 위에 몽타주를 합성해 호출자 버퍼 OutPose에 기록, OutPose는 BasePose와 달라야 함)
+    void ProcessMontage(const TArray<FTransform>& BasePose, float DeltaSeconds, TArray<FTransform>& OutPose);
+
+    // 노티파이 헬퍼 (실행은 DispatchQueuedAnimNotifies에서 게임 스레드로)
+    void QueueAnimNotifies(const TArray<FPendingAnimNotify>& Notifies, UAnimSequence* Sequence);
 
     // 소유 컴포넌트
     USkeletalMeshComponent* OwningComponent = nullptr;
@@ -485,6 +502,19 @@ protected:
 
     /** 몽타주가 활성화되어 있는지 여부 */
     bool bMontageActive = false;
+
+    // ============================================================
+    // Notify Queue
+    // ============================================================
+
+    struct FQueuedAnimNotify
+    {
+        FPendingAnimNotify Pending;
+        UAnimSequence* Sequence = nullptr;
+    };
+
+    /** 포즈 평가 중 수집한 노티파이 (수집 순서대로 실행) */
+    TArray<FQueuedAnimNotify> QueuedNotifies;
     public:
     /** 애니메이션 일시정지 여부 (AnimNotify_PauseAnimation에서 사용) */
     bool bPaused = false;
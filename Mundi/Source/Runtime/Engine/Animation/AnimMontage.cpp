@@ -23,6 +23,7 @@ void UAnimMontage::SetSourceSequence(UAnimSequence* InSequence)
     {
         // SourceSequence의 노티파이를 몽타주에 복사
         MontageNotifies = SourceSequence->GetAnimNotifyEvents();
+        NotifyTimeIndex.Invalidate();
 
         UE_LOG("UAnimMontage::SetSourceSequence - Set source: %s (Notifies: %d)",
             SourceSequence->ObjectName.ToString().c_str(), MontageNotifies.Num());
@@ -58,6 +59,7 @@ void UAnimMontage::AddNotify(float TriggerTime, UAnimNotify* Notify, FName Notif
     Event.NotifyName = NotifyName;
 
     MontageNotifies.Add(Event);
+    NotifyTimeIndex.Invalidate();
 
     UE_LOG("UAnimMontage::AddNotify - Added notify '%s' at %.2f",
         NotifyName.ToString().c_str(), TriggerTime);
@@ -79,6 +81,7 @@ void UAnimMontage::AddNotifyState(float TriggerTime, float Duration, UAnimNotify
     Event.NotifyName = NotifyName;
 
     MontageNotifies.Add(Event);
+    NotifyTimeIndex.Invalidate();
 
     UE_LOG("UAnimMontage::AddNotifyState - Added notify state '%s' at %.2f (Duration: %.2f)",
         NotifyName.ToString().c_str(), TriggerTime, Duration);
@@ -87,6 +90,7 @@ void UAnimMontage::AddNotifyState(float TriggerTime, float Duration, UAnimNotify
 void UAnimMontage::ClearNotifies()
 {
     MontageNotifies.Empty();
+    NotifyTimeIndex.Invalidate();
     UE_LOG("UAnimMontage::ClearNotifies - Cleared all notifies");
 }
 
@@ -102,7 +106,11 @@ void UAnimMontage::GetAnimNotifiesInRange(float StartTime, float DeltaTime, TArr
     const float MinTime = StartTime;
     const float MaxTime = StartTime + DeltaTime;
 
-    for (int32 i = 0; i < MontageNotifies.Num(); ++i)
+    // 시간 인덱스로 구간에 걸리는 후보만 판정
+    thread_local TArray<int32> CandidateIndices;
+    NotifyTimeIndex.Query(MontageNotifies, MinTime, MaxTime, CandidateIndices);
+
+    for (int32 i : CandidateIndices)
     {
         const FAnimNotifyEvent& Event = MontageNotifies[i];
 
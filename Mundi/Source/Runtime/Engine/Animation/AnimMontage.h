@@ -1,6 +1,7 @@
 #pragma once
 #include "Object.h"
 #include "AnimTypes.h"
+#include "AnimNotifyIndex.h"
 
 class UAnimSequence;
 class UAnimNotify;
@@ -85,7 +86,7 @@ public:
     /**
      * @brief 노티파이 배열 반환 (수정 가능)
      */
-    TArray<FAnimNotifyEvent>& GetNotifies() { return MontageNotifies; }
+    TArray<FAnimNotifyEvent>& GetNotifies() { NotifyTimeIndex.Invalidate(); return MontageNotifies; }
 
     /**
      * @brief 시간 범위 내의 노티파이 수집
@@ -101,4 +102,7 @@ protected:
 
     /** 몽타주 전용 노티파이 배열 (원본과 독립) */
     TArray<FAnimNotifyEvent> MontageNotifies;
+
+    /** MontageNotifies 시간 인덱스 (범위 질의용) */
+    FAnimNotifyIndex NotifyTimeIndex;
 };
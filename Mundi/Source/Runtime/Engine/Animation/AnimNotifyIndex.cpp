@@ -0,0 +1,88 @@
+﻿#include "pch.h"
+#include "AnimNotifyIndex.h"
+#include "AnimTypes.h"
+#include <algorithm>
+
+void FAnimNotifyIndex::EnsureBuilt(const TArray<FAnimNotifyEvent>& Notifies) const
+{
+	if (bValid.load(std::memory_order_acquire) && NumIndexed == Notifies.Num())
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> Lock(BuildMutex);
+	if (bValid.load(std::memory_order_relaxed) && NumIndexed == Notifies.Num())
+	{
+		return;
+	}
+
+	Triggers.Empty();
+	StateBegins.Empty();
+	StateMaxEnds.Empty();
+
+	for (int32 NotifyIndex = 0; NotifyIndex < Notifies.Num(); ++NotifyIndex)
+	{
+		const FAnimNotifyEvent& Event = Notifies[NotifyIndex];
+		if (Event.IsSingleShot())
+		{
+			Triggers.Add({ Event.GetTriggerTime(), NotifyIndex });
+		}
+		else if (Event.IsState())
+		{
+			StateBegins.Add({ Event.GetTriggerTime(), NotifyIndex });
+		}
+	}
+
+	// 같은 시간이면 원래 순서 유지
+	auto ByTime = [](const FEntry& A, const FEntry& B)
+	{
+		return (A.Time < B.Time) || (A.Time == B.Time && A.NotifyIndex < B.NotifyIndex);
+	};
+	std::sort(Triggers.begin(), Triggers.end(), ByTime);
+	std::sort(StateBegins.begin(), StateBegins.end(), ByTime);
+
+	StateMaxEnds.SetNum(StateBegins.Num());
+	float MaxEnd = -FLT_MAX;
+	for (int32 i = 0; i < StateBegins.Num(); ++i)
+	{
+		MaxEnd = FMath::Max(MaxEnd, Notifies[StateBegins[i].NotifyIndex].GetEndTriggerTime());
+		StateMaxEnds[i] = MaxEnd;
+	}
+
+	NumIndexed = Notifies.Num();
+	bValid.store(true, std::memory_order_release);
+}
+
+void FAnimNotifyIndex::Query(const TArray<FAnimNotifyEvent>& Notifies, float MinTime, float MaxTime, TArray<int32>& OutIndices) const
+{
+	OutIndices.Empty();
+	if (Notifies.Num() == 0)
+	{
+		return;
+	}
+
+	EnsureBuilt(Notifies);
+
+	// 싱글샷: (MinTime, MaxTime]
+	auto TriggerIt = std::upper_bound(Triggers.begin(), Triggers.end(), MinTime,
+		[](float Time, const FEntry& Entry) { return Time < Entry.Time; });
+	for (; TriggerIt != Triggers.end() && TriggerIt->Time <= MaxTime; ++TriggerIt)
+	{
+		OutIndices.Add(TriggerIt->NotifyIndex);
+	}
+
+	// 상태: 앞쪽 끝 시간 최댓값이 MinTime 이하인 상태들은 모두 이미 끝났으므로 건너뛰고,
+	// 시작 시간이 MaxTime을 넘을 때까지 순회하면서 끝 시간이 MinTime 이하인 것만 거른다
+	const int32 FirstState = static_cast<int32>(std::upper_bound(StateMaxEnds.begin(), StateMaxEnds.end(), MinTime) - StateMaxEnds.begin());
+	for (int32 i = FirstState; i < StateBegins.Num() && StateBegins[i].Time <= MaxTime; ++i)
+	{
+		const int32 NotifyIndex = StateBegins[i].NotifyIndex;
+		if (Notifies[NotifyIndex].GetEndTriggerTime() > MinTime)
+		{
+			OutIndices.Add(NotifyIndex);
+		}
+	}
+
+	// 호출하는 쪽이 기존과 같은 순서로 노티파이를 내보내도록 원래 배열 순서로 정렬 (후보 수만큼만)
+	std::sort(OutIndices.begin(), OutIndices.end());
+}
@@ -0,0 +1,50 @@
+﻿#pragma once
+#include <atomic>
+#include <mutex>
+
+struct FAnimNotifyEvent;
+
+/**
+ * @brief 노티파이 배열의 시간 인덱스 (범위 질의를 이진 탐색 + 연속 구간 순회로 처리)
+ * - 싱글샷은 TriggerTime 순, 상태 노티파이는 시작 시간 순 배열에 앞쪽 끝 시간 최댓값을 같이 둔다
+ * - 노티파이 배열이 바뀌면 Invalidate()를 호출하고, 다음 질의 때 다시 만든다 (개수가 달라진 것도 감지)
+ * - 같은 에셋을 여러 워커 스레드가 동시에 질의해도 빌드는 한 번만 일어난다
+ * - 복사본은 원본 인덱스를 가져가지 않고 다음 질의 때 새로 빌드 (UObject Duplicate 대응)
+ */
+class FAnimNotifyIndex
+{
+public:
+	FAnimNotifyIndex() = default;
+	FAnimNotifyIndex(const FAnimNotifyIndex&) {}
+	FAnimNotifyIndex& operator=(const FAnimNotifyIndex&) { Invalidate(); return *this; }
+
+	void Invalidate() { bValid.store(false, std::memory_order_release); }
+
+	/**
+	 * @brief 구간에 걸리는 노티파이 후보의 인덱스를 원래 배열 순서대로 반환
+	 * - 싱글샷: MinTime < TriggerTime <= MaxTime
+	 * - 상태: 시작 <= MaxTime && 끝 > MinTime (구간과 겹침)
+	 * Begin/Tick/End 판정은 호출하는 쪽 규칙대로 후보에 대해서만 다시 한다.
+	 */
+	void Query(const TArray<FAnimNotifyEvent>& Notifies, float MinTime, float MaxTime, TArray<int32>& OutIndices) const;
+
+private:
+	struct FEntry
+	{
+		float Time = 0.0f;
+		int32 NotifyIndex = 0;
+	};
+
+	void EnsureBuilt(const TArray<FAnimNotifyEvent>& Notifies) const;
+
+	/** 싱글샷, TriggerTime 순 */
+	mutable TArray<FEntry> Triggers;
+	/** 상태, 시작 시간 순 */
+	mutable TArray<FEntry> StateBegins;
+	/** StateBegins[0..i]의 끝 시간 최댓값. 단조 증가라서 MinTime에 아직 안 끝났을 수 있는 첫 상태를 이진 탐색으로 찾는다 */
+	mutable TArray<float> StateMaxEnds;
+
+	mutable int32 NumIndexed = 0;
+	mutable std::atomic<bool> bValid{ false };
+	mutable std::mutex BuildMutex;
+};
@@ -0,0 +1,73 @@
+﻿#include "pch.h"
+#include "AnimPoseCache.h"
+
+FAnimPoseCache& FAnimPoseCache::Get()
+{
+	static FAnimPoseCache Instance;
+	return Instance;
+}
+
+void FAnimPoseCache::BeginFrame()
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+
+	LastFrameStats.Hits = Hits.exchange(0, std::memory_order_relaxed);
+	LastFrameStats.Misses = Misses.exchange(0, std::memory_order_relaxed);
+	LastFrameStats.NumEntries = static_cast<uint32>(NumUsedPoses);
+
+	// 버킷/포즈 배열 용량은 유지하고 내용만 비움
+	Entries.clear();
+	NumUsedPoses = 0;
+}
+
+int64 FAnimPoseCache::QuantizeTime(float& InOutTime) const
+{
+	const float Step = Settings.TimeQuantization;
+	if (Step > 0.0f)
+	{
+		const int64 Index = static_cast<int64>(std::floor(InOutTime / Step + 0.5f));
+		InOutTime = static_cast<float>(Index) * Step;
+		return Index;
+	}
+
+	// 양자화하지 않으면 시간 비트 그대로 비교
+	uint32 Bits = 0;
+	std::memcpy(&Bits, &InOutTime, sizeof(Bits));
+	return static_cast<int64>(Bits);
+}
+
+const TArray<FTransform>* FAnimPoseCache::Find(const UAnimSequence* Sequence, int64 TimeKey)
+{
+	const TArray<FTransform>* Result = nullptr;
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		auto It = Entries.find(FAnimPoseCacheKey{ Sequence, TimeKey });
+		if (It != Entries.end())
+		{
+			Result = It->second;
+		}
+	}
+
+	(Result ? Hits : Misses).fetch_add(1, std::memory_order_relaxed);
+	return Result;
+}
+
+void FAnimPoseCache::Add(const UAnimSequence* Sequence, int64 TimeKey, const TArray<FTransform>& TrackPose)
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+
+	auto Result = Entries.try_emplace(FAnimPoseCacheKey{ Sequence, TimeKey }, nullptr);
+	if (!Result.second)
+	{
+		return;
+	}
+
+	if (NumUsedPoses == PosePool.Num())
+	{
+		PosePool.Emplace(std::make_unique<TArray<FTransform>>());
+	}
+
+	TArray<FTransform>& Pose = *PosePool[NumUsedPoses++];
+	Pose = TrackPose;
+	Result.first->second = &Pose;
+}
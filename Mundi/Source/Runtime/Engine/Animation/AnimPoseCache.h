@@ -0,0 +1,109 @@
+﻿#pragma once
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+class UAnimSequence;
+
+/**
+ * @brief 공유 포즈 캐시 설정
+ * - TimeQuantization(초)이 0보다 크면 샘플 시간을 그 간격으로 반올림해서 같은 칸의 평가를 하나로 합친다
+ * - 0이면 시간이 정확히 같은 샘플끼리만 공유 (기본값, 포즈가 바뀌지 않음. 군중처럼 샘플을 합쳐도 되는 게임만 켤 것)
+ * - 콘솔 명령 "ANIM POSECACHE ON/OFF", "ANIM POSECACHE QUANT <ms>"
+ */
+struct FAnimPoseCacheSettings
+{
+	bool bEnabled = true;
+	float TimeQuantization = 0.0f;
+};
+
+/** 한 프레임 동안의 캐시 조회 결과 */
+struct FAnimPoseCacheStats
+{
+	uint32 Hits = 0;
+	uint32 Misses = 0;
+	uint32 NumEntries = 0;
+
+	float GetHitRate() const
+	{
+		const uint32 Total = Hits + Misses;
+		return Total > 0 ? static_cast<float>(Hits) / static_cast<float>(Total) : 0.0f;
+	}
+};
+
+/** (시퀀스, 양자화된 시간) 키 */
+struct FAnimPoseCacheKey
+{
+	const UAnimSequence* Sequence = nullptr;
+	int64 TimeKey = 0;
+
+	bool operator==(const FAnimPoseCacheKey& Other) const
+	{
+		return Sequence == Other.Sequence && TimeKey == Other.TimeKey;
+	}
+};
+
+namespace std
+{
+	template<>
+	struct hash<FAnimPoseCacheKey>
+	{
+		size_t operator()(const FAnimPoseCacheKey& Key) const
+		{
+			size_t Seed = hash<const void*>()(Key.Sequence);
+			Seed ^= hash<int64>()(Key.TimeKey) + 0x9e3779b9 + (Seed << 6) + (Seed >> 2);
+			return Seed;
+		}
+	};
+}
+
+/**
+ * @brief 프레임 단위 공유 포즈 캐시
+ * 같은 시퀀스를 같은(양자화된) 시간에 평가하는 컴포넌트가 여럿이면 한 번만 샘플링하고 나머지는 결과를 복사해 간다.
+ * - 저장하는 포즈는 트랙 인덱스 순서라 스켈레톤과 무관하다 (본 인덱스 재배치는 시퀀스의 트랙 -> 본 표로 조회 후에 적용)
+ * - 등록된 포즈는 읽기 전용이고 BeginFrame 전까지 유효, Find/Add는 워커 스레드에서 동시에 호출해도 안전
+ * - BeginFrame은 게임 스레드에서 월드 Tick 전에 호출 (포즈 배열은 다음 프레임에 재사용)
+ */
+class FAnimPoseCache
+{
+public:
+	static FAnimPoseCache& Get();
+
+	FAnimPoseCacheSettings& GetSettings() { return Settings; }
+	bool IsEnabled() const { return Settings.bEnabled; }
+
+	/** 프레임 시작: 지난 프레임 통계를 보관하고 캐시를 비움 */
+	void BeginFrame();
+
+	/**
+	 * 샘플 시간을 양자화하고 캐시 키로 쓸 시간 값을 반환
+	 * @param InOutTime 양자화된 시간으로 바뀜 (미스일 때 이 시간으로 평가해야 공유 결과가 일치한다)
+	 */
+	int64 QuantizeTime(float& InOutTime) const;
+
+	/** 히트면 트랙 순서 포즈, 미스면 nullptr */
+	const TArray<FTransform>* Find(const UAnimSequence* Sequence, int64 TimeKey);
+
+	/** 평가한 포즈 등록 (다른 스레드가 먼저 등록했으면 먼저 것을 유지) */
+	void Add(const UAnimSequence* Sequence, int64 TimeKey, const TArray<FTransform>& TrackPose);
+
+	/** 직전 프레임 통계 (오버레이 표시용) */
+	const FAnimPoseCacheStats& GetLastFrameStats() const { return LastFrameStats; }
+
+private:
+	FAnimPoseCache() = default;
+	FAnimPoseCache(const FAnimPoseCache&) = delete;
+	FAnimPoseCache& operator=(const FAnimPoseCache&) = delete;
+
+	FAnimPoseCacheSettings Settings;
+
+	std::mutex Mutex;
+	TMap<FAnimPoseCacheKey, const TArray<FTransform>*> Entries;
+	/** 포즈 저장소 (주소가 바뀌지 않도록 개별 할당, 프레임마다 앞에서부터 재사용) */
+	TArray<std::unique_ptr<TArray<FTransform>>> PosePool;
+	int32 NumUsedPoses = 0;
+
+	std::atomic<uint32> Hits{ 0 };
+	std::atomic<uint32> Misses{ 0 };
+	FAnimPoseCacheStats LastFrameStats;
+};
@@ -0,0 +1,50 @@
+﻿#include "pch.h"
+#include "AnimPosePool.h"
+
+std::atomic<uint32> FAnimPosePool::FrameAllocations{ 0 };
+std::atomic<uint64> FAnimPosePool::TotalAllocations{ 0 };
+std::atomic<uint32> FAnimPosePool::NumBuffers{ 0 };
+uint32 FAnimPosePool::LastFrameAllocations = 0;
+
+FAnimPosePool& FAnimPosePool::GetThreadPool()
+{
+	thread_local FAnimPosePool Pool;
+	return Pool;
+}
+
+TArray<FTransform>& FAnimPosePool::Acquire()
+{
+	if (NumInUse == Buffers.Num())
+	{
+		Buffers.Emplace(std::make_unique<TArray<FTransform>>());
+		NumBuffers.fetch_add(1, std::memory_order_relaxed);
+		CountAllocation();
+	}
+
+	TArray<FTransform>& Buffer = *Buffers[NumInUse++];
+	Buffer.Empty();
+	return Buffer;
+}
+
+void FAnimPosePool::Release(TArray<FTransform>& Buffer, SIZE_T CapacityAtAcquire)
+{
+	assert(NumInUse > 0 && Buffers[NumInUse - 1].get() == &Buffer && "FScopedPoseBuffer는 빌린 순서의 역순으로 반환해야 함");
+
+	// 빌려 쓰는 동안 용량이 늘었으면 재할당이 한 번 이상 있었던 것
+	if (Buffer.capacity() > CapacityAtAcquire)
+	{
+		CountAllocation();
+	}
+	--NumInUse;
+}
+
+void FAnimPosePool::BeginFrame()
+{
+	LastFrameAllocations = FrameAllocations.exchange(0, std::memory_order_relaxed);
+}
+
+void FAnimPosePool::CountAllocation()
+{
+	FrameAllocations.fetch_add(1, std::memory_order_relaxed);
+	TotalAllocations.fetch_add(1, std::memory_order_relaxed);
+}
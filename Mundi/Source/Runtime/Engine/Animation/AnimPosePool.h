@@ -0,0 +1,76 @@
+﻿#pragma once
+#include <atomic>
+#include <memory>
+
+/**
+ * @brief 애니메이션 평가용 임시 포즈 버퍼 풀 (스레드별 스택)
+ * - 블렌드/몽타주/레이어 평가 중 잠깐 쓰는 포즈 배열을 매번 새로 만들지 않고 빌려 쓴다
+ * - 버퍼는 FScopedPoseBuffer가 스코프 순서(LIFO)대로 빌리고 돌려주며, 돌려받아도 용량은 유지
+ * - 워커 스레드마다 풀이 따로 있으므로 잠금이 없다
+ * - 새 버퍼 생성/용량 증가를 힙 할당으로 세어 정상 상태에서 프레임당 0인지 확인할 수 있다
+ */
+class FAnimPosePool
+{
+public:
+	/** 호출한 스레드의 풀 */
+	static FAnimPosePool& GetThreadPool();
+
+	TArray<FTransform>& Acquire();
+	void Release(TArray<FTransform>& Buffer, SIZE_T CapacityAtAcquire);
+
+	/** 프레임 시작 (게임 스레드): 지난 프레임 할당 수를 보관하고 카운터 리셋 */
+	static void BeginFrame();
+
+	/** 직전 프레임 동안 풀 버퍼 때문에 생긴 힙 할당 수 (새 버퍼 + 용량 증가) */
+	static uint32 GetLastFrameAllocations() { return LastFrameAllocations; }
+	/** 시작 후 누적 힙 할당 수 */
+	static uint64 GetTotalAllocations() { return TotalAllocations.load(std::memory_order_relaxed); }
+	/** 모든 스레드 풀에 만들어진 버퍼 수 */
+	static uint32 GetNumBuffers() { return NumBuffers.load(std::memory_order_relaxed); }
+
+private:
+	FAnimPosePool() = default;
+	FAnimPosePool(const FAnimPosePool&) = delete;
+	FAnimPosePool& operator=(const FAnimPosePool&) = delete;
+
+	static void CountAllocation();
+
+	TArray<std::unique_ptr<TArray<FTransform>>> Buffers;
+	int32 NumInUse = 0;
+
+	static std::atomic<uint32> FrameAllocations;
+	static std::atomic<uint64> TotalAllocations;
+	static std::atomic<uint32> NumBuffers;
+	static uint32 LastFrameAllocations;
+};
+
+/**
+ * @brief 스코프 동안 풀에서 포즈 버퍼 하나를 빌림
+ * 내용은 이전에 쓰던 값이 남아 있을 수 있으므로 쓰는 쪽에서 SetNum/대입으로 채운다.
+ */
+class FScopedPoseBuffer
+{
+public:
+	FScopedPoseBuffer()
+		: Pool(FAnimPosePool::GetThreadPool())
+		, Buffer(Pool.Acquire())
+		, CapacityAtAcquire(Buffer.capacity())
+	{
+	}
+
+	~FScopedPoseBuffer()
+	{
+		Pool.Release(Buffer, CapacityAtAcquire);
+	}
+
+	FScopedPoseBuffer(const FScopedPoseBuffer&) = delete;
+	FScopedPoseBuffer& operator=(const FScopedPoseBuffer&) = delete;
+
+	TArray<FTransform>& Get() { return Buffer; }
+	operator TArray<FTransform>&() { return Buffer; }
+
+private:
+	FAnimPosePool& Pool;
+	TArray<FTransform>& Buffer;
+	SIZE_T CapacityAtAcquire;
+};
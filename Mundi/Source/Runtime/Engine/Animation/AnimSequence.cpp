@@ -1,9 +1,87 @@
 ﻿#include "pch.h"
 #include "AnimSequence.h"
 #include "AnimDateModel.h"
+#include "AnimationRuntime.h"
+#include "AnimPoseCache.h"
 
 IMPLEMENT_CLASS(UAnimSequence)
 
+namespace
+{
+    /** 낡은 트랙-본 표를 가진 시퀀스 (프레임 시작에 PruneStaleTrackToBoneMaps가 정리) */
+    std::mutex StaleTrackMapMutex;
+    TArray<const UAnimSequence*> SequencesWithStaleTrackMaps;
+
+    /** 압축 트랙: 채널마다 남은 키가 달라서 구간 탐색도 채널별 */
+    void GatherCompressedTrack(const FCompressedAnimTrack& Track, float FrameTime, FAnimKeyBatch& Batch, int32 Index)
+    {
+        FVector Vector0, Vector1;
+        FQuat Quat0, Quat1;
+        float Alpha;
+
+        Track.Translation.GetSegment(FrameTime, Vector0, Vector1, Alpha);
+        Batch.SetTranslation(Index, Vector0, Vector1, Alpha);
+
+        Track.Rotation.GetSegment(FrameTime, Quat0, Quat1, Alpha);
+        Batch.SetRotation(Index, Quat0, Quat1, Alpha);
+
+        Track.Scale.GetSegment(FrameTime, Vector0, Vector1, Alpha);
+        Batch.SetScale(Index, Vector0, Vector1, Alpha);
+    }
+
+    /** 원본 트랙: 모든 채널이 프레임마다 키를 가지므로 미리 구한 Frame0/Frame1/Alpha를 그대로 사용 */
+    template<typename KeyType>
+    void GetRawKeys(const TArray<KeyType>& Keys, int32 Frame0, int32 Frame1, const KeyType& DefaultValue, KeyType& OutKey0, KeyType& OutKey1)
+    {
+        if (Keys.IsEmpty())
+        {
+            OutKey0 = OutKey1 = DefaultValue;
+            return;
+        }
+        const int32 LastKey = Keys.Num() - 1;
+        OutKey0 = Keys[FMath::Clamp(Frame0, 0, LastKey)];
+        OutKey1 = Keys[FMath::Clamp(Frame1, 0, LastKey)];
+    }
+
+    void GatherRawTrack(const FRawAnimSequenceTrack& Track, int32 Frame0, int32 Frame1, float Alpha, FAnimKeyBatch& Batch, int32 Index)
+    {
+        FVector Vector0, Vector1;
+        FQuat Quat0, Quat1;
+
+        GetRawKeys(Track.PosKeys, Frame0, Frame1, FVector(0.0f, 0.0f, 0.0f), Vector0, Vector1);
+        Batch.SetTranslation(Index, Vector0, Vector1, Alpha);
+
+        GetRawKeys(Track.RotKeys, Frame0, Frame1, FQuat::Identity(), Quat0, Quat1);
+        Batch.SetRotation(Index, Quat0, Quat1, Alpha);
+
+        GetRawKeys(Track.ScaleKeys, Frame0, Frame1, FVector(1.0f, 1.0f, 1.0f), Vector0, Vector1);
+        Batch.SetScale(Index, Vector0, Vector1, Alpha);
+    }
+
+    /** 트랙 순서 포즈를 출력 인덱스로 복사 (InterpolateKeyBatch와 같은 규칙: INDEX_NONE이거나 범위 밖이면 건너뜀) */
+    void CopyTrackPose(const TArray<FTransform>& TrackPose, const int32* OutIndices, TArray<FTransform>& OutPose)
+    {
+        const int32 NumOut = OutPose.Num();
+        for (int32 TrackIndex = 0; TrackIndex < TrackPose.Num(); ++TrackIndex)
+        {
+            const int32 OutIndex = OutIndices[TrackIndex];
+            if (OutIndex >= 0 && OutIndex < NumOut)
+            {
+                OutPose[OutIndex] = TrackPose[TrackIndex];
+            }
+        }
+    }
+}
+
+UAnimSequence::~UAnimSequence()
+{
+    if (bHasStaleTrackMaps)
+    {
+        std::lock_guard<std::mutex> StaleLock(StaleTrackMapMutex);
+        SequencesWithStaleTrackMaps.Remove(this);
+    }
+}
+
 UAnimSequence::UAnimSequence()
 {
 }
@@ -58,29 +136,170 @@ void UAnimSequence::GetBonePose(FPoseContext& OutPoseContext, const FAnimExtract
 
     // 각 본의 전체 키 배열을 그대로 담고 있는 컨테이너를 리턴
     const TArray<FBoneAnimationTrack>& BoneTracks = Model->GetBoneAnimationTracks();
+    const int32 NumTracks = BoneTracks.Num();
+    if (NumTracks == 0)
+    {
+        return;
+    }
 
-    for (int32 TrackIndex = 0; TrackIndex < BoneTracks.Num(); ++TrackIndex)
+    // 트랙별 출력 위치: 스켈레톤이 있으면 캐싱된 본 인덱스 표, 없으면 트랙 인덱스 그대로
+    thread_local TArray<int32> IdentityIndices;
+    while (IdentityIndices.Num() < NumTracks)
+    {
+        IdentityIndices.Add(IdentityIndices.Num());
+    }
+    const int32* OutIndices = OutPoseContext.Skeleton
+        ? GetTrackToBoneMap(*OutPoseContext.Skeleton).TrackToBone.data()
+        : IdentityIndices.data();
+
+    // 시간 -> 프레임 변환은 모든 트랙이 같으므로 한 번만 한다
+    //
+    // <선형보간 하는 이유>
+    // 애니메이션 키가 프레임 기반으로 저장되어 있기 때문에, 임의의 시간(Time)이 두 키 사이에 걸쳐 있으면 그냥 가까운 키를 그
+    // 대로 쓰면 "툭툭 끊겨" 보임. 그래서 Time을 프레임 단위로 환산하고, 바로 앞/뒤의 두 키(Frame0, Frame1) 값을 가져와서
+    // Alpha 비율만큼 보간 (위치·스케일은 선형 보간, 회전은 쿼터니언 Nlerp)
+    // 애니메이션은 "어느 타이밍에 정확히 이 포즈"같이 명시된 키를 그대로 지켜야 하므로 Apporximation 대신 Interpolation을 사용해야함
+    //
+    // 공유 포즈 캐시: 같은 시퀀스를 같은(양자화된) 시간에 평가한 결과가 이번 프레임에 이미 있으면 복사만 한다
+    // 캐시에는 트랙 순서로 저장하므로 스켈레톤이 달라도 공유되고, 본 인덱스 재배치는 복사할 때 적용
+    FAnimPoseCache& PoseCache = FAnimPoseCache::Get();
+    const bool bUsePoseCache = PoseCache.IsEnabled();
+    int64 CacheTimeKey = 0;
+    if (bUsePoseCache)
+    {
+        CacheTimeKey = PoseCache.QuantizeTime(CurrentTime);
+        if (const TArray<FTransform>* CachedPose = PoseCache.Find(this, CacheTimeKey))
+        {
+            CopyTrackPose(*CachedPose, OutIndices, OutPoseContext.Pose);
+            return;
+        }
+    }
+
+    CurrentTime = FMath::Clamp(CurrentTime, 0.0f, Model->GetPlayLength());
+    const float FrameTime = CurrentTime * static_cast<float>(FrameRate);
+    const int32 Frame0 = FMath::FloorToInt(FrameTime);
+    const int32 Frame1 = FMath::CeilToInt(FrameTime);
+    const float FrameAlpha = FrameTime - static_cast<float>(Frame0);
+
+    // 트랙마다 앞/뒤 키만 모아 두고 보간은 SIMD로 일괄 처리 (워커 스레드별 스크래치)
+    thread_local FAnimKeyBatch Batch;
+    Batch.Reset(NumTracks);
+
+    for (int32 TrackIndex = 0; TrackIndex < NumTracks; ++TrackIndex)
     {
         const FBoneAnimationTrack& Track = BoneTracks[TrackIndex];
-        FName BoneName = Track.Name;
-
-        // 이 본 이름의 트랙 데이터를 주어진 시간(Time)에 맞춰 평가해, 하나의 FTransform으로 돌려주는 함수
-        // 1. 본 이름으로 FBoneAnimationTrack을 찾음
-        // 2. 애니 전체 프레임 수와 프레임 레이트를 보고, 현재 시간(Time)을 정수 프레임 인덱스 두개(Frame0/Frame1)와 보간 비율로 선형보간
-        //
-        // <선형보간 하는 이유>
-        // 애니메이션 키가 프레임 기반으로 저장되어 있기 때문에, 임의의 시간(Time)이 두 키 사이에 걸쳐 있으면 그냥 가까운 키를 그
-        // 대로 쓰면 "툭툭 끊겨" 보임. EvaluateBoneTrackTransform은 그걸 부드럽게 만들기 위해 Time을 프레임 단위로 환산하고,
-        // 바로 앞/뒤의 두 키(Frame0, Frame1) 값을 가져와서 Alpha 비율만큼 보간 위치·스케일은 선형 보간, 회전은 쿼터니언 Slerp을 씀
-        // 애니메이션은 "어느 타이밍에 정확히 이 포즈"같이 명시된 키를 그대로 지켜야 하므로 Apporximation 대신 Interpolation을 사용해야함
-        FTransform BoneTransform = Model->EvaluateBoneTrackTransform(BoneName, CurrentTime, true);
-
-        // Store in pose context (you'll need to map bone name to index)
-        // For now, we'll just use track index
-        if (TrackIndex < OutPoseContext.Pose.Num())
+        if (Track.CompressedTrack.bValid)
+        {
+            GatherCompressedTrack(Track.CompressedTrack, FrameTime, Batch, TrackIndex);
+        }
+        else
         {
-            OutPoseContext.Pose[TrackIndex] = BoneTransform;
+            GatherRawTrack(Track.InternalTrack, Frame0, Frame1, FrameAlpha, Batch, TrackIndex);
+        }
+    }
+
+    if (!bUsePoseCache)
+    {
+        FAnimationRuntime::InterpolateKeyBatch(Batch, OutIndices, OutPoseContext.Pose);
+        return;
+    }
+
+    // 캐시에 넣을 트랙 순서 포즈로 한 번 보간한 뒤 출력 인덱스로 복사
+    thread_local TArray<FTransform> TrackPose;
+    TrackPose.SetNum(NumTracks);
+    FAnimationRuntime::InterpolateKeyBatch(Batch, IdentityIndices.data(), TrackPose);
+
+    PoseCache.Add(this, CacheTimeKey, TrackPose);
+    CopyTrackPose(TrackPose, OutIndices, OutPoseContext.Pose);
+}
+
+const FTrackToBoneMap& UAnimSequence::GetTrackToBoneMap(const FSkeleton& Skeleton) const
+{
+    const UAnimDataModel* Model = GetDataModel();
+    const int32 NumTracks = Model ? Model->GetNumBoneTracks() : 0;
+    const int32 NumSkeletonBones = Skeleton.Bones.Num();
+
+    std::lock_guard<std::mutex> Lock(TrackMapMutex);
+
+    // 주소만으로는 해제 후 같은 주소에 생긴 다른 스켈레톤과 구분이 안 되므로 리비전까지 비교
+    bool bShadowsStaleMap = false;
+    for (const std::unique_ptr<FTrackToBoneMap>& Map : TrackToBoneMaps)
+    {
+        if (Map->SkeletonRevision == Skeleton.Revision.Value && Map->NumSkeletonBones == NumSkeletonBones && Map->NumTracks == NumTracks)
+        {
+            return *Map;
+        }
+        if (Map->Skeleton == &Skeleton)
+        {
+            bShadowsStaleMap = true;
+        }
+    }
+
+    std::unique_ptr<FTrackToBoneMap> NewMap = std::make_unique<FTrackToBoneMap>();
+    NewMap->Skeleton = &Skeleton;
+    NewMap->SkeletonRevision = Skeleton.Revision.Value;
+    NewMap->NumSkeletonBones = NumSkeletonBones;
+    NewMap->NumTracks = NumTracks;
+    NewMap->TrackToBone.SetNum(NumTracks);
+
+    if (Model)
+    {
+        const TArray<FBoneAnimationTrack>& BoneTracks = Model->GetBoneAnimationTracks();
+        for (int32 TrackIndex = 0; TrackIndex < NumTracks; ++TrackIndex)
+        {
+            int32 BoneIndex = Skeleton.FindBoneIndex(BoneTracks[TrackIndex].Name);
+            if (BoneIndex >= NumSkeletonBones)
+            {
+                BoneIndex = INDEX_NONE;
+            }
+            NewMap->TrackToBone[TrackIndex] = BoneIndex;
+            if (BoneIndex != INDEX_NONE)
+            {
+                NewMap->NumMatchedTracks++;
+            }
+        }
+    }
+
+    const FTrackToBoneMap* Result = NewMap.get();
+    TrackToBoneMaps.Emplace(std::move(NewMap));
+
+    // 같은 주소의 이전 표는 그 스켈레톤이 사라졌거나 바뀐 것이지만, 이번 프레임에 그 참조를 든 평가가 있을 수 있으므로
+    // 바로 지우지 않고 프레임 시작 정리 목록에 올린다
+    if (bShadowsStaleMap && !bHasStaleTrackMaps)
+    {
+        bHasStaleTrackMaps = true;
+        std::lock_guard<std::mutex> StaleLock(StaleTrackMapMutex);
+        SequencesWithStaleTrackMaps.Add(this);
+    }
+    return *Result;
+}
+
+void UAnimSequence::PruneStaleTrackToBoneMaps()
+{
+    TArray<const UAnimSequence*> Sequences;
+    {
+        std::lock_guard<std::mutex> StaleLock(StaleTrackMapMutex);
+        Sequences.swap(SequencesWithStaleTrackMaps);
+    }
+
+    for (const UAnimSequence* Sequence : Sequences)
+    {
+        std::lock_guard<std::mutex> Lock(Sequence->TrackMapMutex);
+        TArray<std::unique_ptr<FTrackToBoneMap>>& Maps = Sequence->TrackToBoneMaps;
+
+        // 같은 스켈레톤 주소의 표 중 가장 나중에 추가된 것만 남긴다
+        for (int32 MapIndex = Maps.Num() - 1; MapIndex >= 0; --MapIndex)
+        {
+            for (int32 NewerIndex = MapIndex + 1; NewerIndex < Maps.Num(); ++NewerIndex)
+            {
+                if (Maps[NewerIndex]->Skeleton == Maps[MapIndex]->Skeleton)
+                {
+                    Maps.erase(Maps.begin() + MapIndex);
+                    break;
+                }
+            }
         }
+        Sequence->bHasStaleTrackMaps = false;
     }
 }
 
@@ -126,12 +345,14 @@ void UAnimSequence::EvaluatePose(float Time, float DeltaTime, TArray<FTransform>
     OutPose.SetNum(NumBones);
 
     // FAnimExtractContext 생성 (루핑은 기본 true로 설정)
+    // 호출자 버퍼에 바로 평가 (임시 포즈 배열 없이)
     FAnimExtractContext ExtractContext(Time, true);
-    FPoseContext PoseContext(NumBones);
+    FPoseContext PoseContext;
+    PoseContext.Pose.swap(OutPose);
 
     GetAnimationPose(PoseContext, ExtractContext);
 
-    OutPose = PoseContext.Pose;
+    OutPose.swap(PoseContext.Pose);
 }
 
 int32 UAnimSequence::GetNumBoneTracks() const
@@ -1,6 +1,10 @@
 ﻿#pragma once
+#include <memory>
+#include <mutex>
 #include "AnimSequenceBase.h"
 
+struct FSkeleton;
+
 
 
 
@@ -13,15 +17,22 @@
  * 
  * 2. 포즈평가(GetAnimationPose / GetBonePose)
  * USkeletalMeshComponent::TickAnimInstances가 CurrentAnimation->GetAnimationPose(...)를 호출하면, 
- * UAnimSequence는 내부 UAnimDataModel::EvaluateBoneTrackTransform을 사용해 현재 시간의 각 본 로컬 트랜스폼을 계산해 FPoseContext.Pose에 채워줌
+ * UAnimSequence는 트랙 데이터를 직접 읽어 현재 시간의 각 본 로컬 트랜스폼을 계산해 FPoseContext.Pose에 채워줌
+ * 시간 -> 프레임 변환은 한 번만 하고, 트랙별 앞/뒤 키를 모아 FAnimationRuntime::InterpolateKeyBatch로 일괄 보간
+ * 같은 프레임에 같은 (시퀀스, 양자화된 시간)을 평가하는 컴포넌트끼리는 FAnimPoseCache로 결과를 공유
  * 
  */
 
 
-// Forward declarations
+/**
+ * @brief 포즈 평가 출력
+ * - Skeleton이 nullptr이면 Pose는 트랙 인덱스 순서 (기존 방식, 블렌드 스페이스/AnimInstance 경로)
+ * - Skeleton을 지정하면 Pose는 스켈레톤 본 인덱스 순서이고, 애니메이션에 없는 본은 기존 값을 유지
+ */
 struct FPoseContext
 {
     TArray<FTransform> Pose;
+    const FSkeleton* Skeleton = nullptr;
 
     FPoseContext() {}
     explicit FPoseContext(int32 NumBones)
@@ -30,13 +41,30 @@ struct FPoseContext
     }
 };
 
+/**
+ * @brief 트랙 인덱스 -> 스켈레톤 본 인덱스 표
+ * (시퀀스, 스켈레톤) 쌍마다 처음 평가할 때 한 번 만들고, 이후 포즈 평가에서는 본 이름 검색을 하지 않는다.
+ */
+struct FTrackToBoneMap
+{
+    /** 만들 때의 스켈레톤 주소/리비전 (주소는 같은 자리의 낡은 항목을 찾아 정리하는 데만 쓰고, 일치 판정은 리비전으로) */
+    const FSkeleton* Skeleton = nullptr;
+    uint64 SkeletonRevision = 0;
+    /** 만들 때의 스켈레톤 본 수/트랙 수 (달라지면 다시 만든다) */
+    int32 NumSkeletonBones = 0;
+    int32 NumTracks = 0;
+    /** INDEX_NONE이면 스켈레톤에 없는 본 */
+    TArray<int32> TrackToBone;
+    int32 NumMatchedTracks = 0;
+};
+
 class UAnimSequence : public UAnimSequenceBase, public IAnimPoseProvider
 {
     DECLARE_CLASS(UAnimSequence, UAnimSequenceBase)
 
 public:
     UAnimSequence();
-    virtual ~UAnimSequence() = default;
+    virtual ~UAnimSequence();
 
     // Get animation pose at specific time
     void GetAnimationPose(FPoseContext& OutPoseContext, const FAnimExtractContext& ExtractionContext);
@@ -44,6 +72,18 @@ public:
     // Get bone pose for specific bones
     void GetBonePose(FPoseContext& OutPoseContext, const FAnimExtractContext& ExtractionContext);
 
+    /**
+     * @brief 스켈레톤용 트랙 -> 본 인덱스 표 (없으면 만들어서 캐싱)
+     * 여러 스레드에서 같은 시퀀스를 평가할 수 있으므로 캐시 접근은 잠금으로 보호
+     */
+    const FTrackToBoneMap& GetTrackToBoneMap(const FSkeleton& Skeleton) const;
+
+    /**
+     * @brief 같은 스켈레톤 주소에 새 리비전 표가 생겨 더 이상 쓰이지 않는 표를 지운다
+     * 반환한 참조를 들고 있는 평가가 없을 때(프레임 시작, 게임 스레드)만 호출
+     */
+    static void PruneStaleTrackToBoneMaps();
+
     // Override GetPlayLength from base class
     virtual float GetPlayLength() const override;
 
@@ -79,4 +119,14 @@ public:
 
     // Check if this animation is compatible with given skeleton bone names
     bool IsCompatibleWith(const TArray<FName>& SkeletonBoneNames) const;
+
+private:
+    /**
+     * 한 번 만든 표는 수정하지 않고, 조건이 달라지면 새로 추가한다 (반환한 참조가 그 프레임 동안 유효하도록)
+     * 낡은 표는 PruneStaleTrackToBoneMaps에서만 지운다
+     */
+    mutable std::mutex TrackMapMutex;
+    mutable TArray<std::unique_ptr<FTrackToBoneMap>> TrackToBoneMaps;
+    /** 낡은 표가 남아 있어 정리 대상 목록에 올라가 있는지 (TrackMapMutex 보호) */
+    mutable bool bHasStaleTrackMaps = false;
 };
@@ -69,15 +69,11 @@ UAnimDataModel* UAnimSequenceBase::GetDataModel() const
 
 bool UAnimSequenceBase::IsNotifyAvailable() const
 {
-    if (Notifies.Num() == 0)
-    {
-        UAnimSequenceBase* Self = const_cast<UAnimSequenceBase*>(this);
-        (void)Self->GetAnimNotifyEvents();
-    }
+    // 병렬 애니메이션 단계에서 워커가 부르므로 여기서는 메타를 로드하지 않음 (EnsureNotifiesLoaded 참고)
     return (Notifies.Num() != 0) && (GetPlayLength() > 0.f);
 }
 
-TArray<FAnimNotifyEvent>& UAnimSequenceBase::GetAnimNotifyEvents()
+void UAnimSequenceBase::EnsureNotifiesLoaded()
 {
     // Lazy-load meta if empty and sidecar exists (only attempt once)
     if (Notifies.Num() == 0 && !bMetaLoadAttempted)
@@ -104,17 +100,19 @@ TArray<FAnimNotifyEvent>& UAnimSequenceBase::GetAnimNotifyEvents()
             UE_LOG("GetAnimNotifyEvents - Loaded %d notifies from %s", Notifies.Num(), MetaPathUtf8.c_str());
         }
     }
+}
+
+TArray<FAnimNotifyEvent>& UAnimSequenceBase::GetAnimNotifyEvents()
+{
+    EnsureNotifiesLoaded();
+    // 수정 가능한 참조를 넘기므로 (에디터 타임라인 편집 등) 다음 질의 때 인덱스를 다시 만든다
+    NotifyTimeIndex.Invalidate();
     return Notifies;
 }
 
 const TArray<FAnimNotifyEvent>& UAnimSequenceBase::GetAnimNotifyEvents() const
 {
-    if (Notifies.Num() == 0)
-    {
-        // const-correctness workaround
-        UAnimSequenceBase* Self = const_cast<UAnimSequenceBase*>(this);
-        (void)Self->GetAnimNotifyEvents();
-    }
+    // 로드하지 않는 읽기 전용 접근 (워커 스레드에서도 안전)
     return Notifies;
 }
 
@@ -159,6 +157,19 @@ void UAnimSequenceBase::GetAnimNotify(const float& StartTime, const float& Delta
             GetAnimNotifiesFromDeltaPosition(0.0f, Remainder, OutNotifies);
         }
     }
+    else if (EndPosition < 0.0f && bLoop)
+    {
+        // 역재생 루프
+        // 구간 1: StartTime → 0
+        GetAnimNotifiesFromDeltaPosition(StartTime, 0.0f, OutNotifies);
+
+        // 구간 2: PlayLength → 루프 후 위치
+        float Remainder = FMath::Fmod(-EndPosition, PlayLength);
+        if (Remainder > 0.0f)
+        {
+            GetAnimNotifiesFromDeltaPosition(PlayLength, PlayLength - Remainder, OutNotifies);
+        }
+    }
     else if (EndPosition <= PlayLength)
     {
         // 일반적인 경우: 루프 없음
@@ -183,8 +194,13 @@ void UAnimSequenceBase::GetAnimNotifiesFromDeltaPosition(const float& PreviousPo
 
     const float MinTime = bPlayingBackwards ? CurrentPosition : PreviousPosition;
     const float MaxTime = bPlayingBackwards ? PreviousPosition : CurrentPosition;
-     
-    for (int32 NotifyIndex = 0; NotifyIndex < Notifies.Num(); ++NotifyIndex)
+
+    // 전체 배열 대신 시간 인덱스로 구간에 걸리는 후보만 뽑아서 판정 (원래 배열 순서 유지)
+    // 역방향 싱글샷 조건(MinTime >= End && MaxTime < Start)은 Duration 0인 싱글샷에서 성립하지 않으므로 후보에서 빠져도 결과가 같다
+    thread_local TArray<int32> CandidateIndices;
+    NotifyTimeIndex.Query(Notifies, MinTime, MaxTime, CandidateIndices);
+
+    for (int32 NotifyIndex : CandidateIndices)
     {
         const FAnimNotifyEvent& AnimNotifyEvent = Notifies[NotifyIndex];
 
@@ -313,6 +329,7 @@ void UAnimSequenceBase::AddPlaySoundNotify(float Time, UAnimNotify* Notify, floa
     NewEvent.NotifyState = nullptr;
 
     Notifies.Add(NewEvent);
+    NotifyTimeIndex.Invalidate();
 }
 
 void UAnimSequenceBase::AddPlayParticleNotify(float Time, UAnimNotify* Notify, float Duration)
@@ -537,6 +554,7 @@ bool UAnimSequenceBase::LoadMeta(const FString& MetaPathUTF8)
     }
 
     Notifies.Empty();
+    NotifyTimeIndex.Invalidate();
 
     for (size_t i = 0; i < Arr.size(); ++i)
     {
@@ -2,6 +2,7 @@
 #include "AnimationAsset.h"
 #include "AnimDateModel.h" 
 #include "AnimTypes.h"
+#include "AnimNotifyIndex.h"
 
 class UAnimNotify;
 class UAnimNotifyState;
@@ -28,6 +29,12 @@ public:
 public:
     UAnimDataModel* GetDataModel() const;
 
+    /**
+     * 노티파이 사이드카(.anim.json)를 아직 안 읽었으면 읽는다 (게임 스레드 전용, 한 번만 시도)
+     * LoadMeta가 UObject 생성/리소스 로드를 하므로 에셋 등록 시점에 불러 두고,
+     * 워커에서 도는 노티파이 수집(IsNotifyAvailable/GetAnimNotify/const GetAnimNotifyEvents)은 읽기만 한다
+     */
+    void EnsureNotifiesLoaded();
     bool IsNotifyAvailable() const;
     void GetAnimNotify(const float& StartTime, const float& DeltaTime, TArray<FPendingAnimNotify>& OutNotifies) const;
     void GetAnimNotifiesFromDeltaPosition(const float& PreviousPosition, const float& CurrentPosition, TArray<FPendingAnimNotify>& OutNotifies) const;
@@ -48,6 +55,9 @@ protected:
 
     TArray<FAnimNotifyEvent> Notifies;
 
+    // Notifies 시간 인덱스 (Notifies를 바꾸는 곳에서 Invalidate)
+    FAnimNotifyIndex NotifyTimeIndex;
+
     //TArray<FAnimNotifyTrack> AnimNotifyTracks;
 
     UAnimDataModel* DataModel;
@@ -57,5 +67,5 @@ protected:
     bool bLoop;
 
     // 메타 파일 로드 시도 여부 (한 번만 시도하기 위한 플래그)
-    mutable bool bMetaLoadAttempted = false;  
+    bool bMetaLoadAttempted = false;
 };
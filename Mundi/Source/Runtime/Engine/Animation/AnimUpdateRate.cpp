@@ -0,0 +1,193 @@
+﻿#include "pch.h"
+#include "AnimUpdateRate.h"
+#include "SceneView.h"
+
+float FAnimUpdateRateParams::GetInterpolationAlpha() const
+{
+	if (UpdateRate <= 1)
+	{
+		return 1.0f;
+	}
+	return FMath::Min(static_cast<float>(FramesSinceEvaluate + 1) / static_cast<float>(UpdateRate), 1.0f);
+}
+
+FAnimUpdateRateSettings& FAnimUpdateRate::GetSettings()
+{
+	static FAnimUpdateRateSettings Settings;
+	return Settings;
+}
+
+float FAnimUpdateRate::ComputeScreenSize(const FVector& Center, float Radius, const FMinimalViewInfo& View)
+{
+	if (View.ProjectionMode != ECameraProjectionMode::Perspective)
+	{
+		return 1.0f;
+	}
+
+	const float Distance = (Center - View.ViewLocation).Size();
+	if (Distance <= Radius)
+	{
+		return 1.0f;
+	}
+
+	const float HalfFOVTan = std::tan(DegreesToRadians(FMath::Clamp(View.FieldOfView, 1.0f, 170.0f)) * 0.5f);
+	return Radius / (Distance * HalfFOVTan);
+}
+
+void FAnimUpdateRate::Tick(FAnimUpdateRateParams& Params, float DeltaTime, float ScreenSize, float TimeSinceRendered, bool bAllowFreeze)
+{
+	const FAnimUpdateRateSettings& Settings = GetSettings();
+	Params.ScreenSize = ScreenSize;
+
+	if (!Settings.bEnabled)
+	{
+		Params.UpdateRate = 1;
+		Params.BoneLOD = 0;
+		Params.bInterpolateSkippedFrames = false;
+		Params.bFrozen = false;
+		Params.bEvaluateThisFrame = true;
+		Params.FramesSinceEvaluate = 0;
+		Params.EvaluationDeltaTime = Params.AccumulatedDeltaTime + DeltaTime;
+		Params.AccumulatedDeltaTime = 0.0f;
+		return;
+	}
+
+	const bool bWasFrozen = Params.bFrozen;
+	const int32 PrevUpdateRate = Params.UpdateRate;
+	const bool bRecentlyRendered = TimeSinceRendered <= Settings.RecentlyRenderedTime;
+	if (bRecentlyRendered)
+	{
+		if (ScreenSize >= Settings.FullRateScreenSize)       { Params.UpdateRate = 1; }
+		else if (ScreenSize >= Settings.HalfRateScreenSize)  { Params.UpdateRate = 2; }
+		else if (ScreenSize >= Settings.ThirdRateScreenSize) { Params.UpdateRate = 3; }
+		else                                                 { Params.UpdateRate = FMath::Max(Settings.MinScreenUpdateRate, 1); }
+
+		if (ScreenSize >= Settings.BoneLOD1ScreenSize)      { Params.BoneLOD = 0; }
+		else if (ScreenSize >= Settings.BoneLOD2ScreenSize) { Params.BoneLOD = 1; }
+		else                                                { Params.BoneLOD = 2; }
+
+		Params.bInterpolateSkippedFrames = Params.UpdateRate > 1;
+		Params.bFrozen = false;
+	}
+	else
+	{
+		Params.UpdateRate = FMath::Max(Settings.OffscreenUpdateRate, 1);
+		Params.BoneLOD = FAnimUpdateRateParams::NumBoneLODs - 1;
+		Params.bInterpolateSkippedFrames = false;
+		Params.bFrozen = bAllowFreeze && TimeSinceRendered >= Settings.FreezeDelay;
+	}
+
+	if (Params.bFrozen)
+	{
+		// 멈춘 동안은 시간도 흐르지 않는다 (다시 보이면 멈춘 자리부터 재생)
+		Params.bEvaluateThisFrame = false;
+		Params.AccumulatedDeltaTime = 0.0f;
+		Params.EvaluationDeltaTime = 0.0f;
+		return;
+	}
+
+	Params.AccumulatedDeltaTime += DeltaTime;
+
+	// 주기가 바뀌면 컴포넌트마다 위상을 흩어서, 같은 프레임에 스폰된 적들이 한 프레임에 몰려 평가되지 않게 한다
+	if (Params.UpdateRate != PrevUpdateRate && Params.UpdateRate > 1)
+	{
+		Params.FramesSinceEvaluate = static_cast<int32>(Params.FrameOffset % static_cast<uint32>(Params.UpdateRate));
+	}
+
+	// 한 주기가 찼거나 방금 깨어났으면 평가
+	Params.bEvaluateThisFrame = bWasFrozen || Params.FramesSinceEvaluate + 1 >= Params.UpdateRate;
+
+	if (Params.bEvaluateThisFrame)
+	{
+		Params.FramesSinceEvaluate = 0;
+		Params.EvaluationDeltaTime = Params.AccumulatedDeltaTime;
+		Params.AccumulatedDeltaTime = 0.0f;
+	}
+	else
+	{
+		Params.FramesSinceEvaluate++;
+		Params.EvaluationDeltaTime = 0.0f;
+	}
+}
+
+void FAnimUpdateRate::BuildBoneMaxLODs(const FSkeletalMeshData& Data, TArray<uint8>& OutBoneMaxLODs)
+{
+	OutBoneMaxLODs.Empty();
+
+	const TArray<FBone>& Bones = Data.Skeleton.Bones;
+	const int32 NumBones = Bones.Num();
+	if (NumBones == 0 || Data.Vertices.IsEmpty())
+	{
+		return;
+	}
+
+	// 본별 바운드: 조인트 위치 + 가중치가 있는 정점 (바인드 포즈, 컴포넌트 공간)
+	const FVector InvalidMin(FLT_MAX, FLT_MAX, FLT_MAX);
+	const FVector InvalidMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	TArray<FVector> BoneMin, BoneMax;
+	BoneMin.SetNum(NumBones, InvalidMin);
+	BoneMax.SetNum(NumBones, InvalidMax);
+
+	auto Expand = [](FVector& Min, FVector& Max, const FVector& Point)
+	{
+		Min = Min.ComponentMin(Point);
+		Max = Max.ComponentMax(Point);
+	};
+
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		const FMatrix& BindPose = Bones[BoneIndex].BindPose;
+		Expand(BoneMin[BoneIndex], BoneMax[BoneIndex], FVector(BindPose.M[3][0], BindPose.M[3][1], BindPose.M[3][2]));
+	}
+
+	FVector MeshMin = InvalidMin, MeshMax = InvalidMax;
+	for (const FSkinnedVertex& Vertex : Data.Vertices)
+	{
+		Expand(MeshMin, MeshMax, Vertex.Position);
+		for (int32 Slot = 0; Slot < 4; ++Slot)
+		{
+			const uint32 BoneIndex = Vertex.BoneIndices[Slot];
+			if (Vertex.BoneWeights[Slot] > 0.0f && BoneIndex < static_cast<uint32>(NumBones))
+			{
+				Expand(BoneMin[BoneIndex], BoneMax[BoneIndex], Vertex.Position);
+			}
+		}
+	}
+
+	// 자식 바운드를 부모에 합침 (부모 인덱스가 자식보다 작다는 스켈레톤 순서 가정, UpdateComponentSpaceTransforms와 동일)
+	for (int32 BoneIndex = NumBones - 1; BoneIndex > 0; --BoneIndex)
+	{
+		const int32 ParentIndex = Bones[BoneIndex].ParentIndex;
+		if (ParentIndex >= 0 && ParentIndex < BoneIndex)
+		{
+			Expand(BoneMin[ParentIndex], BoneMax[ParentIndex], BoneMin[BoneIndex]);
+			Expand(BoneMin[ParentIndex], BoneMax[ParentIndex], BoneMax[BoneIndex]);
+		}
+	}
+
+	const float MeshSize = (MeshMax - MeshMin).GetMaxValue();
+
+	const FAnimUpdateRateSettings& Settings = GetSettings();
+	const uint8 AllLODs = static_cast<uint8>(FAnimUpdateRateParams::NumBoneLODs - 1);
+	OutBoneMaxLODs.SetNum(NumBones, AllLODs);
+	if (MeshSize <= KINDA_SMALL_NUMBER)
+	{
+		return;
+	}
+
+	for (int32 BoneIndex = 1; BoneIndex < NumBones; ++BoneIndex)
+	{
+		const float BoneSize = (BoneMax[BoneIndex] - BoneMin[BoneIndex]).Size() / MeshSize;
+
+		uint8 MaxLOD = AllLODs;
+		if (BoneSize < Settings.BoneLOD1SizeFraction)      { MaxLOD = 0; }
+		else if (BoneSize < Settings.BoneLOD2SizeFraction) { MaxLOD = 1; }
+
+		const int32 ParentIndex = Bones[BoneIndex].ParentIndex;
+		if (ParentIndex >= 0 && ParentIndex < BoneIndex)
+		{
+			MaxLOD = FMath::Min(MaxLOD, OutBoneMaxLODs[ParentIndex]);
+		}
+		OutBoneMaxLODs[BoneIndex] = MaxLOD;
+	}
+}
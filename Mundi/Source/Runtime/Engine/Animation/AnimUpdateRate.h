@@ -0,0 +1,98 @@
+﻿#pragma once
+
+struct FMinimalViewInfo;
+struct FSkeletalMeshData;
+
+/**
+ * @brief 애니메이션 URO(Update Rate Optimization) 기준값
+ * - 화면 크기 = 바운드 반지름 / (카메라 거리 * tan(FOV/2)), 화면 높이 절반 대비 비율
+ * - 작을수록 포즈 평가 주기를 늘리고(사이 프레임은 보간), 작은 본(손가락/얼굴 등)은 멈춘다
+ * - 콘솔 명령 "ANIM URO ON/OFF"로 전체 켜고 끔
+ */
+struct FAnimUpdateRateSettings
+{
+	bool bEnabled = true;
+
+	/** 화면 크기가 이 값 이상이면 매 프레임, 그 아래로 2/3프레임, 가장 작으면 MinScreenUpdateRate 프레임마다 평가 */
+	float FullRateScreenSize = 0.25f;
+	float HalfRateScreenSize = 0.12f;
+	float ThirdRateScreenSize = 0.06f;
+	int32 MinScreenUpdateRate = 4;
+
+	/** 이 시간 안에 렌더 수집된 적이 있으면 화면에 보이는 것으로 본다 */
+	float RecentlyRenderedTime = 0.2f;
+	/** 렌더되지 않는 동안의 평가 주기 (보간 없음, 시간/노티파이/루트 모션은 누적 DeltaTime으로 유지) */
+	int32 OffscreenUpdateRate = 8;
+	/** 이 시간 이상 렌더되지 않으면 평가를 멈춤 (루트 모션/몽타주 재생 중에는 멈추지 않음) */
+	float FreezeDelay = 2.0f;
+
+	/** 화면 크기가 이 값보다 작으면 본 LOD 1/2 */
+	float BoneLOD1ScreenSize = 0.12f;
+	float BoneLOD2ScreenSize = 0.06f;
+	/** 본 LOD 1/2에서 멈추는 본 크기 (하위 본까지 포함한 바인드 포즈 바운드 대각선 / 메시 바운드 최대 변) */
+	float BoneLOD1SizeFraction = 0.03f;
+	float BoneLOD2SizeFraction = 0.08f;
+};
+
+/**
+ * @brief 컴포넌트별 URO 상태
+ * 게임 스레드(TickAnimation)에서 FAnimUpdateRate::Tick으로 갱신하고, 애니메이션 단계(워커)에서는 읽기만 한다.
+ */
+struct FAnimUpdateRateParams
+{
+	static constexpr int32 NumBoneLODs = 3;
+
+	/** N프레임에 한 번 포즈 평가 */
+	int32 UpdateRate = 1;
+	/** 0이면 모든 본, 1/2면 USkeletalMesh::GetBoneMaxLODs 기준으로 작은 본을 마지막 값에 고정 */
+	int32 BoneLOD = 0;
+	/** 평가 사이 프레임을 직전 표시 포즈 -> 최신 평가 포즈 보간으로 채움 (화면에 보일 때만) */
+	bool bInterpolateSkippedFrames = false;
+	/** 렌더되지 않은 지 FreezeDelay를 넘어 평가를 멈춘 상태 (시간도 흐르지 않음) */
+	bool bFrozen = false;
+	/** 이번 프레임에 포즈를 평가하는지 */
+	bool bEvaluateThisFrame = true;
+
+	/** 마지막 평가 이후 지난 프레임 수 */
+	int32 FramesSinceEvaluate = 0;
+	/** 평가 프레임을 컴포넌트마다 흩어 놓기 위한 위상 (오브젝트 인덱스로 설정) */
+	uint32 FrameOffset = 0;
+	/** 평가를 건너뛴 프레임의 DeltaTime 누적 (평가 프레임에 한 번에 넘김) */
+	float AccumulatedDeltaTime = 0.0f;
+	/** 이번 평가에 넘기는 DeltaTime (평가하지 않는 프레임은 0) */
+	float EvaluationDeltaTime = 0.0f;
+	/** 마지막으로 계산한 화면 크기 (통계 표시용) */
+	float ScreenSize = 1.0f;
+
+	/** 보간 비율: 평가 프레임에 1/UpdateRate, 다음 평가 직전 프레임에 1 */
+	float GetInterpolationAlpha() const;
+	/** 이 본 LOD에서 본을 평가하는지 (BoneMaxLODs가 비어 있으면 항상 true) */
+	bool IsBoneRequired(const TArray<uint8>& BoneMaxLODs, int32 BoneIndex) const
+	{
+		return BoneLOD == 0 || BoneIndex >= BoneMaxLODs.Num() || BoneMaxLODs[BoneIndex] >= BoneLOD;
+	}
+};
+
+class FAnimUpdateRate
+{
+public:
+	static FAnimUpdateRateSettings& GetSettings();
+
+	/** 원근 투영 기준 화면 크기 (직교 투영이거나 카메라 안쪽이면 1) */
+	static float ComputeScreenSize(const FVector& Center, float Radius, const FMinimalViewInfo& View);
+
+	/**
+	 * 이번 프레임 평가 주기/본 LOD/평가 여부 결정 (게임 스레드, 컴포넌트마다 프레임당 한 번)
+	 * @param ScreenSize 플레이어 카메라가 없으면 1을 넘겨 항상 매 프레임 평가
+	 * @param TimeSinceRendered 마지막 렌더 수집 이후 지난 시간
+	 * @param bAllowFreeze 루트 모션/몽타주처럼 게임플레이에 영향을 주는 재생 중이면 false
+	 */
+	static void Tick(FAnimUpdateRateParams& Params, float DeltaTime, float ScreenSize, float TimeSinceRendered, bool bAllowFreeze);
+
+	/**
+	 * 본별로 평가를 유지하는 최대 본 LOD 계산 (로드 시 한 번)
+	 * 본에 가중치가 있는 정점과 조인트 위치로 만든 바운드를 자식 본까지 합쳐, 메시 크기 대비 작으면 낮은 LOD까지만 평가한다.
+	 * 자식은 부모보다 큰 값을 갖지 않는다 (부모가 멈추면 자식도 멈춤). 루트 본은 항상 평가.
+	 */
+	static void BuildBoneMaxLODs(const FSkeletalMeshData& Data, TArray<uint8>& OutBoneMaxLODs);
+};
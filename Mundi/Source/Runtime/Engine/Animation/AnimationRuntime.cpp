@@ -1,6 +1,84 @@
 ﻿#include "pch.h"
 #include "AnimationRuntime.h"
 #include "AnimTypes.h"
+#include <immintrin.h>
+
+namespace
+{
+	inline __m128 LerpPS(__m128 A, __m128 B, __m128 Alpha)
+	{
+		return _mm_add_ps(A, _mm_mul_ps(_mm_sub_ps(B, A), Alpha));
+	}
+
+	inline __m128 Dot3PS(__m128 AX, __m128 AY, __m128 AZ, __m128 BX, __m128 BY, __m128 BZ)
+	{
+		return _mm_add_ps(_mm_add_ps(_mm_mul_ps(AX, BX), _mm_mul_ps(AY, BY)), _mm_mul_ps(AZ, BZ));
+	}
+
+	/** 레인별 4x4 행렬(Lanes[Row][Col])을 행렬 4개로 되돌려 기록 (NumLanes 이후 레인은 버림) */
+	inline void StoreMatrixLanes(__m128 (&Lanes)[4][4], FMatrix* Out, int32 NumLanes)
+	{
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			__m128 L0 = Lanes[Row][0], L1 = Lanes[Row][1], L2 = Lanes[Row][2], L3 = Lanes[Row][3];
+			_MM_TRANSPOSE4_PS(L0, L1, L2, L3);
+			const __m128 RowsPerLane[4] = { L0, L1, L2, L3 };
+			for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+			{
+				Out[Lane].Rows[Row] = RowsPerLane[Lane];
+			}
+		}
+	}
+}
+
+// ============================================================
+// FAnimKeyBatch
+// ============================================================
+
+void FAnimKeyBatch::Reset(int32 InNumTracks)
+{
+	NumTracks = InNumTracks;
+	Capacity = (InNumTracks + 3) & ~3;
+	if (Data.Num() < Capacity * NumStreams)
+	{
+		Data.SetNum(Capacity * NumStreams);
+	}
+
+	// 패딩 칸도 커널이 같이 계산하므로 정규화 가능한 값으로 채운다
+	const FVector ZeroVector(0.0f, 0.0f, 0.0f);
+	const FVector OneVector(1.0f, 1.0f, 1.0f);
+	for (int32 Index = NumTracks; Index < Capacity; ++Index)
+	{
+		SetTranslation(Index, ZeroVector, ZeroVector, 0.0f);
+		SetRotation(Index, FQuat::Identity(), FQuat::Identity(), 0.0f);
+		SetScale(Index, OneVector, OneVector, 0.0f);
+	}
+}
+
+void FAnimKeyBatch::SetTranslation(int32 Index, const FVector& Key0, const FVector& Key1, float Alpha)
+{
+	GetStream(Pos0X)[Index] = Key0.X; GetStream(Pos0Y)[Index] = Key0.Y; GetStream(Pos0Z)[Index] = Key0.Z;
+	GetStream(Pos1X)[Index] = Key1.X; GetStream(Pos1Y)[Index] = Key1.Y; GetStream(Pos1Z)[Index] = Key1.Z;
+	GetStream(PosAlpha)[Index] = Alpha;
+}
+
+void FAnimKeyBatch::SetRotation(int32 Index, const FQuat& Key0, const FQuat& Key1, float Alpha)
+{
+	GetStream(Rot0X)[Index] = Key0.X; GetStream(Rot0Y)[Index] = Key0.Y; GetStream(Rot0Z)[Index] = Key0.Z; GetStream(Rot0W)[Index] = Key0.W;
+	GetStream(Rot1X)[Index] = Key1.X; GetStream(Rot1Y)[Index] = Key1.Y; GetStream(Rot1Z)[Index] = Key1.Z; GetStream(Rot1W)[Index] = Key1.W;
+	GetStream(RotAlpha)[Index] = Alpha;
+}
+
+void FAnimKeyBatch::SetScale(int32 Index, const FVector& Key0, const FVector& Key1, float Alpha)
+{
+	GetStream(Scale0X)[Index] = Key0.X; GetStream(Scale0Y)[Index] = Key0.Y; GetStream(Scale0Z)[Index] = Key0.Z;
+	GetStream(Scale1X)[Index] = Key1.X; GetStream(Scale1Y)[Index] = Key1.Y; GetStream(Scale1Z)[Index] = Key1.Z;
+	GetStream(ScaleAlpha)[Index] = Alpha;
+}
+
+// ============================================================
+// FAnimationRuntime
+// ============================================================
 
 ETypeAdvanceAnim FAnimationRuntime::AdvanceTime(const bool bAllowLooping, const float MoveDelta, float& InOutTime, const float EndTime)
 {
@@ -39,4 +117,214 @@ ETypeAdvanceAnim FAnimationRuntime::AdvanceTime(const bool bAllowLooping, const
 	
 	InOutTime = NewTime;
 	return ETAA_Default;
-}
\ No newline at end of file
+}
+
+void FAnimationRuntime::InterpolateKeyBatch(const FAnimKeyBatch& Batch, const int32* OutIndices, TArray<FTransform>& OutPose)
+{
+	const int32 NumTracks = Batch.Num();
+	const int32 NumOut = OutPose.Num();
+
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128 One = _mm_set1_ps(1.0f);
+	const __m128 SignBit = _mm_set1_ps(-0.0f);
+	const __m128 MinLengthSquared = _mm_set1_ps(1.e-8f);
+
+	// 레인별 결과 (Translation XYZ, Rotation XYZW, Scale XYZ)
+	alignas(16) float Result[10][4];
+
+	for (int32 Base = 0; Base < NumTracks; Base += 4)
+	{
+		auto Load = [&Batch, Base](FAnimKeyBatch::EStream Stream)
+		{
+			return _mm_loadu_ps(Batch.GetStream(Stream) + Base);
+		};
+
+		// 위치/스케일: 성분별 Lerp
+		const __m128 PosAlpha = Load(FAnimKeyBatch::PosAlpha);
+		const __m128 ScaleAlpha = Load(FAnimKeyBatch::ScaleAlpha);
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const __m128 Pos0 = Load(static_cast<FAnimKeyBatch::EStream>(FAnimKeyBatch::Pos0X + Axis));
+			const __m128 Pos1 = Load(static_cast<FAnimKeyBatch::EStream>(FAnimKeyBatch::Pos1X + Axis));
+			_mm_store_ps(Result[Axis], LerpPS(Pos0, Pos1, PosAlpha));
+
+			const __m128 Scale0 = Load(static_cast<FAnimKeyBatch::EStream>(FAnimKeyBatch::Scale0X + Axis));
+			const __m128 Scale1 = Load(static_cast<FAnimKeyBatch::EStream>(FAnimKeyBatch::Scale1X + Axis));
+			_mm_store_ps(Result[7 + Axis], LerpPS(Scale0, Scale1, ScaleAlpha));
+		}
+
+		// 회전: 내적이 음수면 뒤 키 부호를 뒤집어 최단 경로로 Nlerp
+		const __m128 AX = Load(FAnimKeyBatch::Rot0X), AY = Load(FAnimKeyBatch::Rot0Y);
+		const __m128 AZ = Load(FAnimKeyBatch::Rot0Z), AW = Load(FAnimKeyBatch::Rot0W);
+		__m128 BX = Load(FAnimKeyBatch::Rot1X), BY = Load(FAnimKeyBatch::Rot1Y);
+		__m128 BZ = Load(FAnimKeyBatch::Rot1Z), BW = Load(FAnimKeyBatch::Rot1W);
+
+		const __m128 Dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(AX, BX), _mm_mul_ps(AY, BY)),
+			_mm_add_ps(_mm_mul_ps(AZ, BZ), _mm_mul_ps(AW, BW)));
+		const __m128 Flip = _mm_and_ps(_mm_cmplt_ps(Dot, Zero), SignBit);
+		BX = _mm_xor_ps(BX, Flip); BY = _mm_xor_ps(BY, Flip);
+		BZ = _mm_xor_ps(BZ, Flip); BW = _mm_xor_ps(BW, Flip);
+
+		const __m128 RotAlpha = Load(FAnimKeyBatch::RotAlpha);
+		__m128 QX = LerpPS(AX, BX, RotAlpha), QY = LerpPS(AY, BY, RotAlpha);
+		__m128 QZ = LerpPS(AZ, BZ, RotAlpha), QW = LerpPS(AW, BW, RotAlpha);
+
+		// 정규화 (길이가 0에 가까우면 FQuat::Normalize처럼 항등 회전)
+		const __m128 LengthSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(QX, QX), _mm_mul_ps(QY, QY)),
+			_mm_add_ps(_mm_mul_ps(QZ, QZ), _mm_mul_ps(QW, QW)));
+		const __m128 Valid = _mm_cmpgt_ps(LengthSquared, MinLengthSquared);
+		const __m128 InvLength = _mm_and_ps(_mm_div_ps(One, _mm_sqrt_ps(LengthSquared)), Valid);
+		QX = _mm_mul_ps(QX, InvLength);
+		QY = _mm_mul_ps(QY, InvLength);
+		QZ = _mm_mul_ps(QZ, InvLength);
+		QW = _mm_or_ps(_mm_and_ps(Valid, _mm_mul_ps(QW, InvLength)), _mm_andnot_ps(Valid, One));
+		_mm_store_ps(Result[3], QX);
+		_mm_store_ps(Result[4], QY);
+		_mm_store_ps(Result[5], QZ);
+		_mm_store_ps(Result[6], QW);
+
+		const int32 NumLanes = FMath::Min(4, NumTracks - Base);
+		for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+		{
+			const int32 OutIndex = OutIndices[Base + Lane];
+			if (OutIndex < 0 || OutIndex >= NumOut)
+			{
+				continue;
+			}
+
+			FTransform& Out = OutPose[OutIndex];
+			Out.Translation = FVector(Result[0][Lane], Result[1][Lane], Result[2][Lane]);
+			Out.Rotation = FQuat(Result[3][Lane], Result[4][Lane], Result[5][Lane], Result[6][Lane]);
+			Out.Scale3D = FVector(Result[7][Lane], Result[8][Lane], Result[9][Lane]);
+		}
+	}
+}
+void FAnimationRuntime::BuildSkinningPalette(const FTransform* ComponentSpacePose, const FMatrix* InverseBindPoses, int32 NumBones,
+	FMatrix* OutSkinning, FMatrix* OutNormal)
+{
+	static const FTransform IdentityTransform;
+	static const FMatrix IdentityMatrix = FMatrix::Identity();
+
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128 One = _mm_set1_ps(1.0f);
+	const __m128 Two = _mm_set1_ps(2.0f);
+	const __m128 SignBit = _mm_set1_ps(-0.0f);
+	// FMatrix::Inverse와 같은 기준: 행렬식이 너무 작으면 단위 행렬
+	const __m128 MinDet = _mm_set1_ps(KINDA_SMALL_NUMBER);
+
+	// 포즈 SoA (Translation XYZ, Rotation XYZW, Scale XYZ)
+	alignas(16) float Pose[10][4];
+
+	for (int32 Base = 0; Base < NumBones; Base += 4)
+	{
+		const int32 NumLanes = FMath::Min(4, NumBones - Base);
+
+		// 남는 레인은 항등으로 채워 계산은 그대로 돌리고 기록만 생략
+		const FMatrix* Bind[4];
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			const bool bValid = Lane < NumLanes;
+			const FTransform& T = bValid ? ComponentSpacePose[Base + Lane] : IdentityTransform;
+			Pose[0][Lane] = T.Translation.X; Pose[1][Lane] = T.Translation.Y; Pose[2][Lane] = T.Translation.Z;
+			Pose[3][Lane] = T.Rotation.X; Pose[4][Lane] = T.Rotation.Y; Pose[5][Lane] = T.Rotation.Z; Pose[6][Lane] = T.Rotation.W;
+			Pose[7][Lane] = T.Scale3D.X; Pose[8][Lane] = T.Scale3D.Y; Pose[9][Lane] = T.Scale3D.Z;
+			Bind[Lane] = bValid ? &InverseBindPoses[Base + Lane] : &IdentityMatrix;
+		}
+
+		// 역바인드 포즈를 성분별 레인으로 전치: IBP[Row][Col]
+		__m128 IBP[4][4];
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			IBP[Row][0] = Bind[0]->Rows[Row];
+			IBP[Row][1] = Bind[1]->Rows[Row];
+			IBP[Row][2] = Bind[2]->Rows[Row];
+			IBP[Row][3] = Bind[3]->Rows[Row];
+			_MM_TRANSPOSE4_PS(IBP[Row][0], IBP[Row][1], IBP[Row][2], IBP[Row][3]);
+		}
+
+		// FTransform::ToMatrix (S * R * T, 행벡터 규약): 회전 행을 축별 스케일로 곱하고 마지막 행이 이동
+		const __m128 QX = _mm_load_ps(Pose[3]), QY = _mm_load_ps(Pose[4]);
+		const __m128 QZ = _mm_load_ps(Pose[5]), QW = _mm_load_ps(Pose[6]);
+		const __m128 XX = _mm_mul_ps(QX, QX), YY = _mm_mul_ps(QY, QY), ZZ = _mm_mul_ps(QZ, QZ);
+		const __m128 XY = _mm_mul_ps(QX, QY), XZ = _mm_mul_ps(QX, QZ), YZ = _mm_mul_ps(QY, QZ);
+		const __m128 WX = _mm_mul_ps(QW, QX), WY = _mm_mul_ps(QW, QY), WZ = _mm_mul_ps(QW, QZ);
+
+		const __m128 SX = _mm_load_ps(Pose[7]), SY = _mm_load_ps(Pose[8]), SZ = _mm_load_ps(Pose[9]);
+		const __m128 Pose3x4[4][3] =
+		{
+			{
+				_mm_mul_ps(_mm_sub_ps(One, _mm_mul_ps(Two, _mm_add_ps(YY, ZZ))), SX),
+				_mm_mul_ps(_mm_mul_ps(Two, _mm_add_ps(XY, WZ)), SX),
+				_mm_mul_ps(_mm_mul_ps(Two, _mm_sub_ps(XZ, WY)), SX),
+			},
+			{
+				_mm_mul_ps(_mm_mul_ps(Two, _mm_sub_ps(XY, WZ)), SY),
+				_mm_mul_ps(_mm_sub_ps(One, _mm_mul_ps(Two, _mm_add_ps(XX, ZZ))), SY),
+				_mm_mul_ps(_mm_mul_ps(Two, _mm_add_ps(YZ, WX)), SY),
+			},
+			{
+				_mm_mul_ps(_mm_mul_ps(Two, _mm_add_ps(XZ, WY)), SZ),
+				_mm_mul_ps(_mm_mul_ps(Two, _mm_sub_ps(YZ, WX)), SZ),
+				_mm_mul_ps(_mm_sub_ps(One, _mm_mul_ps(Two, _mm_add_ps(XX, YY))), SZ),
+			},
+			{ _mm_load_ps(Pose[0]), _mm_load_ps(Pose[1]), _mm_load_ps(Pose[2]) },
+		};
+
+		// Skin = IBP * Pose (포즈 행렬의 4열은 (0,0,0,1)이라 Skin의 4열은 IBP의 4열 그대로)
+		__m128 Skin[4][4];
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			for (int32 Col = 0; Col < 3; ++Col)
+			{
+				Skin[Row][Col] = _mm_add_ps(
+					_mm_add_ps(_mm_mul_ps(IBP[Row][0], Pose3x4[0][Col]), _mm_mul_ps(IBP[Row][1], Pose3x4[1][Col])),
+					_mm_add_ps(_mm_mul_ps(IBP[Row][2], Pose3x4[2][Col]), _mm_mul_ps(IBP[Row][3], Pose3x4[3][Col])));
+			}
+			Skin[Row][3] = IBP[Row][3];
+		}
+		StoreMatrixLanes(Skin, OutSkinning + Base, NumLanes);
+
+		// 노멀 행렬: 아핀 행렬 [A 0; t 1]의 역전치는 [A^-T (-t*A^-1)^T; 0 1]
+		// A^-T의 행은 A 행끼리의 외적 / det 이므로 일반 4x4 역행렬 없이 외적 3번 + 내적 4번
+		const __m128 (&A0)[4] = Skin[0];
+		const __m128 (&A1)[4] = Skin[1];
+		const __m128 (&A2)[4] = Skin[2];
+		const __m128 Cof[3][3] =
+		{
+			{	// A1 x A2
+				_mm_sub_ps(_mm_mul_ps(A1[1], A2[2]), _mm_mul_ps(A1[2], A2[1])),
+				_mm_sub_ps(_mm_mul_ps(A1[2], A2[0]), _mm_mul_ps(A1[0], A2[2])),
+				_mm_sub_ps(_mm_mul_ps(A1[0], A2[1]), _mm_mul_ps(A1[1], A2[0])),
+			},
+			{	// A2 x A0
+				_mm_sub_ps(_mm_mul_ps(A2[1], A0[2]), _mm_mul_ps(A2[2], A0[1])),
+				_mm_sub_ps(_mm_mul_ps(A2[2], A0[0]), _mm_mul_ps(A2[0], A0[2])),
+				_mm_sub_ps(_mm_mul_ps(A2[0], A0[1]), _mm_mul_ps(A2[1], A0[0])),
+			},
+			{	// A0 x A1
+				_mm_sub_ps(_mm_mul_ps(A0[1], A1[2]), _mm_mul_ps(A0[2], A1[1])),
+				_mm_sub_ps(_mm_mul_ps(A0[2], A1[0]), _mm_mul_ps(A0[0], A1[2])),
+				_mm_sub_ps(_mm_mul_ps(A0[0], A1[1]), _mm_mul_ps(A0[1], A1[0])),
+			},
+		};
+
+		const __m128 Det = Dot3PS(A0[0], A0[1], A0[2], Cof[0][0], Cof[0][1], Cof[0][2]);
+		const __m128 Valid = _mm_cmpge_ps(_mm_andnot_ps(SignBit, Det), MinDet);
+		const __m128 InvDet = _mm_and_ps(_mm_div_ps(One, Det), Valid);
+
+		__m128 Normal[4][4];
+		for (int32 Row = 0; Row < 3; ++Row)
+		{
+			for (int32 Col = 0; Col < 3; ++Col)
+			{
+				const __m128 Fallback = Row == Col ? One : Zero;
+				Normal[Row][Col] = _mm_or_ps(_mm_and_ps(Valid, _mm_mul_ps(Cof[Row][Col], InvDet)), _mm_andnot_ps(Valid, Fallback));
+			}
+			// Valid가 아니면 Normal 행이 단위 행이어도 InvDet이 0이라 아래 항이 0
+			Normal[Row][3] = _mm_xor_ps(SignBit, _mm_mul_ps(
+				Dot3PS(Skin[3][0], Skin[3][1], Skin[3][2], Cof[Row][0], Cof[Row][1], Cof[Row][2]), InvDet));
+		}
+		Normal[3][0] = Zero; Normal[3][1] = Zero; Normal[3][2] = Zero; Normal[3][3] = One;
+		StoreMatrixLanes(Normal, OutNormal + Base, NumLanes);
+	}
+}
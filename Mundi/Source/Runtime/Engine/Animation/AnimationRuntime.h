@@ -1,10 +1,61 @@
 ﻿#pragma once 
 #include "AnimTypes.h"
 
+/**
+ * @brief 본 트랙 보간 입력 (채널 성분별 SoA)
+ * - 트랙마다 앞/뒤 키와 보간 비율을 채운 뒤 FAnimationRuntime::InterpolateKeyBatch로 4개씩 묶어 보간
+ * - 압축 트랙은 채널마다 남은 키 위치가 달라서 Alpha도 채널별로 둔다
+ */
+struct FAnimKeyBatch
+{
+	enum EStream : int32
+	{
+		Pos0X, Pos0Y, Pos0Z, Pos1X, Pos1Y, Pos1Z, PosAlpha,
+		Rot0X, Rot0Y, Rot0Z, Rot0W, Rot1X, Rot1Y, Rot1Z, Rot1W, RotAlpha,
+		Scale0X, Scale0Y, Scale0Z, Scale1X, Scale1Y, Scale1Z, ScaleAlpha,
+		NumStreams
+	};
+
+	/** 트랙 수 설정 (4의 배수로 패딩, 패딩 칸은 항등 트랜스폼) */
+	void Reset(int32 InNumTracks);
+
+	int32 Num() const { return NumTracks; }
+	/** 패딩 포함 스트림 길이 */
+	int32 GetCapacity() const { return Capacity; }
+
+	float* GetStream(EStream Stream) { return Data.data() + Stream * Capacity; }
+	const float* GetStream(EStream Stream) const { return Data.data() + Stream * Capacity; }
+
+	void SetTranslation(int32 Index, const FVector& Key0, const FVector& Key1, float Alpha);
+	void SetRotation(int32 Index, const FQuat& Key0, const FQuat& Key1, float Alpha);
+	void SetScale(int32 Index, const FVector& Key0, const FVector& Key1, float Alpha);
+
+private:
+	TArray<float> Data;
+	int32 NumTracks = 0;
+	int32 Capacity = 0;
+};
+
 class FAnimationRuntime
 {
 public:
 
 	static ETypeAdvanceAnim AdvanceTime(const bool bAllowLooping, const float MoveDelta, float& InOutTime, const float EndTime);
 
+	/**
+	 * 배치의 모든 트랙을 SSE로 4개씩 보간해 OutPose[OutIndices[i]]에 기록
+	 * 위치/스케일은 Lerp, 회전은 최단 경로 Nlerp
+	 * @param OutIndices 트랙 -> 출력 인덱스 (INDEX_NONE이거나 범위를 벗어나면 건너뜀)
+	 */
+	static void InterpolateKeyBatch(const FAnimKeyBatch& Batch, const int32* OutIndices, TArray<FTransform>& OutPose);
+
+	/**
+	 * 컴포넌트 공간 포즈로 스키닝 팔레트 생성 (본 4개씩 SoA로 모아 SSE 처리)
+	 * OutSkinning[i] = InverseBindPoses[i] * ComponentSpacePose[i].ToMatrix()
+	 * OutNormal[i]   = OutSkinning[i].Inverse().Transpose() (아핀 행렬이므로 3x3 여인수로 계산)
+	 * @param InverseBindPoses 연속 배열 (USkeletalMesh::GetInverseBindPoses)
+	 */
+	static void BuildSkinningPalette(const FTransform* ComponentSpacePose, const FMatrix* InverseBindPoses, int32 NumBones,
+		FMatrix* OutSkinning, FMatrix* OutNormal);
+
 };
\ No newline at end of file
@@ -0,0 +1,251 @@
+﻿#include "pch.h"
+#include "CPUSkinning.h"
+#include "ParallelFor.h"
+#include <immintrin.h>
+
+namespace
+{
+	/**
+	 * 가중치로 스키닝 행렬 4행 + 노멀 행렬 3행을 합성
+	 * 인플루언스는 가중치 내림차순이라 첫 0 가중치에서 멈춘다 (본 1~2개인 정점이 대부분)
+	 */
+	inline void BlendRows(const FMatrix* SkinningMatrices, const FMatrix* NormalMatrices, const FCompactSkinInfluence& Influence,
+		const __m128 (&Weights)[4], __m128 (&OutSkinRows)[4], __m128 (&OutNormalRows)[3])
+	{
+		const FMatrix& Skin0 = SkinningMatrices[Influence.BoneIndices[0]];
+		const FMatrix& Normal0 = NormalMatrices[Influence.BoneIndices[0]];
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			OutSkinRows[Row] = _mm_mul_ps(Weights[0], Skin0.Rows[Row]);
+		}
+		for (int32 Row = 0; Row < 3; ++Row)
+		{
+			OutNormalRows[Row] = _mm_mul_ps(Weights[0], Normal0.Rows[Row]);
+		}
+
+		for (int32 Slot = 1; Slot < 4 && Influence.BoneWeights[Slot] != 0; ++Slot)
+		{
+			const FMatrix& Skin = SkinningMatrices[Influence.BoneIndices[Slot]];
+			const FMatrix& Normal = NormalMatrices[Influence.BoneIndices[Slot]];
+			for (int32 Row = 0; Row < 4; ++Row)
+			{
+				OutSkinRows[Row] = _mm_add_ps(OutSkinRows[Row], _mm_mul_ps(Weights[Slot], Skin.Rows[Row]));
+			}
+			for (int32 Row = 0; Row < 3; ++Row)
+			{
+				OutNormalRows[Row] = _mm_add_ps(OutNormalRows[Row], _mm_mul_ps(Weights[Slot], Normal.Rows[Row]));
+			}
+		}
+	}
+
+	/** 행벡터 규약 V * M (Rows[0..2]만 사용) */
+	inline __m128 TransformVector3(const FVector& V, const __m128* Rows)
+	{
+		return _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(V.X), Rows[0]), _mm_mul_ps(_mm_set1_ps(V.Y), Rows[1])),
+			_mm_mul_ps(_mm_set1_ps(V.Z), Rows[2]));
+	}
+
+	/** 레인별 xyz 벡터 4개를 SoA로 정규화 (길이가 KINDA_SMALL_NUMBER 이하면 GetSafeNormal처럼 0) */
+	inline void NormalizeLanes(float (&Lanes)[4][4])
+	{
+		__m128 X = _mm_load_ps(Lanes[0]), Y = _mm_load_ps(Lanes[1]), Z = _mm_load_ps(Lanes[2]), W = _mm_load_ps(Lanes[3]);
+		_MM_TRANSPOSE4_PS(X, Y, Z, W);
+
+		const __m128 LengthSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, X), _mm_mul_ps(Y, Y)), _mm_mul_ps(Z, Z));
+		const __m128 Length = _mm_sqrt_ps(LengthSquared);
+		const __m128 Valid = _mm_cmpgt_ps(Length, _mm_set1_ps(KINDA_SMALL_NUMBER));
+		const __m128 InvLength = _mm_and_ps(_mm_div_ps(_mm_set1_ps(1.0f), Length), Valid);
+		X = _mm_mul_ps(X, InvLength);
+		Y = _mm_mul_ps(Y, InvLength);
+		Z = _mm_mul_ps(Z, InvLength);
+
+		_MM_TRANSPOSE4_PS(X, Y, Z, W);
+		_mm_store_ps(Lanes[0], X);
+		_mm_store_ps(Lanes[1], Y);
+		_mm_store_ps(Lanes[2], Z);
+		_mm_store_ps(Lanes[3], W);
+	}
+}
+
+bool FCPUSkinning::BuildCompactInfluences(const TArray<FSkinnedVertex>& Vertices, int32 NumBones, TArray<FCompactSkinInfluence>& OutInfluences)
+{
+	OutInfluences.Empty();
+	if (NumBones <= 0 || NumBones > 256)
+	{
+		return false;
+	}
+
+	OutInfluences.SetNum(Vertices.Num());
+	for (int32 VertexIndex = 0; VertexIndex < Vertices.Num(); ++VertexIndex)
+	{
+		const FSkinnedVertex& Vertex = Vertices[VertexIndex];
+		FCompactSkinInfluence& Out = OutInfluences[VertexIndex];
+
+		// 범위를 벗어난 본은 가중치 0으로 취급 (스칼라 경로에선 잘못된 메모리를 읽던 경우)
+		int32 Order[4] = { 0, 1, 2, 3 };
+		float Weights[4];
+		float WeightSum = 0.0f;
+		for (int32 Slot = 0; Slot < 4; ++Slot)
+		{
+			const bool bValid = Vertex.BoneWeights[Slot] > 0.0f && Vertex.BoneIndices[Slot] < static_cast<uint32>(NumBones);
+			Weights[Slot] = bValid ? Vertex.BoneWeights[Slot] : 0.0f;
+			WeightSum += Weights[Slot];
+		}
+
+		// 가중치 내림차순으로 정렬해 커널이 첫 0 가중치에서 멈출 수 있게
+		std::stable_sort(Order, Order + 4, [&Weights](int32 A, int32 B) { return Weights[A] > Weights[B]; });
+
+		// 유효한 인플루언스가 하나라도 있으면 합을 255로 재정규화
+		// (원본 합 그대로 양자화하면 합이 1/510 미만인 정점은 전부 0이 돼 원점으로 무너짐)
+		const float QuantizeScale = WeightSum > 0.0f ? 255.0f / WeightSum : 0.0f;
+		int32 Quantized[4];
+		int32 QuantizedSum = 0;
+		for (int32 Slot = 0; Slot < 4; ++Slot)
+		{
+			Quantized[Slot] = static_cast<int32>(std::lround(Weights[Order[Slot]] * QuantizeScale));
+			QuantizedSum += Quantized[Slot];
+		}
+
+		// 반올림 오차는 가장 큰 가중치에 몰아 합이 정확히 255가 되게 (가장 큰 가중치는 최소 64라 음수가 되지 않음)
+		const int32 TargetSum = WeightSum > 0.0f ? 255 : 0;
+		Quantized[0] = FMath::Clamp(Quantized[0] + (TargetSum - QuantizedSum), 0, 255);
+
+		for (int32 Slot = 0; Slot < 4; ++Slot)
+		{
+			const bool bUsed = Quantized[Slot] > 0;
+			Out.BoneIndices[Slot] = bUsed ? static_cast<uint8>(Vertex.BoneIndices[Order[Slot]]) : 0;
+			Out.BoneWeights[Slot] = static_cast<uint8>(Quantized[Slot]);
+		}
+	}
+	return true;
+}
+
+void FCPUSkinning::SkinVertices(const FSkinnedVertex* Src, const FCompactSkinInfluence* Influences, int32 NumVertices,
+	const FMatrix* SkinningMatrices, const FMatrix* NormalMatrices, FVertexDynamic* Out)
+{
+	if (NumVertices <= 0)
+	{
+		return;
+	}
+
+	const int32 NumTasks = (NumVertices + VerticesPerTask - 1) / VerticesPerTask;
+	ParallelFor(NumTasks, [=](int32 TaskIndex)
+	{
+		const int32 StartIndex = TaskIndex * VerticesPerTask;
+		const int32 EndIndex = FMath::Min(StartIndex + VerticesPerTask, NumVertices);
+		if (Influences)
+		{
+			SkinVerticesCompact(Src, Influences, StartIndex, EndIndex, SkinningMatrices, NormalMatrices, Out);
+		}
+		else
+		{
+			SkinVerticesReference(Src, StartIndex, EndIndex, SkinningMatrices, NormalMatrices, Out);
+		}
+	});
+}
+
+void FCPUSkinning::SkinVerticesReference(const FSkinnedVertex* Src, int32 StartIndex, int32 EndIndex,
+	const FMatrix* SkinningMatrices, const FMatrix* NormalMatrices, FVertexDynamic* Out)
+{
+	for (int32 VertexIndex = StartIndex; VertexIndex < EndIndex; ++VertexIndex)
+	{
+		const FSkinnedVertex& SrcVert = Src[VertexIndex];
+
+		FVector BlendedPosition(0.f, 0.f, 0.f);
+		FVector BlendedNormal(0.f, 0.f, 0.f);
+		FVector BlendedTangentDir(0.f, 0.f, 0.f);
+		const FVector OriginalTangentDir(SrcVert.Tangent.X, SrcVert.Tangent.Y, SrcVert.Tangent.Z);
+
+		for (int32 Idx = 0; Idx < 4; ++Idx)
+		{
+			const uint32 BoneIndex = SrcVert.BoneIndices[Idx];
+			const float Weight = SrcVert.BoneWeights[Idx];
+
+			if (Weight > 0.f)
+			{
+				const FMatrix& SkinMatrix = SkinningMatrices[BoneIndex];
+				BlendedPosition += SkinMatrix.TransformPosition(SrcVert.Position) * Weight;
+				BlendedNormal += NormalMatrices[BoneIndex].TransformVector(SrcVert.Normal) * Weight;
+				BlendedTangentDir += SkinMatrix.TransformVector(OriginalTangentDir) * Weight;
+			}
+		}
+
+		FVertexDynamic& DstVert = Out[VertexIndex];
+		const FVector FinalTangentDir = BlendedTangentDir.GetSafeNormal();
+		DstVert.Position = BlendedPosition;
+		DstVert.Normal = BlendedNormal.GetSafeNormal();
+		DstVert.UV = SrcVert.UV;
+		DstVert.Tangent = FVector4(FinalTangentDir.X, FinalTangentDir.Y, FinalTangentDir.Z, SrcVert.Tangent.W);
+		DstVert.Color = FVector4(0.0f, 0.0f, 0.0f, 0.0f);
+	}
+}
+
+void FCPUSkinning::SkinVerticesCompact(const FSkinnedVertex* Src, const FCompactSkinInfluence* Influences, int32 StartIndex, int32 EndIndex,
+	const FMatrix* SkinningMatrices, const FMatrix* NormalMatrices, FVertexDynamic* Out)
+{
+	const __m128 WeightScale = _mm_set1_ps(1.0f / 255.0f);
+	const __m128i ZeroInt = _mm_setzero_si128();
+
+	// 정점 4개를 로컬에서 완성한 뒤 한 번에 복사 (매핑된 버퍼는 write-combined라 연속 기록이 유리)
+	alignas(16) FVertexDynamic Block[4];
+	alignas(16) float Position[4][4];
+	alignas(16) float Normal[4][4];
+	alignas(16) float Tangent[4][4];
+
+	for (int32 Base = StartIndex; Base < EndIndex; Base += 4)
+	{
+		const int32 NumLanes = FMath::Min(4, EndIndex - Base);
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			if (Lane >= NumLanes)
+			{
+				// 남는 레인은 정규화 입력만 0으로
+				_mm_store_ps(Normal[Lane], _mm_setzero_ps());
+				_mm_store_ps(Tangent[Lane], _mm_setzero_ps());
+				continue;
+			}
+
+			const FSkinnedVertex& SrcVert = Src[Base + Lane];
+			const FCompactSkinInfluence& Influence = Influences[Base + Lane];
+
+			// uint8 가중치 4개 -> float (SSE2 unpack)
+			int32 PackedWeights;
+			std::memcpy(&PackedWeights, Influence.BoneWeights, sizeof(PackedWeights));
+			const __m128i Weights8 = _mm_cvtsi32_si128(PackedWeights);
+			const __m128i Weights32 = _mm_unpacklo_epi16(_mm_unpacklo_epi8(Weights8, ZeroInt), ZeroInt);
+			const __m128 WeightsPS = _mm_mul_ps(_mm_cvtepi32_ps(Weights32), WeightScale);
+			const __m128 Weights[4] =
+			{
+				_mm_shuffle_ps(WeightsPS, WeightsPS, _MM_SHUFFLE(0, 0, 0, 0)),
+				_mm_shuffle_ps(WeightsPS, WeightsPS, _MM_SHUFFLE(1, 1, 1, 1)),
+				_mm_shuffle_ps(WeightsPS, WeightsPS, _MM_SHUFFLE(2, 2, 2, 2)),
+				_mm_shuffle_ps(WeightsPS, WeightsPS, _MM_SHUFFLE(3, 3, 3, 3)),
+			};
+
+			// 변환이 선형이므로 "변환 후 가중 합" 대신 "행렬 가중 합 후 한 번 변환"
+			__m128 SkinRows[4];
+			__m128 NormalRows[3];
+			BlendRows(SkinningMatrices, NormalMatrices, Influence, Weights, SkinRows, NormalRows);
+
+			const FVector TangentDir(SrcVert.Tangent.X, SrcVert.Tangent.Y, SrcVert.Tangent.Z);
+			_mm_store_ps(Position[Lane], _mm_add_ps(TransformVector3(SrcVert.Position, SkinRows), SkinRows[3]));
+			_mm_store_ps(Normal[Lane], TransformVector3(SrcVert.Normal, NormalRows));
+			_mm_store_ps(Tangent[Lane], TransformVector3(TangentDir, SkinRows));
+		}
+
+		NormalizeLanes(Normal);
+		NormalizeLanes(Tangent);
+
+		for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+		{
+			const FSkinnedVertex& SrcVert = Src[Base + Lane];
+			FVertexDynamic& DstVert = Block[Lane];
+			DstVert.Position = FVector(Position[Lane][0], Position[Lane][1], Position[Lane][2]);
+			DstVert.Normal = FVector(Normal[Lane][0], Normal[Lane][1], Normal[Lane][2]);
+			DstVert.UV = SrcVert.UV;
+			DstVert.Tangent = FVector4(Tangent[Lane][0], Tangent[Lane][1], Tangent[Lane][2], SrcVert.Tangent.W);
+			DstVert.Color = FVector4(0.0f, 0.0f, 0.0f, 0.0f);
+		}
+		std::memcpy(Out + Base, Block, sizeof(FVertexDynamic) * NumLanes);
+	}
+}
@@ -0,0 +1,46 @@
+﻿#pragma once
+
+/**
+ * @brief 8비트 본 인덱스/가중치 (본 256개 이하 메시용 압축 인플루언스)
+ * - FSkinnedVertex의 uint32 인덱스 + float 가중치(32바이트)를 8바이트로 줄여 스키닝 중 읽는 양을 줄인다
+ * - 가중치 내림차순 정렬, 유효 인플루언스가 있으면 합을 255로 재정규화하고, 가중치 0인 칸은 인덱스 0
+ */
+struct FCompactSkinInfluence
+{
+	uint8 BoneIndices[4];
+	uint8 BoneWeights[4];
+};
+
+/**
+ * @brief CPU 스키닝 엔진 (D3D 의존 없음, 출력은 매핑된 동적 버퍼 포인터나 일반 배열 모두 가능)
+ * - SkinVertices: 정점 범위를 VerticesPerTask 단위로 워커에 나눠 처리
+ * - 압축 인플루언스가 있으면 SSE로 정점 4개씩, 없으면(본 256개 초과) 기존 스칼라 경로
+ * - 출력 색상은 기존 CPU 스키닝과 같이 0으로 채운다
+ */
+class FCPUSkinning
+{
+public:
+	/** 워커 하나가 맡는 정점 수 (4의 배수) */
+	static constexpr int32 VerticesPerTask = 2048;
+
+	/**
+	 * 원본 정점으로 압축 인플루언스 생성
+	 * @return 본이 256개를 넘어 8비트 인덱스로 표현할 수 없으면 false (OutInfluences는 비움)
+	 */
+	static bool BuildCompactInfluences(const TArray<FSkinnedVertex>& Vertices, int32 NumBones, TArray<FCompactSkinInfluence>& OutInfluences);
+
+	/**
+	 * [0, NumVertices) 정점을 스키닝해 Out에 정점 순서대로 기록
+	 * @param Influences nullptr이면 스칼라 경로
+	 */
+	static void SkinVertices(const FSkinnedVertex* Src, const FCompactSkinInfluence* Influences, int32 NumVertices,
+		const FMatrix* SkinningMatrices, const FMatrix* NormalMatrices, FVertexDynamic* Out);
+
+	/** 기존 USkinnedMeshComponent 본별 스칼라 경로 (검증 기준) */
+	static void SkinVerticesReference(const FSkinnedVertex* Src, int32 StartIndex, int32 EndIndex,
+		const FMatrix* SkinningMatrices, const FMatrix* NormalMatrices, FVertexDynamic* Out);
+
+	/** 압축 인플루언스 SSE 경로: 정점마다 행렬을 가중 합성해 변환하고 노멀/탄젠트 정규화는 4개씩 */
+	static void SkinVerticesCompact(const FSkinnedVertex* Src, const FCompactSkinInfluence* Influences, int32 StartIndex, int32 EndIndex,
+		const FMatrix* SkinningMatrices, const FMatrix* NormalMatrices, FVertexDynamic* Out);
+};
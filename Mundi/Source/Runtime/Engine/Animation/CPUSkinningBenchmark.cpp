@@ -0,0 +1,147 @@
+﻿#include "pch.h"
+#include "CPUSkinningBenchmark.h"
+#include "CPUSkinning.h"
+#include "AnimationRuntime.h"
+#include "SkeletalMesh.h"
+#include "PlatformTime.h"
+#include <random>
+
+namespace
+{
+	struct FSkinningError
+	{
+		float Position = 0.0f;
+		float Normal = 0.0f;
+		float Tangent = 0.0f;
+	};
+
+	FSkinningError MeasureError(const TArray<FVertexDynamic>& Reference, const TArray<FVertexDynamic>& Result)
+	{
+		FSkinningError Error;
+		for (int32 Index = 0; Index < Reference.Num(); ++Index)
+		{
+			const FVertexDynamic& A = Reference[Index];
+			const FVertexDynamic& B = Result[Index];
+			Error.Position = FMath::Max(Error.Position, (A.Position - B.Position).Size());
+			Error.Normal = FMath::Max(Error.Normal, (A.Normal - B.Normal).Size());
+			const FVector TangentDelta(A.Tangent.X - B.Tangent.X, A.Tangent.Y - B.Tangent.Y, A.Tangent.Z - B.Tangent.Z);
+			Error.Tangent = FMath::Max(Error.Tangent, TangentDelta.Size() + std::fabs(A.Tangent.W - B.Tangent.W));
+		}
+		return Error;
+	}
+
+	/** 본마다 바인드 포즈 근처의 임의 회전/이동 (실제 애니메이션처럼 인접 본끼리 크게 벌어지지 않는 범위) */
+	void BuildPalette(int32 NumBones, std::mt19937& Rng, TArray<FMatrix>& OutSkinning, TArray<FMatrix>& OutNormal)
+	{
+		std::uniform_real_distribution<float> Angle(-0.3f, 0.3f);
+		std::uniform_real_distribution<float> Offset(-2.0f, 2.0f);
+
+		TArray<FTransform> Pose;
+		TArray<FMatrix> Identity;
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			FQuat Rotation(Angle(Rng), Angle(Rng), Angle(Rng), 1.0f);
+			Rotation.Normalize();
+			Pose.Add(FTransform(FVector(Offset(Rng), Offset(Rng), Offset(Rng)), Rotation, FVector(1.0f, 1.0f, 1.0f)));
+			Identity.Add(FMatrix::Identity());
+		}
+
+		OutSkinning.SetNum(NumBones);
+		OutNormal.SetNum(NumBones);
+		FAnimationRuntime::BuildSkinningPalette(Pose.data(), Identity.data(), NumBones, OutSkinning.data(), OutNormal.data());
+	}
+
+	double NsPerVertex(double Ms, int32 Iterations, int32 NumVertices)
+	{
+		const double Count = static_cast<double>(Iterations) * NumVertices;
+		return Count > 0.0 ? Ms * 1.0e6 / Count : 0.0;
+	}
+}
+
+void FCPUSkinningBenchmark::Run(int32 Iterations)
+{
+	std::mt19937 Rng(12345);
+	int32 NumMeshes = 0;
+
+	for (USkeletalMesh* Mesh : RESOURCE.GetAll<USkeletalMesh>())
+	{
+		const FSkeletalMeshData* Data = Mesh ? Mesh->GetSkeletalMeshData() : nullptr;
+		if (!Data || Data->Vertices.IsEmpty() || Data->Skeleton.Bones.IsEmpty()) { continue; }
+
+		const TArray<FSkinnedVertex>& Vertices = Data->Vertices;
+		const int32 NumVertices = Vertices.Num();
+		const int32 NumBones = Data->Skeleton.Bones.Num();
+		const FCompactSkinInfluence* Influences = Mesh->GetCompactSkinInfluences();
+
+		TArray<FMatrix> Skinning, Normal;
+		BuildPalette(NumBones, Rng, Skinning, Normal);
+
+		TArray<FVertexDynamic> Reference, Compact, Threaded;
+		Reference.SetNum(NumVertices);
+		Compact.SetNum(NumVertices);
+		Threaded.SetNum(NumVertices);
+
+		// 기존 스칼라 경로 (단일 스레드)
+		uint64 Start = FPlatformTime::Cycles64();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			FCPUSkinning::SkinVerticesReference(Vertices.data(), 0, NumVertices, Skinning.data(), Normal.data(), Reference.data());
+		}
+		const double ReferenceMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+		// 압축 SSE 경로 (단일 스레드)
+		double CompactMs = 0.0;
+		if (Influences)
+		{
+			Start = FPlatformTime::Cycles64();
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				FCPUSkinning::SkinVerticesCompact(Vertices.data(), Influences, 0, NumVertices, Skinning.data(), Normal.data(), Compact.data());
+			}
+			CompactMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+		}
+
+		// 실제 컴포넌트가 쓰는 경로 (정점 범위를 워커에 분배)
+		Start = FPlatformTime::Cycles64();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			FCPUSkinning::SkinVertices(Vertices.data(), Influences, NumVertices, Skinning.data(), Normal.data(), Threaded.data());
+		}
+		const double ThreadedMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+		const FSkinningError TotalError = MeasureError(Reference, Threaded);
+
+		// 커널 자체 오차: 양자화된 가중치를 float로 되돌려 스칼라 경로로 다시 계산한 결과와 비교
+		FSkinningError KernelError;
+		if (Influences)
+		{
+			TArray<FSkinnedVertex> Dequantized = Vertices;
+			for (int32 Index = 0; Index < NumVertices; ++Index)
+			{
+				for (int32 Slot = 0; Slot < 4; ++Slot)
+				{
+					Dequantized[Index].BoneIndices[Slot] = Influences[Index].BoneIndices[Slot];
+					Dequantized[Index].BoneWeights[Slot] = Influences[Index].BoneWeights[Slot] / 255.0f;
+				}
+			}
+			TArray<FVertexDynamic> DequantizedReference;
+			DequantizedReference.SetNum(NumVertices);
+			FCPUSkinning::SkinVerticesReference(Dequantized.data(), 0, NumVertices, Skinning.data(), Normal.data(), DequantizedReference.data());
+			KernelError = MeasureError(DequantizedReference, Compact);
+		}
+
+		char Buf[512];
+		std::snprintf(Buf, sizeof(Buf),
+			"[CPU Skin Bench] %-32s verts=%-6d bones=%-3d %s | scalar %5.1f ns/v, simd %5.1f ns/v, threaded %.3f ms/mesh | err vs scalar pos %.2e nrm %.2e tan %.2e | kernel err pos %.2e nrm %.2e\r\n",
+			Mesh->GetPathFileName().c_str(), NumVertices, NumBones, Influences ? "8bit" : "float",
+			NsPerVertex(ReferenceMs, Iterations, NumVertices), NsPerVertex(CompactMs, Iterations, NumVertices), ThreadedMs / Iterations,
+			TotalError.Position, TotalError.Normal, TotalError.Tangent, KernelError.Position, KernelError.Normal);
+		UE_LOG(Buf);
+		NumMeshes++;
+	}
+
+	if (NumMeshes == 0)
+	{
+		UE_LOG("[CPU Skin Bench] no skeletal mesh loaded\r\n");
+	}
+}
@@ -0,0 +1,13 @@
+﻿#pragma once
+
+/**
+ * @brief CPU 스키닝 경로 비교 (디바이스 없이 일반 배열에 출력)
+ * - 로드된 USkeletalMesh마다 임의 포즈 팔레트로 기존 스칼라 경로 / 압축 SSE 경로 / 멀티스레드 경로를 실행
+ * - 스칼라 결과 대비 최대 오차(8비트 가중치 양자화 포함)와, 양자화된 가중치로 돌린 스칼라 결과 대비 커널 오차를 함께 출력
+ * - 콘솔 명령 "BENCH CPUSKIN"으로 실행, 결과는 UE_LOG로 출력
+ */
+class FCPUSkinningBenchmark
+{
+public:
+	static void Run(int32 Iterations = 20);
+};
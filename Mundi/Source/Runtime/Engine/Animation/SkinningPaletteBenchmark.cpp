@@ -0,0 +1,122 @@
+﻿#include "pch.h"
+#include "SkinningPaletteBenchmark.h"
+#include "AnimationRuntime.h"
+#include "PlatformTime.h"
+#include <random>
+
+namespace
+{
+	struct FSkeletonInput
+	{
+		TArray<FTransform> ComponentSpacePose;
+		TArray<FMatrix> InverseBindPoses;
+	};
+
+	FQuat RandomRotation(std::mt19937& Rng)
+	{
+		std::uniform_real_distribution<float> Dist(-1.0f, 1.0f);
+		FQuat Q(Dist(Rng), Dist(Rng), Dist(Rng), Dist(Rng));
+		Q.Normalize();
+		return Q;
+	}
+
+	void BuildInput(int32 NumBones, std::mt19937& Rng, FSkeletonInput& OutInput)
+	{
+		std::uniform_real_distribution<float> Offset(-50.0f, 50.0f);
+		std::uniform_real_distribution<float> Scale(0.8f, 1.2f);
+
+		OutInput.ComponentSpacePose.Empty();
+		OutInput.InverseBindPoses.Empty();
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			// 본 3개 중 하나는 비균등 스케일 (노말 행렬이 회전과 달라지는 경우)
+			const float Uniform = Scale(Rng);
+			const FVector PoseScale = (BoneIndex % 3 == 0) ? FVector(Scale(Rng), Scale(Rng), Scale(Rng)) : FVector(Uniform, Uniform, Uniform);
+			OutInput.ComponentSpacePose.Add(FTransform(FVector(Offset(Rng), Offset(Rng), Offset(Rng)), RandomRotation(Rng), PoseScale));
+
+			const FTransform BindPose(FVector(Offset(Rng), Offset(Rng), Offset(Rng)), RandomRotation(Rng), FVector(1.0f, 1.0f, 1.0f));
+			OutInput.InverseBindPoses.Add(BindPose.ToMatrix().Inverse());
+		}
+	}
+
+	double SumMatrices(const TArray<FMatrix>& Matrices)
+	{
+		double Sum = 0.0;
+		for (const FMatrix& M : Matrices)
+		{
+			Sum += static_cast<double>(M.M[0][0] + M.M[1][1] + M.M[2][2] + M.M[3][0]);
+		}
+		return Sum;
+	}
+
+	/** 두 팔레트의 성분별 최대 상대 오차 */
+	float MaxRelativeError(const TArray<FMatrix>& A, const TArray<FMatrix>& B)
+	{
+		float MaxError = 0.0f;
+		for (int32 Index = 0; Index < A.Num(); ++Index)
+		{
+			for (int32 Row = 0; Row < 4; ++Row)
+			{
+				for (int32 Col = 0; Col < 4; ++Col)
+				{
+					const float Reference = A[Index].M[Row][Col];
+					MaxError = FMath::Max(MaxError, std::fabs(Reference - B[Index].M[Row][Col]) / (1.0f + std::fabs(Reference)));
+				}
+			}
+		}
+		return MaxError;
+	}
+}
+
+void FSkinningPaletteBenchmark::Run(int32 Iterations)
+{
+	std::mt19937 Rng(12345);
+	const int32 BoneCounts[] = { 60, 120, 250 };
+
+	for (int32 NumBones : BoneCounts)
+	{
+		FSkeletonInput Input;
+		BuildInput(NumBones, Rng, Input);
+
+		TArray<FMatrix> ScalarSkinning, ScalarNormal, SimdSkinning, SimdNormal;
+		ScalarSkinning.SetNum(NumBones);
+		ScalarNormal.SetNum(NumBones);
+		SimdSkinning.SetNum(NumBones);
+		SimdNormal.SetNum(NumBones);
+
+		double Checksum = 0.0;
+
+		// 기존 USkeletalMeshComponent::UpdateFinalSkinningMatrices 본별 경로
+		uint64 Start = FPlatformTime::Cycles64();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+			{
+				ScalarSkinning[BoneIndex] = Input.InverseBindPoses[BoneIndex] * Input.ComponentSpacePose[BoneIndex].ToMatrix();
+				ScalarNormal[BoneIndex] = ScalarSkinning[BoneIndex].Inverse().Transpose();
+			}
+			Checksum += SumMatrices(ScalarNormal);
+		}
+		const double ScalarMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+		Start = FPlatformTime::Cycles64();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			FAnimationRuntime::BuildSkinningPalette(Input.ComponentSpacePose.data(), Input.InverseBindPoses.data(), NumBones,
+				SimdSkinning.data(), SimdNormal.data());
+			Checksum -= SumMatrices(SimdNormal);
+		}
+		const double SimdMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+		const double NumBoneUpdates = static_cast<double>(Iterations) * NumBones;
+		char Buf[512];
+		std::snprintf(Buf, sizeof(Buf),
+			"[Skinning Bench] %3d bones | scalar %6.1f ns/bone (%.3f ms/skeleton) -> simd %6.1f ns/bone (%.3f ms/skeleton) x%.1f | max rel err skin %.2e normal %.2e | checksum delta %.3f\r\n",
+			NumBones,
+			ScalarMs * 1.0e6 / NumBoneUpdates, ScalarMs / Iterations,
+			SimdMs * 1.0e6 / NumBoneUpdates, SimdMs / Iterations,
+			SimdMs > 0.0 ? ScalarMs / SimdMs : 0.0,
+			MaxRelativeError(ScalarSkinning, SimdSkinning), MaxRelativeError(ScalarNormal, SimdNormal), Checksum);
+		UE_LOG(Buf);
+	}
+}
@@ -0,0 +1,12 @@
+﻿#pragma once
+
+/**
+ * @brief 스키닝 팔레트 생성 비용 비교 (본별 FMatrix 곱 + 4x4 Inverse().Transpose() vs FAnimationRuntime::BuildSkinningPalette)
+ * - 60/120/250 본 합성 스켈레톤(임의 회전/비균등 스케일)을 같은 입력으로 반복 생성
+ * - 콘솔 명령 "BENCH SKINNING"으로 실행, 결과는 UE_LOG로 출력
+ */
+class FSkinningPaletteBenchmark
+{
+public:
+	static void Run(int32 Iterations = 2000);
+};
@@ -78,7 +78,7 @@ void UBillboardComponent::DuplicateSubObjects()
 	// Texture는 TextureName을 통해 리소스 매니저에서 가져오므로 복제하지 않음
 }
 
-void UBillboardComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void UBillboardComponent::CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
 {
 	// 1. 렌더링할 애셋이 유효한지 검사
 	// bRenderInPIE가 true이면 PIE 모드에서도 렌더링 가능 (but still respects bHiddenInGame)
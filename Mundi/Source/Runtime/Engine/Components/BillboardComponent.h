@@ -19,7 +19,7 @@ public:
     UBillboardComponent();
     ~UBillboardComponent() override = default;
 
-    void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
+    void CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
 
     // Setup
     UFUNCTION(LuaBind, DisplayName="SetTexture")
@@ -164,6 +164,9 @@ void UMeshComponent::DuplicateSubObjects()
 
 void UMeshComponent::MarkWorldPartitionDirty()
 {
+	CachedDrawCommands.Invalidate();
+	LastShadowDirtyFrame = FFrameAllocator::Get().GetFrameNumber();
+
 	if (UWorld* World = GetWorld())
 	{
 		if (UWorldPartitionManager* Partition = World->GetPartitionManager())
@@ -237,6 +240,7 @@ void UMeshComponent::SetMaterial(uint32 InElementIndex, UMaterialInterface* InNe
 
 	// 6. 새 머티리얼을 슬롯에 할당합니다.
 	MaterialSlots[InElementIndex] = InNewMaterial;
+	CachedDrawCommands.Invalidate();
 }
 
 UMaterialInstanceDynamic* UMeshComponent::CreateAndSetMaterialInstanceDynamic(uint32 ElementIndex)
@@ -341,4 +345,5 @@ void UMeshComponent::ClearDynamicMaterials()
 	// (이 배열이 MID 포인터를 가리키고 있었을 수 있으므로
 	//  delete 이후에 비워야 안전합니다.)
 	MaterialSlots.Empty();
+	CachedDrawCommands.Invalidate();
 }
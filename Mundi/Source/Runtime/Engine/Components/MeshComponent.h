@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "PrimitiveComponent.h"
+#include "MeshDrawCommandCache.h"
 #include "UMeshComponent.generated.h"
 
 class UShader;
@@ -48,9 +49,17 @@ protected:
     TArray<UMaterialInterface*> MaterialSlots;
     TArray<UMaterialInstanceDynamic*> DynamicMaterialInstances;
 
+    // 프레임 간 재사용하는 드로우 커맨드 (메시/머티리얼/트랜스폼이 바뀌면 무효화)
+    FMeshDrawCommandCache CachedDrawCommands;
+
 // Shadow Section
 public:
     bool IsCastShadows() const { return bCastShadows; }
+    // 트랜스폼/메시가 마지막으로 바뀐 프레임 (섀도우 맵 캐시가 정적 캐스터 판정과 무효화에 사용)
+    uint64 GetLastShadowDirtyFrame() const { return LastShadowDirtyFrame; }
+
+protected:
+    uint64 LastShadowDirtyFrame = 0;
 
 private:
     UPROPERTY(EditAnywhere, Category="Rendering", Tooltip="그림자를 드리울지 여부입니다")
@@ -6,6 +6,7 @@
 #include "CameraActor.h"
 #include "CapsuleComponent.h"
 #include "Collision.h"
+#include "Hash.h"
 #include "MeshBatchElement.h"
 #include "PlatformTime.h"
 #include "PlayerCameraManager.h"
@@ -66,7 +67,9 @@ void UParticleSystemComponent::InitParticles()
             UE_LOG("[ParticleSystemComponent::InitParticles] Creating instance for Emitter[%d]: %s",
                    i, EmitterAsset->GetName().c_str());
             FParticleEmitterInstance* NewInst = new FParticleEmitterInstance();
-            NewInst->Init(EmitterAsset, this);
+            // 컴포넌트 UUID(씬 로드 시 복원됨)와 이미터 인덱스로 시드를 정해, 이미터가 어느 워커에서 돌든 같은 시퀀스를 얻음
+            const uint32 RandomSeed = static_cast<uint32>(HashCombine(UUID, static_cast<uint64>(i)));
+            NewInst->Init(EmitterAsset, this, RandomSeed);
             EmitterInstances.Add(NewInst);
         }
         else
@@ -145,13 +148,11 @@ void UParticleSystemComponent::TickComponent(float DeltaTime)
         QueryBox.Min = Center - FVector(SearchRadius, SearchRadius, SearchRadius);
         QueryBox.Max = Center + FVector(SearchRadius, SearchRadius, SearchRadius);
 
-        TArray<UPrimitiveComponent*> Candidates = GetWorld()->GetPartitionManager()->GetBVH()->QueryIntersectedComponents(QueryBox);
-        Context.WorldColliders.Reserve(Candidates.Num());
-
-        for (UPrimitiveComponent* Prim : Candidates)
+        // 방문자로 바로 프록시 생성 (후보 배열 할당 없음)
+        GetWorld()->GetPartitionManager()->GetBVH()->ForEachIntersectedComponent(QueryBox, [&Context](UPrimitiveComponent* Prim)
         {
             UShapeComponent* ShapeComponent = Cast<UShapeComponent>(Prim);
-            if (!ShapeComponent) continue;
+            if (!ShapeComponent) return;
 
             const FTransform& TF = ShapeComponent->GetWorldTransform();
             FVector WorldLoc = TF.Translation;
@@ -194,7 +195,7 @@ void UParticleSystemComponent::TickComponent(float DeltaTime)
             }
 
             Context.WorldColliders.Add(Proxy);
-        }
+        });
     }
     
     if (bUseAsyncSimulation)
@@ -243,7 +244,7 @@ void UParticleSystemComponent::TickComponent(float DeltaTime)
 // ============================================================================
 // Rendering
 // ============================================================================
-void UParticleSystemComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void UParticleSystemComponent::CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
 {
     if (!IsVisible())
     {
@@ -282,7 +283,7 @@ void UParticleSystemComponent::DuplicateSubObjects()
     // TODO Release
 }
 
-void UParticleSystemComponent::BuildSpriteParticleBatch(TArray<FDynamicEmitterDataBase*>& EmitterRenderData, TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void UParticleSystemComponent::BuildSpriteParticleBatch(TArray<FDynamicEmitterDataBase*>& EmitterRenderData, TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
 {
     if (EmitterRenderData.IsEmpty())
         return;
@@ -464,7 +465,7 @@ void UParticleSystemComponent::BuildSpriteParticleBatch(TArray<FDynamicEmitterDa
     }
 }
 
-void UParticleSystemComponent::BuildMeshParticleBatch(TArray<FDynamicEmitterDataBase*>& EmitterRenderData, TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void UParticleSystemComponent::BuildMeshParticleBatch(TArray<FDynamicEmitterDataBase*>& EmitterRenderData, TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
 {
 	if (EmitterRenderData.IsEmpty())
 		return;
@@ -675,7 +676,7 @@ void UParticleSystemComponent::BuildMeshParticleBatch(TArray<FDynamicEmitterData
     }
 }
 
-void UParticleSystemComponent::BuildRibbonParticleBatch(TArray<FDynamicEmitterDataBase*>& EmitterRenderData, TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void UParticleSystemComponent::BuildRibbonParticleBatch(TArray<FDynamicEmitterDataBase*>& EmitterRenderData, TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
 {
     if (EmitterRenderData.IsEmpty())
         return;
@@ -1522,7 +1523,7 @@ void UParticleSystemComponent::RenderDebugVolume(URenderer* Renderer) const
     }
 }
 
-void UParticleSystemComponent::BuildBeamParticleBatch(TArray<FDynamicEmitterDataBase*>& EmitterRenderData, TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void UParticleSystemComponent::BuildBeamParticleBatch(TArray<FDynamicEmitterDataBase*>& EmitterRenderData, TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
 {
     if (EmitterRenderData.IsEmpty() || !View) return;
 
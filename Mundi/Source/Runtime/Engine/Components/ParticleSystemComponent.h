@@ -48,7 +48,7 @@ public:
 	UParticleSystem* GetTemplate() const { return Template; }
 
 	// 렌더링을 위한 MeshBatch 수집 함수
-	void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
+	void CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
 
 	void DuplicateSubObjects() override;
 
@@ -61,10 +61,10 @@ public:
 
 private:
 	// sprite, mesh 나눠 BuildBatch
-	void BuildSpriteParticleBatch(TArray<FDynamicEmitterDataBase*>& EmitterRenderData, TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View);
-	void BuildMeshParticleBatch(TArray<FDynamicEmitterDataBase*>& EmitterRenderData, TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View);
-	void BuildBeamParticleBatch(TArray<FDynamicEmitterDataBase*>& EmitterRenderData, TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View);
-	void BuildRibbonParticleBatch(TArray<FDynamicEmitterDataBase*>& EmitterRenderData, TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View);
+	void BuildSpriteParticleBatch(TArray<FDynamicEmitterDataBase*>& EmitterRenderData, TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View);
+	void BuildMeshParticleBatch(TArray<FDynamicEmitterDataBase*>& EmitterRenderData, TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View);
+	void BuildBeamParticleBatch(TArray<FDynamicEmitterDataBase*>& EmitterRenderData, TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View);
+	void BuildRibbonParticleBatch(TArray<FDynamicEmitterDataBase*>& EmitterRenderData, TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View);
 	
 	UMaterialInterface* ResolveEmitterMaterial(const FDynamicEmitterDataBase& DynData) const;
 
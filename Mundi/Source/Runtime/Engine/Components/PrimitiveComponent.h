@@ -33,7 +33,7 @@ public:
     virtual FAABB GetWorldAABB() const { return FAABB(); }
 
     // 이 프리미티브를 렌더링하는 데 필요한 FMeshBatchElement를 수집합니다.
-    virtual void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) {}
+    virtual void CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) {}
 
     virtual UMaterialInterface* GetMaterial(uint32 InElementIndex) const
     {
@@ -1,4 +1,5 @@
 ﻿#include "pch.h"
+#include <atomic>
 #include "SkeletalMeshComponent.h"
 #include "Source/Runtime/Engine/Animation/AnimDateModel.h"
 #include "Source/Runtime/Engine/Animation/AnimSequence.h"
@@ -8,6 +9,7 @@
 #include "Source/Runtime/Engine/Animation/AnimSingleNodeInstance.h"
 #include "Source/Runtime/Engine/Animation/AnimTypes.h"
 #include "Source/Runtime/Engine/Animation/AnimationAsset.h"
+#include "Source/Runtime/Engine/Animation/AnimationRuntime.h"
 #include "Source/Runtime/Engine/Animation/AnimNotify/AnimNotify_PlaySound.h"
 #include "Source/Runtime/Engine/Animation/Team2AnimInstance.h"
 #include "Source/Runtime/Core/Misc/PathUtils.h"
@@ -35,6 +37,7 @@
 #include "Pawn.h"
 #include "Controller.h"
 #include "PlayerController.h"
+#include "PlayerCameraManager.h"
 
 
 static FBodyInstance* FindBodyInstanceByName(const TArray<FBodyInstance*>& Bodies, const FName& BoneName)
@@ -80,6 +83,11 @@ void USkeletalMeshComponent::BeginPlay()
 	UWorld* World = GetWorld();
 	bool bIsPIE = World && World->bPie;
 
+	// URO 상태는 복제 원본 것을 쓰지 않고 새로 시작, 평가 위상은 오브젝트 인덱스로 흩어 놓음
+	UpdateRateParams = FAnimUpdateRateParams();
+	UpdateRateParams.FrameOffset = InternalIndex;
+	TimeSinceLastRender = 0.0f;
+
 	UE_LOG("[SkeletalMeshComponent] BeginPlay! AnimGraph: %p, AnimGraphPath: %s, PIE: %d",
 		AnimGraph, AnimGraphPath.c_str(), bIsPIE ? 1 : 0);
 
@@ -274,140 +282,15 @@ void USkeletalMeshComponent::TickComponent(float DeltaTime)
             LogTimer = 0.0f;
         }
 
-        // AnimInstance가 NativeUpdateAnimation에서:
-        // 1. 상태머신 업데이트 (있다면)
-        // 2. 시간 갱신 및 루핑 처리
-        // 3. 포즈 평가 및 SetAnimationPose() 호출
-        // 4. 노티파이 트리거
-        // 5. 커브 업데이트
-
-        // Sync physics bodies to match animation
-        UWorld* World = GetWorld();
-        FPhysScene* PhysScene = World ? World->GetPhysScene() : nullptr;
+        // AnimInstance 업데이트 순서:
+        // 1. NativeUpdateAnimation (게임 스레드): 파라미터/상태머신 전이
+        // 2. ParallelEvaluateAnimation (UWorld 애니메이션 단계, 워커 스레드): 시간 갱신, 포즈 평가/블렌드, SetAnimationPose
+        // 3. FinalizeAnimationUpdate (게임 스레드): 노티파이 실행, 루트 모션 적용, 물리 바디 동기화
         switch (PhysicsState)
         {
             case EPhysicsAnimationState::AnimationDriven:
                 AnimInstance->NativeUpdateAnimation(DeltaTime);
-
-                // 루트 모션 델타를 Owner에 적용
-                if (AnimInstance->IsRootMotionEnabled())
-                {
-                    FVector RootMotionDelta = AnimInstance->ConsumeRootMotionTranslation();
-                    FQuat RootMotionRotDelta = AnimInstance->ConsumeRootMotionRotation();
-
-                    // 델타가 유의미한 값인지 확인
-                    bool bHasTranslation = RootMotionDelta.Size() > KINDA_SMALL_NUMBER;
-                    bool bHasRotation = !RootMotionRotDelta.IsIdentity();
-
-                    if (bHasTranslation || bHasRotation)
-                    {
-                        if (AActor* Owner = GetOwner())
-                        {
-                            // 컴포넌트의 월드 회전을 고려하여 델타 변환
-                            FQuat ComponentWorldRotation = GetWorldTransform().Rotation;
-                            FVector WorldDelta = ComponentWorldRotation.RotateVector(RootMotionDelta);
-
-                            // ACharacter인 경우 CharacterMovementComponent를 통해 충돌 체크하며 이동
-                            ACharacter* CharacterOwner = dynamic_cast<ACharacter*>(Owner);
-                            if (CharacterOwner)
-                            {
-                                UCharacterMovementComponent* MoveComp = CharacterOwner->GetCharacterMovement();
-                                UCapsuleComponent* Capsule = CharacterOwner->GetCapsuleComponent();
-
-                                if (MoveComp && PhysScene && Capsule)
-                                {
-                                    float Radius = Capsule->CapsuleRadius;
-                                    float HalfHeight = Capsule->CapsuleHalfHeight;
-                                    FVector CurrentPos = Owner->GetActorLocation();
-                                    FVector TargetPos = CurrentPos + WorldDelta;
-
-                                    // 이동 전: 목표 위치에서 오버랩 체크
-                                    FVector PenetrationNormal;
-                                    float PenetrationDepth;
-                                    bool bWouldOverlap = PhysScene->OverlapCapsuleWithMTD(
-                                        TargetPos, Radius, HalfHeight,
-                                        PenetrationNormal, PenetrationDepth, Owner);
-
-                                    if (bWouldOverlap && PenetrationDepth > 0.01f)
-                                    {
-                                        // 목표 위치에서 충돌 예상됨 - 충돌 지점까지만 이동하거나 슬라이딩
-                                        FHitResult Hit;
-                                        bool bMoved = MoveComp->SafeMoveUpdatedComponent(WorldDelta, Hit);
-
-                                        if (!bMoved && Hit.bBlockingHit)
-                                        {
-                                            // 슬라이딩 시도
-                                            FVector SlideVector = MoveComp->SlideAlongSurface(WorldDelta, Hit);
-                                            if (!SlideVector.IsZero())
-                                            {
-                                                FHitResult SlideHit;
-                                                MoveComp->SafeMoveUpdatedComponent(SlideVector, SlideHit);
-                                            }
-                                        }
-
-                                        // 이동 후에도 오버랩이면 밀어내기
-                                        FVector NewPos = Owner->GetActorLocation();
-                                        bool bStillOverlapping = PhysScene->OverlapCapsuleWithMTD(
-                                            NewPos, Radius, HalfHeight,
-                                            PenetrationNormal, PenetrationDepth, Owner);
-
-                                        if (bStillOverlapping && PenetrationDepth > KINDA_SMALL_NUMBER)
-                                        {
-                                            FVector PushOut = PenetrationNormal * (PenetrationDepth + 0.02f);
-                                            Owner->SetActorLocation(NewPos + PushOut);
-                                        }
-                                    }
-                                    else
-                                    {
-                                        // 충돌 예상 없음 - 정상 이동
-                                        FHitResult Hit;
-                                        bool bMoved = MoveComp->SafeMoveUpdatedComponent(WorldDelta, Hit);
-
-                                        if (!bMoved && Hit.bBlockingHit)
-                                        {
-                                            FVector SlideVector = MoveComp->SlideAlongSurface(WorldDelta, Hit);
-                                            if (!SlideVector.IsZero())
-                                            {
-                                                FHitResult SlideHit;
-                                                MoveComp->SafeMoveUpdatedComponent(SlideVector, SlideHit);
-                                            }
-                                        }
-                                    }
-                                }
-                                else if (MoveComp)
-                                {
-                                    // PhysScene 또는 Capsule 없으면 기존 방식
-                                    FHitResult Hit;
-                                    MoveComp->SafeMoveUpdatedComponent(WorldDelta, Hit);
-                                }
-                                else
-                                {
-                                    // MovementComponent 없으면 직접 이동
-                                    FVector NewLocation = Owner->GetActorLocation() + WorldDelta;
-                                    Owner->SetActorLocation(NewLocation);
-                                }
-                            }
-                            else
-                            {
-                                // Character가 아니면 직접 이동
-                                FVector NewLocation = Owner->GetActorLocation() + WorldDelta;
-                                Owner->SetActorLocation(NewLocation);
-                            }
-
-                            // Owner 회전 업데이트 (필요시)
-                            if (!RootMotionRotDelta.IsIdentity())
-                            {
-                                FQuat NewRotation = Owner->GetActorRotation() * RootMotionRotDelta;
-                                Owner->SetActorRotation(NewRotation);
-                            }
-                        }
-                    }
-                }
-
-                if (PhysScene)
-                {
-                    SyncBodiesFromAnimation(*PhysScene);
-                }
+                TickAnimation(DeltaTime);
                 break;
 
             case EPhysicsAnimationState::PhysicsDriven:
@@ -426,19 +309,10 @@ void USkeletalMeshComponent::TickComponent(float DeltaTime)
     else
     {
         // AnimInstance 없이도 PhysicsDriven 상태면 래그돌 업데이트
-        UWorld* World = GetWorld();
-        FPhysScene* PhysScene = World ? World->GetPhysScene() : nullptr;
-
         if (PhysicsState == EPhysicsAnimationState::PhysicsDriven)
         {
             SyncAnimationFromBodies();
         }
-        else if (PhysicsState == EPhysicsAnimationState::AnimationDriven && PhysScene)
-        {
-            // 레거시 경로: AnimInstance 없이 직접 애니메이션 업데이트
-            TickAnimation(DeltaTime);
-            SyncBodiesFromAnimation(*PhysScene);
-        }
         else
         {
             // 레거시 경로: AnimInstance 없이 직접 애니메이션 업데이트
@@ -454,6 +328,13 @@ void USkeletalMeshComponent::EndPlay()
 {
     if (UWorld* World = GetWorld())
     {
+        // 이번 프레임 애니메이션 단계에 예약돼 있으면 취소
+        if (bPendingAnimationUpdate)
+        {
+            World->CancelAnimationUpdate(this);
+            bPendingAnimationUpdate = false;
+        }
+
         if (FPhysScene* PhysScene = World->GetPhysScene())
         {
             DestroyPhysicsAssetBodies(*PhysScene);
@@ -473,6 +354,10 @@ void USkeletalMeshComponent::SetSkeletalMesh(const FString& PathFileName)
     }
     ApplyPhysicsAsset(AssetToApply);
 
+    // 본 구성이 바뀌므로 URO 보간 포즈는 버림
+    UROSourcePose.Empty();
+    UROTargetPose.Empty();
+
     if (SkeletalMesh && SkeletalMesh->GetSkeletalMeshData())
     {
         const FSkeleton& Skeleton = SkeletalMesh->GetSkeletalMeshData()->Skeleton;
@@ -526,6 +411,10 @@ void USkeletalMeshComponent::SetSkeletalMesh(const FString& PathFileName, bool b
     }
     ApplyPhysicsAsset(AssetToApply);
 
+    // 본 구성이 바뀌므로 URO 보간 포즈는 버림
+    UROSourcePose.Empty();
+    UROTargetPose.Empty();
+
     if (SkeletalMesh && SkeletalMesh->GetSkeletalMeshData())
     {
         const FSkeleton& Skeleton = SkeletalMesh->GetSkeletalMeshData()->Skeleton;
@@ -596,6 +485,10 @@ void USkeletalMeshComponent::ResetToBindPose()
         CurrentLocalSpacePose[i] = FTransform(LocalBindMatrix);
     }
 
+    // 래그돌 해제 등으로 포즈가 끊겼으므로 이전 평가 포즈로 보간/고정하지 않음
+    UROSourcePose.Empty();
+    UROTargetPose.Empty();
+
     ForceRecomputePose();
 }
 
@@ -827,9 +720,8 @@ void USkeletalMeshComponent::ForceRecomputePose()
         GetWorldAABB();
         TIME_PROFILE_END(SkeletalAABB)
     }
-    
-    PerformSkinning();
-    
+
+    // CPU 스키닝은 렌더 수집(CollectMeshBatches) 때 매핑된 버텍스 버퍼에 바로 수행
 }
 
 void USkeletalMeshComponent::UpdateComponentSpaceTransforms()
@@ -859,6 +751,16 @@ void USkeletalMeshComponent::UpdateFinalSkinningMatrices()
     const FSkeleton& Skeleton = SkeletalMesh->GetSkeletalMeshData()->Skeleton;
     const int32 NumBones = Skeleton.Bones.Num();
 
+    // 본 4개씩 SIMD로 스키닝/노말 행렬 생성
+    const TArray<FMatrix>& InverseBindPoses = SkeletalMesh->GetInverseBindPoses();
+    if (InverseBindPoses.Num() == NumBones && CurrentComponentSpacePose.Num() >= NumBones
+        && TempFinalSkinningMatrices.Num() >= NumBones && TempFinalSkinningNormalMatrices.Num() >= NumBones)
+    {
+        FAnimationRuntime::BuildSkinningPalette(CurrentComponentSpacePose.data(), InverseBindPoses.data(), NumBones,
+            TempFinalSkinningMatrices.data(), TempFinalSkinningNormalMatrices.data());
+        return;
+    }
+
     for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
     {
         const FMatrix& InvBindPose = Skeleton.Bones[BoneIndex].InverseBindPose;
@@ -1205,24 +1107,14 @@ void USkeletalMeshComponent::SetAnimationTime(float InTime)
         if (DataModel && SkeletalMesh)
         {
             const FSkeleton& Skeleton = SkeletalMesh->GetSkeletalMeshData()->Skeleton;
-            int32 NumBones = DataModel->GetNumBoneTracks();
 
+            // 스켈레톤 본 인덱스로 CurrentLocalSpacePose에 바로 평가 (애니메이션에 없는 본은 기존 값 유지)
             FAnimExtractContext ExtractContext(CurrentAnimationTime, bIsLooping);
-            FPoseContext PoseContext(NumBones);
+            FPoseContext PoseContext;
+            PoseContext.Skeleton = &Skeleton;
+            PoseContext.Pose.swap(CurrentLocalSpacePose);
             CurrentAnimation->GetAnimationPose(PoseContext, ExtractContext);
-
-            // 추출된 포즈를 CurrentLocalSpacePose에 적용
-            const TArray<FBoneAnimationTrack>& BoneTracks = DataModel->GetBoneAnimationTracks();
-            for (int32 TrackIdx = 0; TrackIdx < BoneTracks.Num(); ++TrackIdx)
-            {
-                const FBoneAnimationTrack& Track = BoneTracks[TrackIdx];
-                int32 BoneIndex = Skeleton.FindBoneIndex(Track.Name);
-
-                if (BoneIndex != INDEX_NONE && BoneIndex < CurrentLocalSpacePose.Num())
-                {
-                    CurrentLocalSpacePose[BoneIndex] = PoseContext.Pose[TrackIdx];
-                }
-            }
+            CurrentLocalSpacePose.swap(PoseContext.Pose);
 
             // 루트 본을 항상 원점에 고정 (루트 모션 사용 시 메시가 캡슐에서 벗어나지 않도록)
             if (CurrentLocalSpacePose.Num() > 0)
@@ -1316,22 +1208,325 @@ void USkeletalMeshComponent::DispatchAnimNotifies()
 
 void USkeletalMeshComponent::TickAnimation(float DeltaTime)
 {
+    // 이번 프레임 애니메이션 단계에 이미 예약돼 있으면 다시 넣지 않음
+    // (같은 컴포넌트가 두 번 들어가면 병렬 단계에서 두 워커가 같은 포즈 버퍼를 동시에 씀)
+    if (bPendingAnimationUpdate)
+    {
+        return;
+    }
+
+    // URO: 멀리 있거나 화면 밖이면 몇 프레임에 한 번만 평가 (건너뛴 DeltaTime은 누적해서 평가 프레임에 넘김)
+    UpdateAnimationRate(DeltaTime);
+    if (UpdateRateParams.bFrozen)
+    {
+        return;
+    }
+    // 보간하지 않고 건너뛰는 프레임(화면 밖)은 할 일이 없으므로 예약하지 않음
+    if (!UpdateRateParams.bEvaluateThisFrame && !UpdateRateParams.bInterpolateSkippedFrames)
+    {
+        return;
+    }
+
+    PendingAnimationDeltaTime = UpdateRateParams.EvaluationDeltaTime;
+    bPendingAnimationUpdate = true;
+
+    // Actor Tick 중이면 월드의 애니메이션 단계에서 다른 컴포넌트와 함께 병렬 평가,
+    // 그 밖(에디터 미리보기 등)에서 호출되면 그 자리에서 순서대로 처리
+    UWorld* World = GetWorld();
+    if (!World || !World->QueueAnimationUpdate(this))
+    {
+        ParallelUpdateAnimation();
+        FinalizeAnimationUpdate();
+    }
+}
+
+void USkeletalMeshComponent::ParallelUpdateAnimation()
+{
+    if (!bPendingAnimationUpdate)
+    {
+        return;
+    }
+
+    // URO: 평가를 건너뛰는 프레임은 보간만
+    if (!UpdateRateParams.bEvaluateThisFrame)
+    {
+        InterpolateSkippedFramePose();
+        return;
+    }
+
+    // 보간 시작점은 지금 화면에 보이는 포즈
+    if (UpdateRateParams.bInterpolateSkippedFrames)
+    {
+        UROSourcePose = CurrentLocalSpacePose;
+    }
+
+    const float DeltaTime = PendingAnimationDeltaTime;
+
+    if (AnimInstance)
+    {
+        AnimInstance->ParallelEvaluateAnimation(DeltaTime);
+        return;
+    }
+
+    // 레거시 경로: 노티파이 수집 + 포즈 평가 (실행은 FinalizeAnimationUpdate)
+    PendingNotifies.Empty();
     if (!ShouldTickAnimation())
     {
-        static bool bLoggedOnce = false;
-        if (!bLoggedOnce)
+        static std::atomic<bool> bLoggedOnce{ false };
+        if (!bLoggedOnce.exchange(true))
         {
             UE_LOG("TickAnimation skipped - CurrentAnimation: %p, bIsPlaying: %d", CurrentAnimation, bIsPlaying);
-            bLoggedOnce = true;
         }
         return;
     }
 
     GatherNotifies(DeltaTime);
 
-    TickAnimInstances(DeltaTime); 
-    
-    DispatchAnimNotifies();
+    TickAnimInstances(DeltaTime);
+}
+
+void USkeletalMeshComponent::FinalizeAnimationUpdate()
+{
+    if (!bPendingAnimationUpdate)
+    {
+        return;
+    }
+    bPendingAnimationUpdate = false;
+
+    if (AnimInstance)
+    {
+        AnimInstance->DispatchQueuedAnimNotifies();
+    }
+    else
+    {
+        DispatchAnimNotifies();
+        PendingNotifies.Empty();
+    }
+
+    PrevAnimationTime = CurrentAnimationTime;
+
+    UWorld* World = GetWorld();
+    FPhysScene* PhysScene = World ? World->GetPhysScene() : nullptr;
+
+    // 루트 모션 델타를 Owner에 적용 (다른 액터/물리 씬을 건드리므로 게임 스레드에서)
+    if (AnimInstance && AnimInstance->IsRootMotionEnabled())
+    {
+        ApplyRootMotion(PhysScene);
+    }
+
+    // 노티파이가 래그돌 전환 등으로 상태를 바꿨을 수 있으므로 다시 확인
+    if (PhysScene && PhysicsState == EPhysicsAnimationState::AnimationDriven)
+    {
+        SyncBodiesFromAnimation(*PhysScene);
+    }
+}
+
+void USkeletalMeshComponent::UpdateAnimationRate(float DeltaTime)
+{
+    TimeSinceLastRender += DeltaTime;
+
+    // 플레이어 카메라가 없으면(에디터 미리보기 등) 화면 크기를 최대로 보고 매 프레임 평가
+    float ScreenSize = 1.0f;
+    UWorld* World = GetWorld();
+    APlayerCameraManager* CameraManager = World ? World->GetPlayerCameraManager() : nullptr;
+    if (CameraManager && SkeletalMesh)
+    {
+        const FAABB& Bounds = SkeletalMesh->GetBindPoseBounds();
+        const FTransform WorldTransform = GetWorldTransform();
+        const FVector Center = WorldTransform.TransformPosition(Bounds.GetCenter());
+        const FVector Scale(std::fabs(WorldTransform.Scale3D.X), std::fabs(WorldTransform.Scale3D.Y), std::fabs(WorldTransform.Scale3D.Z));
+        const float Radius = Bounds.GetHalfExtent().Size() * Scale.GetMaxValue();
+        ScreenSize = FAnimUpdateRate::ComputeScreenSize(Center, Radius, *CameraManager->GetCurrentViewInfo());
+    }
+
+    // 루트 모션/몽타주는 Owner 이동과 게임플레이 노티파이(공격 판정 등)에 쓰이므로 화면 밖에서도 멈추지 않는다
+    const bool bAllowFreeze = !AnimInstance || (!AnimInstance->IsRootMotionEnabled() && !AnimInstance->Montage_IsPlaying());
+
+    FAnimUpdateRate::Tick(UpdateRateParams, DeltaTime, ScreenSize, TimeSinceLastRender, bAllowFreeze);
+}
+
+namespace
+{
+    /** URO 보간: 이번 본 LOD에서 평가하는 본만 Source -> Target (멈춘 본은 이미 Target 값) */
+    void BlendRequiredBones(const TArray<FTransform>& Source, const TArray<FTransform>& Target, float Alpha,
+        const FAnimUpdateRateParams& Params, const TArray<uint8>& BoneMaxLODs, TArray<FTransform>& OutPose)
+    {
+        const int32 NumBones = OutPose.Num();
+        for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+        {
+            if (!Params.IsBoneRequired(BoneMaxLODs, BoneIndex))
+            {
+                continue;
+            }
+
+            const FTransform& From = Source[BoneIndex];
+            const FTransform& To = Target[BoneIndex];
+            FTransform& Out = OutPose[BoneIndex];
+            Out.Translation = FMath::Lerp(From.Translation, To.Translation, Alpha);
+            Out.Rotation = FQuat::Nlerp(From.Rotation, To.Rotation, Alpha);
+            Out.Scale3D = FMath::Lerp(From.Scale3D, To.Scale3D, Alpha);
+        }
+    }
+}
+
+void USkeletalMeshComponent::ApplyUpdateRateToEvaluatedPose()
+{
+    if (!bPendingAnimationUpdate || !SkeletalMesh)
+    {
+        return;
+    }
+
+    const int32 NumBones = CurrentLocalSpacePose.Num();
+    const TArray<uint8>& BoneMaxLODs = SkeletalMesh->GetBoneMaxLODs();
+
+    // 본 LOD: 작은 본(손가락/얼굴 등)은 마지막 평가 값에 고정
+    if (UpdateRateParams.BoneLOD > 0 && UROTargetPose.Num() == NumBones)
+    {
+        for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+        {
+            if (!UpdateRateParams.IsBoneRequired(BoneMaxLODs, BoneIndex))
+            {
+                CurrentLocalSpacePose[BoneIndex] = UROTargetPose[BoneIndex];
+            }
+        }
+    }
+
+    UROTargetPose = CurrentLocalSpacePose;
+
+    // 바로 최신 포즈로 바꾸지 않고 다음 평가까지 나눠서 따라감
+    if (UpdateRateParams.bInterpolateSkippedFrames && UROSourcePose.Num() == NumBones)
+    {
+        BlendRequiredBones(UROSourcePose, UROTargetPose, UpdateRateParams.GetInterpolationAlpha(),
+            UpdateRateParams, BoneMaxLODs, CurrentLocalSpacePose);
+    }
+}
+
+void USkeletalMeshComponent::InterpolateSkippedFramePose()
+{
+    const int32 NumBones = CurrentLocalSpacePose.Num();
+    if (!SkeletalMesh || !UpdateRateParams.bInterpolateSkippedFrames
+        || UROSourcePose.Num() != NumBones || UROTargetPose.Num() != NumBones)
+    {
+        return;
+    }
+
+    BlendRequiredBones(UROSourcePose, UROTargetPose, UpdateRateParams.GetInterpolationAlpha(),
+        UpdateRateParams, SkeletalMesh->GetBoneMaxLODs(), CurrentLocalSpacePose);
+    ForceRecomputePose();
+}
+
+void USkeletalMeshComponent::ApplyRootMotion(FPhysScene* PhysScene)
+{
+    FVector RootMotionDelta = AnimInstance->ConsumeRootMotionTranslation();
+    FQuat RootMotionRotDelta = AnimInstance->ConsumeRootMotionRotation();
+
+    // 델타가 유의미한 값인지 확인
+    bool bHasTranslation = RootMotionDelta.Size() > KINDA_SMALL_NUMBER;
+    bool bHasRotation = !RootMotionRotDelta.IsIdentity();
+
+    if (bHasTranslation || bHasRotation)
+    {
+        if (AActor* Owner = GetOwner())
+        {
+            // 컴포넌트의 월드 회전을 고려하여 델타 변환
+            FQuat ComponentWorldRotation = GetWorldTransform().Rotation;
+            FVector WorldDelta = ComponentWorldRotation.RotateVector(RootMotionDelta);
+
+            // ACharacter인 경우 CharacterMovementComponent를 통해 충돌 체크하며 이동
+            ACharacter* CharacterOwner = dynamic_cast<ACharacter*>(Owner);
+            if (CharacterOwner)
+            {
+                UCharacterMovementComponent* MoveComp = CharacterOwner->GetCharacterMovement();
+                UCapsuleComponent* Capsule = CharacterOwner->GetCapsuleComponent();
+
+                if (MoveComp && PhysScene && Capsule)
+                {
+                    float Radius = Capsule->CapsuleRadius;
+                    float HalfHeight = Capsule->CapsuleHalfHeight;
+                    FVector CurrentPos = Owner->GetActorLocation();
+                    FVector TargetPos = CurrentPos + WorldDelta;
+
+                    // 이동 전: 목표 위치에서 오버랩 체크
+                    FVector PenetrationNormal;
+                    float PenetrationDepth;
+                    bool bWouldOverlap = PhysScene->OverlapCapsuleWithMTD(
+                        TargetPos, Radius, HalfHeight,
+                        PenetrationNormal, PenetrationDepth, Owner);
+
+                    if (bWouldOverlap && PenetrationDepth > 0.01f)
+                    {
+                        // 목표 위치에서 충돌 예상됨 - 충돌 지점까지만 이동하거나 슬라이딩
+                        FHitResult Hit;
+                        bool bMoved = MoveComp->SafeMoveUpdatedComponent(WorldDelta, Hit);
+
+                        if (!bMoved && Hit.bBlockingHit)
+                        {
+                            // 슬라이딩 시도
+                            FVector SlideVector = MoveComp->SlideAlongSurface(WorldDelta, Hit);
+                            if (!SlideVector.IsZero())
+                            {
+                                FHitResult SlideHit;
+                                MoveComp->SafeMoveUpdatedComponent(SlideVector, SlideHit);
+                            }
+                        }
+
+                        // 이동 후에도 오버랩이면 밀어내기
+                        FVector NewPos = Owner->GetActorLocation();
+                        bool bStillOverlapping = PhysScene->OverlapCapsuleWithMTD(
+                            NewPos, Radius, HalfHeight,
+                            PenetrationNormal, PenetrationDepth, Owner);
+
+                        if (bStillOverlapping && PenetrationDepth > KINDA_SMALL_NUMBER)
+                        {
+                            FVector PushOut = PenetrationNormal * (PenetrationDepth + 0.02f);
+                            Owner->SetActorLocation(NewPos + PushOut);
+                        }
+                    }
+                    else
+                    {
+                        // 충돌 예상 없음 - 정상 이동
+                        FHitResult Hit;
+                        bool bMoved = MoveComp->SafeMoveUpdatedComponent(WorldDelta, Hit);
+
+                        if (!bMoved && Hit.bBlockingHit)
+                        {
+                            FVector SlideVector = MoveComp->SlideAlongSurface(WorldDelta, Hit);
+                            if (!SlideVector.IsZero())
+                            {
+                                FHitResult SlideHit;
+                                MoveComp->SafeMoveUpdatedComponent(SlideVector, SlideHit);
+                            }
+                        }
+                    }
+                }
+                else if (MoveComp)
+                {
+                    // PhysScene 또는 Capsule 없으면 기존 방식
+                    FHitResult Hit;
+                    MoveComp->SafeMoveUpdatedComponent(WorldDelta, Hit);
+                }
+                else
+                {
+                    // MovementComponent 없으면 직접 이동
+                    FVector NewLocation = Owner->GetActorLocation() + WorldDelta;
+                    Owner->SetActorLocation(NewLocation);
+                }
+            }
+            else
+            {
+                // Character가 아니면 직접 이동
+                FVector NewLocation = Owner->GetActorLocation() + WorldDelta;
+                Owner->SetActorLocation(NewLocation);
+            }
+
+            // Owner 회전 업데이트 (필요시)
+            if (!RootMotionRotDelta.IsIdentity())
+            {
+                FQuat NewRotation = Owner->GetActorRotation() * RootMotionRotDelta;
+                Owner->SetActorRotation(NewRotation);
+            }
+        }
+    }
 }
 
 bool USkeletalMeshComponent::ShouldTickAnimation() const
@@ -1352,8 +1547,9 @@ void USkeletalMeshComponent::TickAnimInstances(float DeltaTime)
 
     float PlayLength = CurrentAnimation->GetPlayLength();
 
-    static int FrameCount = 0;
-    if (FrameCount++ % 60 == 0) // 매 60프레임마다 로그
+    // 병렬 애니메이션 단계에서 여러 컴포넌트가 동시에 들어오므로 로그용 정적 변수는 atomic
+    static std::atomic<int32> FrameCount{ 0 };
+    if (FrameCount.fetch_add(1, std::memory_order_relaxed) % 60 == 0) // 매 60프레임마다 로그
     {
         UE_LOG("Animation Playing - Time: %.2f / %.2f, Looping: %d", CurrentAnimationTime, PlayLength, bIsLooping);
     }
@@ -1387,40 +1583,36 @@ void USkeletalMeshComponent::TickAnimInstances(float DeltaTime)
     //CurrentAnimation->SetSkeleton(Skeleton);
 
 
-    int32 NumBones = DataModel->GetNumBoneTracks();
-
     // 4. 각 본의 애니메이션 포즈 적용
-    FAnimExtractContext ExtractContext(CurrentAnimationTime, bIsLooping);
-    FPoseContext PoseContext(NumBones);
-
     // 현재 재생시간과 루핑 정보를 담은 ExtractContext 구조체를 기반으로 GetAnimationPose에서 현재 시간에 맞는 본의 행렬을 반환한다
+    // 스켈레톤을 지정하면 트랙 -> 본 인덱스 표(시퀀스에 캐싱)로 CurrentLocalSpacePose에 바로 기록된다
+    FAnimExtractContext ExtractContext(CurrentAnimationTime, bIsLooping);
+    FPoseContext PoseContext;
+    PoseContext.Skeleton = &Skeleton;
+    PoseContext.Pose.swap(CurrentLocalSpacePose);
     CurrentAnimation->GetAnimationPose(PoseContext, ExtractContext);
+    CurrentLocalSpacePose.swap(PoseContext.Pose);
 
-    // 5. 추출된 포즈를 CurrentLocalSpacePose에 적용
+    // 5. 본 매칭 결과 로그 (최초 1회)
     const TArray<FBoneAnimationTrack>& BoneTracks = DataModel->GetBoneAnimationTracks();
+    const FTrackToBoneMap& TrackToBone = CurrentAnimation->GetTrackToBoneMap(Skeleton);
 
-    static bool bLoggedBoneMatching = false;
-    static bool bLoggedAnimData = false;
-    int32 MatchedBones = 0;
+    static std::atomic<bool> bLoggedBoneMatching{ false };
+    static std::atomic<bool> bLoggedAnimData{ false };
+    int32 MatchedBones = TrackToBone.NumMatchedTracks;
     int32 TotalBones = BoneTracks.Num();
 
-    for (int32 TrackIdx = 0; TrackIdx < BoneTracks.Num(); ++TrackIdx)
+    for (int32 TrackIdx = 0; TrackIdx < BoneTracks.Num() && !(bLoggedAnimData && bLoggedBoneMatching); ++TrackIdx)
     {
         const FBoneAnimationTrack& Track = BoneTracks[TrackIdx];
-
-        // 스켈레톤에서 본 인덱스 찾기
-        int32 BoneIndex = Skeleton.FindBoneIndex(Track.Name);
+        int32 BoneIndex = TrackToBone.TrackToBone[TrackIdx];
 
         if (BoneIndex != INDEX_NONE && BoneIndex < CurrentLocalSpacePose.Num())
         {
-            // 애니메이션 포즈 적용
-            CurrentLocalSpacePose[BoneIndex] = PoseContext.Pose[TrackIdx];
-            MatchedBones++;
-
             // 첫 5개 본의 애니메이션 데이터 로그
             if (!bLoggedAnimData && BoneIndex < 5)
             {
-                const FTransform& AnimTransform = PoseContext.Pose[TrackIdx];
+                const FTransform& AnimTransform = CurrentLocalSpacePose[BoneIndex];
                 UE_LOG("[AnimData] Bone[%d] %s: T(%.3f,%.3f,%.3f) R(%.3f,%.3f,%.3f,%.3f) S(%.3f,%.3f,%.3f)",
                     BoneIndex, Track.Name.ToString().c_str(),
                     AnimTransform.Translation.X, AnimTransform.Translation.Y, AnimTransform.Translation.Z,
@@ -1460,7 +1652,8 @@ void USkeletalMeshComponent::TickAnimInstances(float DeltaTime)
         bLoggedBoneMatching = true;
     }
 
-    // 6. 포즈 변경 사항을 스키닝에 반영
+    // 6. 포즈 변경 사항을 스키닝에 반영 (URO 본 LOD/보간 적용 후)
+    ApplyUpdateRateToEvaluatedPose();
     ForceRecomputePose();
 }
 
@@ -1565,7 +1758,8 @@ void USkeletalMeshComponent::SetAnimationPose(const TArray<FTransform>& InPose)
         CurrentLocalSpacePose[0].Translation = FVector::Zero();
     }
 
-    // 포즈 변경 사항을 스키닝에 반영
+    // 포즈 변경 사항을 스키닝에 반영 (URO 본 LOD/보간 적용 후)
+    ApplyUpdateRateToEvaluatedPose();
     ForceRecomputePose();
 }
 
@@ -170,9 +170,15 @@ public:
 protected:
     /**
      * @brief 애니메이션 업데이트 (TickComponent에서 호출)
+     * Actor Tick 중이면 UWorld 애니메이션 단계에 예약하고, 아니면 즉시 평가+마무리까지 수행
      */
     void TickAnimation(float DeltaTime);
 
+    /**
+     * @brief 루트 모션 델타를 Owner 이동/회전에 적용 (게임 스레드)
+     */
+    void ApplyRootMotion(FPhysScene* PhysScene);
+
     /**
      * @brief 애니메이션이 업데이트되어야 하는지 확인
      */
@@ -215,6 +221,54 @@ protected:
     // Animation graph asset path (.graph). Saved into prefab and used to reload graph.
     UPROPERTY(EditAnywhere, Category = "Animation")
     FString AnimGraphPath;
+
+public:
+    /////////////////////////////////////////////////////////////
+    // Parallel Animation Section (UWorld::Tick 애니메이션 단계)
+    /////////////////////////////////////////////////////////////
+    /**
+     * @brief 예약된 포즈 평가 (워커 스레드)
+     * 시간 갱신, 포즈 평가/블렌드/몽타주, 스키닝 행렬 계산까지. 이 컴포넌트와 AnimInstance만 수정한다.
+     */
+    void ParallelUpdateAnimation();
+
+    /**
+     * @brief 포즈 평가 후 마무리 (게임 스레드)
+     * 모아 둔 노티파이 실행, 루트 모션 적용, 물리 바디 동기화
+     */
+    void FinalizeAnimationUpdate();
+
+    bool HasPendingAnimationUpdate() const { return bPendingAnimationUpdate; }
+
+    /** 이번 프레임 URO 상태 (평가 주기, 본 LOD, 정지 여부) */
+    const FAnimUpdateRateParams& GetUpdateRateParams() const { return UpdateRateParams; }
+
+private:
+    /**
+     * @brief URO: 카메라 기준 화면 크기와 최근 렌더 여부로 이번 프레임 평가 주기/본 LOD 결정 (게임 스레드)
+     */
+    void UpdateAnimationRate(float DeltaTime);
+
+    /**
+     * @brief URO: 방금 평가된 CurrentLocalSpacePose에 본 LOD 고정과 건너뛸 프레임 보간 시작 적용 (워커 스레드)
+     * 애니메이션 단계 밖에서 들어온 포즈(에디터 본 편집 등)는 건드리지 않는다
+     */
+    void ApplyUpdateRateToEvaluatedPose();
+
+    /**
+     * @brief URO: 평가를 건너뛴 프레임에 직전 표시 포즈 -> 최신 평가 포즈를 보간해 표시 (워커 스레드)
+     */
+    void InterpolateSkippedFramePose();
+
+    /** TickAnimation에서 예약되어 FinalizeAnimationUpdate 전까지 true */
+    bool bPendingAnimationUpdate = false;
+    float PendingAnimationDeltaTime = 0.0f;
+
+    FAnimUpdateRateParams UpdateRateParams;
+    /** 마지막 평가 직전에 표시 중이던 로컬 포즈 (보간 시작점) */
+    TArray<FTransform> UROSourcePose;
+    /** 마지막으로 평가된 로컬 포즈 (보간 끝점, 본 LOD로 멈춘 본의 값) */
+    TArray<FTransform> UROTargetPose;
       
 // Editor Section
 public:
@@ -116,18 +116,18 @@ void USkinnedMeshComponent::DuplicateSubObjects()
 //    Renderer->EndLineBatch(FMatrix::Identity());
 // }
 
-void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void USkinnedMeshComponent::CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
 {
    if (!SkeletalMesh || !SkeletalMesh->GetSkeletalMeshData()) { return; }
 
+   // 프러스텀 컬링을 통과해 수집됨 (메인/그림자 패스 모두 카메라 프러스텀 기준)
+   TimeSinceLastRender = 0.0f;
+
    bForceGPUSkinning = GWorld->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_GPUSkinning);         
 
    if (bSkinningMatricesDirty && !bForceGPUSkinning)
    {
-      TIME_PROFILE(VertexBuffer)
-      bSkinningMatricesDirty = false;
-      SkeletalMesh->UpdateVertexBuffer(SkinnedVertices, CPUSkinnedVertexBuffer);
-      TIME_PROFILE_END(VertexBuffer)
+      PerformSkinning();
    }
 
    if (bForceGPUSkinning &&
@@ -363,7 +363,6 @@ void USkinnedMeshComponent::SetSkeletalMesh(const FString& PathFileName)
       
       const TArray<FMatrix> IdentityMatrices(SkeletalMesh->GetBoneCount(), FMatrix::Identity());
       UpdateSkinningMatrices(IdentityMatrices, IdentityMatrices);
-      PerformSkinning();
       
       const TArray<FGroupInfo>& GroupInfos = SkeletalMesh->GetMeshGroupInfo();
        MaterialSlots.resize(GroupInfos.size());
@@ -379,7 +378,6 @@ void USkinnedMeshComponent::SetSkeletalMesh(const FString& PathFileName)
    {
       SkeletalMesh = nullptr;
       UpdateSkinningMatrices(TArray<FMatrix>(), TArray<FMatrix>());
-      PerformSkinning();
    }
 }
 
@@ -450,7 +448,6 @@ void USkinnedMeshComponent::SetSkeletalMesh(const FString& PathFileName, bool bP
       
       const TArray<FMatrix> IdentityMatrices(SkeletalMesh->GetBoneCount(), FMatrix::Identity());
       UpdateSkinningMatrices(IdentityMatrices, IdentityMatrices);
-      PerformSkinning();
       
       const TArray<FGroupInfo>& GroupInfos = SkeletalMesh->GetMeshGroupInfo();
       MaterialSlots.resize(GroupInfos.size());
@@ -474,106 +471,46 @@ void USkinnedMeshComponent::SetSkeletalMesh(const FString& PathFileName, bool bP
    {
       SkeletalMesh = nullptr;
       UpdateSkinningMatrices(TArray<FMatrix>(), TArray<FMatrix>());
-      PerformSkinning();
    }
 }
 
 void USkinnedMeshComponent::PerformSkinning()
 {
-   if (!SkeletalMesh || FinalSkinningMatrices.IsEmpty()) { return; }
+   if (!SkeletalMesh || !CPUSkinnedVertexBuffer || FinalSkinningMatrices.IsEmpty()) { return; }
    if (!bSkinningMatricesDirty) { return; }
 
-   if (bForceGPUSkinning)
-   {      
-      return;
-   }
-
-   TIME_PROFILE(CPUSkinning)
    const TArray<FSkinnedVertex>& SrcVertices = SkeletalMesh->GetSkeletalMeshData()->Vertices;
    const int32 NumVertices = SrcVertices.Num();
-   SkinnedVertices.SetNum(NumVertices);
-
-   for (int32 Idx = 0; Idx < NumVertices; ++Idx)
-   {
-      const FSkinnedVertex& SrcVert = SrcVertices[Idx];
-      FNormalVertex& DstVert = SkinnedVertices[Idx];
-
-      DstVert.pos = SkinVertexPosition(SrcVert); 
-      DstVert.normal = SkinVertexNormal(SrcVert);
-      DstVert.Tangent = SkinVertexTangent(SrcVert);
-      DstVert.tex = SrcVert.UV;
-   }
-   TIME_PROFILE_END(CPUSkinning)   
-}
-
-void USkinnedMeshComponent::UpdateSkinningMatrices(const TArray<FMatrix>& InSkinningMatrices, const TArray<FMatrix>& InSkinningNormalMatrices)
-{
-   FinalSkinningMatrices = InSkinningMatrices;
-   FinalSkinningNormalMatrices = InSkinningNormalMatrices;
-   bSkinningMatricesDirty = true;   
-
-}
-
-FVector USkinnedMeshComponent::SkinVertexPosition(const FSkinnedVertex& InVertex) const
-{
-   FVector BlendedPosition(0.f, 0.f, 0.f);
+   if (NumVertices == 0) { return; }
+   bSkinningMatricesDirty = false;
 
-   for (int32 Idx = 0; Idx < 4; ++Idx)
+   // 중간 TArray 없이 WRITE_DISCARD로 매핑한 버퍼에 워커들이 정점 범위별로 바로 기록
+   ID3D11DeviceContext* DeviceContext = GEngine.GetRHIDevice()->GetDeviceContext();
+   D3D11_MAPPED_SUBRESOURCE MSR;
    {
-      const uint32 BoneIndex = InVertex.BoneIndices[Idx];
-      const float Weight = InVertex.BoneWeights[Idx];
-
-      if (Weight > 0.f)
+      TIME_PROFILE(VertexBuffer)
+      if (FAILED(DeviceContext->Map(CPUSkinnedVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MSR)))
       {
-         const FMatrix& SkinMatrix = FinalSkinningMatrices[BoneIndex];
-         FVector TransformedPosition = SkinMatrix.TransformPosition(InVertex.Position);
-         BlendedPosition += TransformedPosition * Weight;
+         return;
       }
    }
 
-   return BlendedPosition;
-}
-
-FVector USkinnedMeshComponent::SkinVertexNormal(const FSkinnedVertex& InVertex) const
-{
-   FVector BlendedNormal(0.f, 0.f, 0.f);
-
-   for (int32 Idx = 0; Idx < 4; ++Idx)
    {
-      const uint32 BoneIndex = InVertex.BoneIndices[Idx];
-      const float Weight = InVertex.BoneWeights[Idx];
-
-      if (Weight > 0.f)
-      {
-         const FMatrix& SkinMatrix = FinalSkinningNormalMatrices[BoneIndex];
-         FVector TransformedNormal = SkinMatrix.TransformVector(InVertex.Normal);
-         BlendedNormal += TransformedNormal * Weight;
-      }
+      TIME_PROFILE(CPUSkinning)
+      FCPUSkinning::SkinVertices(SrcVertices.data(), SkeletalMesh->GetCompactSkinInfluences(), NumVertices,
+         FinalSkinningMatrices.data(), FinalSkinningNormalMatrices.data(), static_cast<FVertexDynamic*>(MSR.pData));
    }
 
-   return BlendedNormal.GetSafeNormal();
+   {
+      TIME_PROFILE(VertexBuffer)
+      DeviceContext->Unmap(CPUSkinnedVertexBuffer, 0);
+   }
 }
 
-FVector4 USkinnedMeshComponent::SkinVertexTangent(const FSkinnedVertex& InVertex) const
+void USkinnedMeshComponent::UpdateSkinningMatrices(const TArray<FMatrix>& InSkinningMatrices, const TArray<FMatrix>& InSkinningNormalMatrices)
 {
-   const FVector OriginalTangentDir(InVertex.Tangent.X, InVertex.Tangent.Y, InVertex.Tangent.Z);
-   const float OriginalSignW = InVertex.Tangent.W;
-
-   FVector BlendedTangentDir(0.f, 0.f, 0.f);
-
-   for (int32 Idx = 0; Idx < 4; ++Idx)
-   {
-      const uint32 BoneIndex = InVertex.BoneIndices[Idx];
-      const float Weight = InVertex.BoneWeights[Idx];
-
-      if (Weight > 0.f)
-      {
-         const FMatrix& SkinMatrix = FinalSkinningMatrices[BoneIndex];
-         FVector TransformedTangentDir = SkinMatrix.TransformVector(OriginalTangentDir);
-         BlendedTangentDir += TransformedTangentDir * Weight;
-      }
-   }
+   FinalSkinningMatrices = InSkinningMatrices;
+   FinalSkinningNormalMatrices = InSkinningNormalMatrices;
+   bSkinningMatricesDirty = true;   
 
-   const FVector FinalTangentDir = BlendedTangentDir.GetSafeNormal();
-   return { FinalTangentDir.X, FinalTangentDir.Y, FinalTangentDir.Z, OriginalSignW };
 }
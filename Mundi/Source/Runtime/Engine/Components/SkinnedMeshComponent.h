@@ -22,7 +22,7 @@ public:
     
 // Mesh Component Section
 public:
-    void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
+    void CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
     
     FAABB GetWorldAABB() const override;
     void OnTransformUpdated() override;
@@ -44,9 +44,13 @@ public:
     USkeletalMesh* GetSkeletalMesh() const { return SkeletalMesh; }
 
 protected:
+    /**
+     * @brief CPU 스키닝 결과를 CPUSkinnedVertexBuffer에 직접 기록 (Map -> FCPUSkinning::SkinVertices -> Unmap)
+     * 디바이스 컨텍스트를 쓰므로 렌더 수집(CollectMeshBatches) 중에만 호출
+     */
     void PerformSkinning();
     /**
-     * @brief 자식에게서 원본 메시를 받아 CPU 스키닝을 수행
+     * @brief 자식이 계산한 스키닝 행렬을 저장하고 다음 렌더 수집 때 CPU 스키닝하도록 표시
      * @param InSkinningMatrices 스키닝 매트릭스
      */
     void UpdateSkinningMatrices(const TArray<FMatrix>& InSkinningMatrices, const TArray<FMatrix>& InSkinningNormalMatrices);
@@ -56,20 +60,10 @@ protected:
 
     bool bForceGPUSkinning = false;
 
-    /**
-     * @brief CPU 스키닝 최종 결과물. 렌더러가 이 데이터를 사용합니다.
-     */
-    TArray<FNormalVertex> SkinnedVertices;
-    /**
-     * @brief CPU 스키닝 최종 결과물. 렌더러가 이 데이터를 사용합니다.
-     */
-    TArray<FNormalVertex> NormalSkinnedVertices;
+    /** 마지막 렌더 수집(CollectMeshBatches) 이후 지난 시간 (USkeletalMeshComponent가 틱마다 누적, URO 화면 밖 판정) */
+    float TimeSinceLastRender = 0.0f;
 
 private:
-    FVector SkinVertexPosition(const FSkinnedVertex& InVertex) const;
-    FVector SkinVertexNormal(const FSkinnedVertex& InVertex) const;
-    FVector4 SkinVertexTangent(const FSkinnedVertex& InVertex) const;
-
     /**
      * @brief 자식이 계산해 준, 현재 프레임의 최종 스키닝 행렬
     */
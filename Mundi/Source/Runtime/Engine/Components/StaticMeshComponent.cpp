@@ -157,15 +157,26 @@ void UStaticMeshComponent::OnStaticMeshReleased(UStaticMesh* ReleasedMesh)
 	}
 
 	StaticMesh = nullptr;
+	CachedDrawCommands.Invalidate();
 }
 
-void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void UStaticMeshComponent::CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
 {
 	if (!StaticMesh || !StaticMesh->GetStaticMeshAsset())
 	{
 		return;
 	}
 
+	// 메시/머티리얼/트랜스폼/뷰 매크로가 그대로면 지난 프레임에 만든 배치를 그대로 쓴다
+	if (CachedDrawStaticMesh == StaticMesh && CachedDrawCommands.IsValid(View->ViewShaderMacroKey, MaterialSlots))
+	{
+		CachedDrawCommands.AppendTo(OutMeshBatchElements);
+		return;
+	}
+
+	CachedDrawCommands.BeginBuild(View->ViewShaderMacroKey, MaterialSlots);
+	CachedDrawStaticMesh = StaticMesh;
+
 	const TArray<FGroupInfo>& MeshGroupInfos = StaticMesh->GetMeshGroupInfo();
 
 	auto DetermineMaterialAndShader = [&](uint32 SectionIndex) -> TPair<UMaterialInterface*, UShader*>
@@ -241,6 +252,18 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 			BatchElement.InputLayout = ShaderVariant->InputLayout;
 		}
 
+		// 셰이더가 인스턴싱 변형을 제공하면 자동 인스턴싱(FMeshAutoInstancing)용 셰이더도 준비
+		if (ShaderToUse->SupportsInstancing())
+		{
+			ShaderMacros.Add(FShaderMacro("USE_INSTANCING", "1"));
+			if (FShaderVariant* InstancedVariant = ShaderToUse->GetOrCompileShaderVariant(ShaderMacros))
+			{
+				BatchElement.InstancedVertexShader = InstancedVariant->VertexShader;
+				BatchElement.InstancedPixelShader = InstancedVariant->PixelShader;
+				BatchElement.InstancedInputLayout = InstancedVariant->InputLayout;
+			}
+		}
+
 		// UMaterialInterface를 UMaterial로 캐스팅해야 할 수 있음. 렌더러가 UMaterial을 기대한다면.
 		// 지금은 Material.h 구조상 UMaterialInterface에 필요한 정보가 다 있음.
 		BatchElement.Material = MaterialToUse;
@@ -258,8 +281,11 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 		BatchElement.bUseWindAnimation = MaterialToUse->IsWindAnimationEnabled();
 		BatchElement.WindMeshHeight = MaterialToUse->GetWindMeshHeight();
 
-		OutMeshBatchElements.Add(BatchElement);
+		CachedDrawCommands.AddBatch(BatchElement, ShaderToUse);
 	}
+
+	CachedDrawCommands.EndBuild();
+	CachedDrawCommands.AppendTo(OutMeshBatchElements);
 }
 
 void UStaticMeshComponent::SetStaticMesh(const FString& PathFileName)
@@ -36,7 +36,7 @@ public:
 
 	void OnStaticMeshReleased(UStaticMesh* ReleasedMesh);
 
-	void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
+	void CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
 
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
 
@@ -61,6 +61,9 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Static Mesh", Tooltip="Static mesh asset to render")
 	UStaticMesh* StaticMesh = nullptr;
 
+	// CachedDrawCommands를 만들 때 쓴 메시 (프로퍼티 편집으로 StaticMesh가 직접 바뀐 경우 감지용)
+	UStaticMesh* CachedDrawStaticMesh = nullptr;
+
 	// Physics 설정
 	UPROPERTY(EditAnywhere, Category="Physics", Tooltip="체크 시 Static 물리 전환, 체크 해제 시 물리 제거")
 	bool bEnableCollision = true;
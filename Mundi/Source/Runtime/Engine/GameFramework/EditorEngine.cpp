@@ -5,6 +5,9 @@
 #include "Source/Editor/FBX/FbxLoader.h"
 #include "GameModeBase.h"
 #include "InputManager.h"
+#include "AnimPoseCache.h"
+#include "AnimPosePool.h"
+#include "AnimSequence.h"
 #include "Pawn.h"
 #include "SelectionManager.h"
 #include "USlateManager.h"
@@ -337,6 +340,14 @@ void UEditorEngine::MainLoop()
             bChangedPieToEditor = false;
         }
 
+        // 프레임 아레나 교체 (2프레임 전 임시 메모리 일괄 해제)
+        FFrameAllocator::Get().BeginFrame();
+        // 지난 프레임 공유 포즈 캐시 비움 (통계는 오버레이용으로 보관)
+        FAnimPoseCache::Get().BeginFrame();
+        FAnimPosePool::BeginFrame();
+        // 지난 프레임에 새 스켈레톤 리비전으로 대체된 트랙-본 표 정리 (평가 중인 참조가 없는 시점)
+        UAnimSequence::PruneStaleTrackToBoneMaps();
+
         Tick(DeltaSeconds);
         Render();
         
@@ -34,6 +34,8 @@
 #include "Hash.h"
 #include "InputManager.h"
 #include "GameModeBase.h"
+#include "SkeletalMeshComponent.h"
+#include "ParallelFor.h"
 
 IMPLEMENT_CLASS(UWorld)
 
@@ -362,6 +364,9 @@ void UWorld::Tick(float DeltaSeconds)
 		PhysScene->WaitForSimulation();
 	}
 
+	// 액터 Tick 중의 애니메이션 갱신은 아래 애니메이션 단계로 모은다
+	bAcceptAnimationUpdates = true;
+
 	if (Level)
 	{
 		// Tick 중에 새로운 actor가 추가될 수도 있어서 복사 후 호출
@@ -396,6 +401,11 @@ void UWorld::Tick(float DeltaSeconds)
 		}
     }
 
+	bAcceptAnimationUpdates = false;
+
+	// 애니메이션 단계 (루트 모션/바디 동기화가 아래 물리 스텝보다 먼저 반영되어야 함)
+	TickAnimations();
+
 	// Lua 코루틴 전용 Tick
 	if (LuaManager && bPie)
 	{
@@ -427,6 +437,58 @@ void UWorld::Tick(float DeltaSeconds)
 	ProcessPendingKillActors();
 }
 
+bool UWorld::QueueAnimationUpdate(USkeletalMeshComponent* Component)
+{
+	if (!Component || !bAcceptAnimationUpdates)
+	{
+		return false;
+	}
+
+	PendingAnimationComponents.Add(Component);
+	return true;
+}
+
+void UWorld::CancelAnimationUpdate(USkeletalMeshComponent* Component)
+{
+	// Finalize 루프 도중(노티파이에서 액터 파괴)에도 인덱스가 밀리지 않도록 지우지 않고 비운다
+	const int32 Index = PendingAnimationComponents.Find(Component);
+	if (Index != INDEX_NONE)
+	{
+		PendingAnimationComponents[Index] = nullptr;
+	}
+}
+
+void UWorld::TickAnimations()
+{
+	if (PendingAnimationComponents.IsEmpty())
+	{
+		return;
+	}
+
+	TIME_PROFILE(AnimationUpdate)
+
+	// 포즈 평가/스키닝: 컴포넌트 단위로 분배
+	// 시퀀스 같은 공유 에셋은 읽기만 한다 (노티파이 메타는 에셋 등록 때 게임 스레드에서 미리 로드, 트랙-본 표/포즈 캐시는 잠금으로 보호)
+	ParallelFor(PendingAnimationComponents.Num(), [this](int32 Index)
+	{
+		if (USkeletalMeshComponent* Component = PendingAnimationComponents[Index])
+		{
+			Component->ParallelUpdateAnimation();
+		}
+	});
+
+	// 노티파이 디스패치는 게임 로직(Lua 포함)을 호출하므로 게임 스레드에서 예약 순서대로 처리
+	for (int32 Index = 0; Index < PendingAnimationComponents.Num(); ++Index)
+	{
+		if (USkeletalMeshComponent* Component = PendingAnimationComponents[Index])
+		{
+			Component->FinalizeAnimationUpdate();
+		}
+	}
+
+	PendingAnimationComponents.Empty();
+}
+
 UWorld* UWorld::DuplicateWorldForPIE(UWorld* InEditorWorld)
 {
 	// 레벨 새로 생성
@@ -29,6 +29,7 @@ class UStaticMesh;
 class FOcclusionCullingManagerCPU;
 class APlayerCameraManager;
 class AGameModeBase;
+class USkeletalMeshComponent;
 
 struct FTransform;
 struct FSceneCompData;
@@ -125,6 +126,14 @@ public:
     // Overlap pair de-duplication (per-frame)
     bool TryMarkOverlapPair(const AActor* A, const AActor* B);
 
+    /**
+     * 액터 Tick 중 요청된 스켈레탈 애니메이션 갱신을 애니메이션 단계에 예약
+     * @return 액터 Tick 구간 밖이라 예약할 수 없으면 false (호출자가 즉시 처리)
+     */
+    bool QueueAnimationUpdate(USkeletalMeshComponent* Component);
+    /** 예약된 애니메이션 갱신 취소 (EndPlay 등에서 호출) */
+    void CancelAnimationUpdate(USkeletalMeshComponent* Component);
+
     TMap<TWeakObjectPtr<AActor>, FActorTimeState> ActorTimingMap;
 
     /** === 필요한 엑터 게터 === */
@@ -211,6 +220,15 @@ private:
     // Per-frame processed overlap pairs (A,B) keyed canonically
     TSet<uint64> FrameOverlapPairs;
 
+    /**
+     * 애니메이션 단계: 포즈 평가는 워커에서 병렬로, 노티파이/루트모션/물리 동기화는 게임 스레드에서 순서대로
+     */
+    void TickAnimations();
+    // 액터 Tick 동안 예약된 스켈레탈 메시 컴포넌트 (예약 순서 = Finalize 순서)
+    TArray<USkeletalMeshComponent*> PendingAnimationComponents;
+    // 액터 Tick 루프 중에만 true
+    bool bAcceptAnimationUpdates = false;
+
     //Timinig
     float UnscaledDelta;
     float SlomoOnlyDelta;
@@ -44,6 +44,7 @@ void UWorldPartitionManager::Clear()
 
 	ComponentDirtyQueue.Empty();
 	ComponentDirtySet.Empty();
+	++StaticBoundsRevision;
 }
 
 // 새로 만들어진 StaticMeshComponent를 등록하는 상황에서 맥락을 분명히 드러내기 위한 API입니다.
@@ -78,6 +79,7 @@ void UWorldPartitionManager::BulkRegister(const TArray<AActor*>& Actors)
 	}
 
 	if (BVH) BVH->BulkUpdate(StaticMeshComponents);
+	++StaticBoundsRevision;
 }
 
 void UWorldPartitionManager::Unregister(UPrimitiveComponent* Component)
@@ -87,6 +89,10 @@ void UWorldPartitionManager::Unregister(UPrimitiveComponent* Component)
 		if (BVH) BVH->Remove(Smc);
 
 		ComponentDirtySet.erase(Smc);
+		if (Smc->IsA(UStaticMeshComponent::StaticClass()))
+		{
+			++StaticBoundsRevision;
+		}
 	}
 }
 
@@ -123,6 +129,12 @@ void UWorldPartitionManager::MarkDirty(UPrimitiveComponent* Smc)
 		return;
 	}
 
+	// 이미 큐에 있더라도 바운드는 다시 바뀌었으므로 리비전은 항상 올린다
+	if (Smc->IsA(UStaticMeshComponent::StaticClass()))
+	{
+		++StaticBoundsRevision;
+	}
+
 	// second: 새로운 요소가 성공적으로 삽입되었으면 true, 이미 요소가 존재하여 삽입에 실패했으면 false
 	// DirtyQueue 중복 삽입 방지 로직
 	if (ComponentDirtySet.insert(Smc).second)
@@ -151,6 +163,11 @@ void UWorldPartitionManager::Update(float DeltaTime, const uint32 BudgetCount)
 
 		if (!Component) continue;
 		if (BVH) BVH->Update(Component);
+		// 대기 상태가 풀리면서 BVH 쿼리 결과에 새로 잡히게 되므로 캐시 무효화 대상
+		if (Component->IsA(UStaticMeshComponent::StaticClass()))
+		{
+			++StaticBoundsRevision;
+		}
 
 		++processed;
 	}
@@ -2,17 +2,22 @@
 #include "ParticleAsyncUpdater.h"
 
 #include "PlatformTime.h"
+#include "Source/Runtime/Engine/Particle/ParticleEmitterInstance.h"
+#include "Source/Runtime/Engine/Particle/ParticleLODLevel.h"
+#include "Source/Runtime/Engine/Particle/Modules/ParticleModuleCollision.h"
+#include "Source/Runtime/Engine/Particle/Modules/ParticleModuleEventReceiverSpawn.h"
 
 FParticleAsyncUpdater::~FParticleAsyncUpdater()
 {
-    if (TaskHandle.valid())
+    if (PendingJob)
     {
         // 1. 작업이 끝날 때까지 기다림
-        TaskHandle.wait();
+        PendingJob->Group.Wait();
 
         // 2. ★ 중요 ★ 결과물을 꺼내야 함!
-        // 이걸 안 하면 future 안에 들어있던 포인터 뭉치가 그냥 증발(Leak)함
-        FAsyncSimulationResult PendingResult = TaskHandle.get();
+        // 이걸 안 하면 작업 결과에 들어있던 포인터 뭉치가 그냥 증발(Leak)함
+        FAsyncSimulationResult PendingResult = std::move(PendingJob->Result);
+        PendingJob.reset();
 
         // 3. 꺼낸 데이터(막 생성된 따끈따끈한 릭 유발자들)를 수동으로 삭제
         for (FDynamicEmitterDataBase* Data : PendingResult.RenderData)
@@ -30,42 +35,37 @@ void FParticleAsyncUpdater::KickOff(const TArray<FParticleEmitterInstance*>& Ins
 {
     if (IsBusy()) { return; }
     
-    if (TaskHandle.valid())
+    if (PendingJob)
     {
-        FAsyncSimulationResult Result = TaskHandle.get();
-        
         // 데이터 교체 (Swap)
-        InternalClearRenderData();
-        RenderData = std::move(Result.RenderData);
-        LastFrameStats = Result.Stats;
+        AdoptResult(PendingJob->Result);
+        PendingJob.reset();
     }
     
-    TaskHandle = std::async(std::launch::async, [Instances, Context]() 
-    {
-        return DoSimulationWork(Instances, Context);
-    });
+    // 컴포넌트마다 스레드를 새로 띄우지 않고 공용 워커 풀에 태스크로 올림
+    // 컨텍스트는 값으로 복사해 작업이 충돌체 목록까지 소유 (컴포넌트가 다음 프레임에 Tick하지 않아도 안전)
+    PendingJob = std::make_shared<FParticleSimulationJob>();
+    FWorkerPool::GetInstance().Launch(PendingJob->Group,
+        [Job = PendingJob, Instances, Context, Recycled = std::move(SpareRenderData)]() mutable
+        {
+            Job->Result = DoSimulationWork(Instances, Context, std::move(Recycled));
+        });
+    SpareRenderData = TArray<FDynamicEmitterDataBase*>();
 }
 
 void FParticleAsyncUpdater::KickOffSync(const TArray<FParticleEmitterInstance*>& Instances, FParticleSimulationContext& Context)
 {
     Sync();
-    if (!RenderData.IsEmpty())
-    {
-        InternalClearRenderData();
-    }
-    FAsyncSimulationResult Result = DoSimulationWork(Instances, Context);
-    // 새 데이터로 교체
-    RenderData = std::move(Result.RenderData);
-
-    // 통계 갱신
-    LastFrameStats = Result.Stats;
+    FAsyncSimulationResult Result = DoSimulationWork(Instances, Context, std::move(SpareRenderData));
+    // 새 데이터로 교체 + 통계 갱신
+    AdoptResult(Result);
 }
 
 void FParticleAsyncUpdater::EnsureCompletion()
 {
-    if (TaskHandle.valid())
+    if (PendingJob)
     {
-        TaskHandle.wait();
+        PendingJob->Group.Wait();
     }
 }
 
@@ -82,19 +82,14 @@ void FParticleAsyncUpdater::Sync()
 
 bool FParticleAsyncUpdater::TrySync()
 {
-    if (!TaskHandle.valid()) return false;
+    if (!PendingJob) return false;
 
     // 즉시 상태 확인
-    auto Status = TaskHandle.wait_for(std::chrono::seconds(0));
-    if (Status == std::future_status::ready)
+    if (PendingJob->Group.IsDone())
     {
-        // 작업 완료
-        FAsyncSimulationResult Result = TaskHandle.get();
-
-        // 데이터 교체
-        InternalClearRenderData();
-        RenderData = std::move(Result.RenderData);
-        LastFrameStats = Result.Stats;
+        // 작업 완료 -> 데이터 교체
+        AdoptResult(PendingJob->Result);
+        PendingJob.reset();
             
         return true;
     }
@@ -104,13 +99,15 @@ bool FParticleAsyncUpdater::TrySync()
 
 bool FParticleAsyncUpdater::IsBusy() const
 {
-    return TaskHandle.valid() && TaskHandle.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+    return PendingJob && !PendingJob->Group.IsDone();
 }
 
-FAsyncSimulationResult FParticleAsyncUpdater::DoSimulationWork(const TArray<FParticleEmitterInstance*>& Instances, FParticleSimulationContext Context)
+FAsyncSimulationResult FParticleAsyncUpdater::DoSimulationWork(const TArray<FParticleEmitterInstance*>& Instances, FParticleSimulationContext& Context, TArray<FDynamicEmitterDataBase*> RecycledRenderData)
 {
     TIME_PROFILE(Particle_Simulation)
     FAsyncSimulationResult Result;
+    Result.RenderData = std::move(RecycledRenderData);
+    Result.RenderData.Empty();
         
     // 통계 초기화
     Result.Stats.bAllEmittersComplete = true;
@@ -120,15 +117,55 @@ FAsyncSimulationResult FParticleAsyncUpdater::DoSimulationWork(const TArray<FPar
     const FVector ViewOrigin = Context.CameraLocation; // 혹은 Context.CameraLocation (별도 추가 권장)
     const FVector ViewDir = Context.CameraRotation.ToEulerZYXDeg(); // 혹은 Context.CameraForward
 
-    for (int32 Idx = 0; Idx < Instances.Num(); ++Idx)
+    // 이미터 하나 = 태스크 하나. 결과는 이미터 인덱스 칸에 써서 스레드 배치와 무관하게 순서를 유지
+    const int32 NumInstances = Instances.Num();
+    Result.RenderData.resize(NumInstances, nullptr);
+
+    auto SimulateEmitter = [&](int32 Idx)
+        {
+            FParticleEmitterInstance* Inst = Instances[Idx];
+            if (!Inst) return;
+
+            // 시뮬레이션 수행
+            Inst->Tick(Context);
+
+            // 렌더 데이터 생성
+            FDynamicEmitterDataBase* EmitterData = Inst->CreateDynamicData();
+            if (EmitterData)
+            {
+                EmitterData->EmitterIndex = Idx;
+                if (EmitterData->EmitterType == EParticleType::Sprite)
+                {
+                    auto* SpriteData = static_cast<FDynamicSpriteEmitterData*>(EmitterData);
+                    SpriteData->SortParticles(ViewOrigin, ViewDir, Context.ComponentWorldMatrix, SpriteData->AsyncSortedIndices);
+                }
+                else if (EmitterData->EmitterType == EParticleType::Mesh)
+                {
+                    auto* MeshData = static_cast<FDynamicMeshEmitterData*>(EmitterData);
+                    MeshData->SortParticles(ViewOrigin, ViewDir, Context.ComponentWorldMatrix, MeshData->AsyncSortedIndices);
+                }
+            }
+            Result.RenderData[Idx] = EmitterData;
+        };
+
+    // 파티클 이벤트(충돌 -> 이벤트 스폰)는 Context.EventData를 통해 앞 이미터 결과를 뒤 이미터가 읽으므로 순서대로 돌림
+    if (UsesParticleEvents(Instances))
     {
-        FParticleEmitterInstance* Inst = Instances[Idx];
-        if (!Inst) continue;
+        for (int32 Idx = 0; Idx < NumInstances; ++Idx)
+        {
+            SimulateEmitter(Idx);
+        }
+    }
+    else
+    {
+        ParallelFor(NumInstances, SimulateEmitter);
+    }
 
-        // 시뮬레이션 수행
-        Inst->Tick(Context);
+    // 통계 집계
+    for (FParticleEmitterInstance* Inst : Instances)
+    {
+        if (!Inst) continue;
 
-        // 통계 집계
         int32 Count = Inst->ActiveParticles;
         Result.Stats.TotalActiveParticles += Count;
             
@@ -141,27 +178,39 @@ FAsyncSimulationResult FParticleAsyncUpdater::DoSimulationWork(const TArray<FPar
         {
             Result.Stats.bAllEmittersComplete = false;
         }
+    }
 
-        // 렌더 데이터 생성
-        FDynamicEmitterDataBase* EmitterData = Inst->CreateDynamicData();
-        if (EmitterData)
+    // 파티클이 없어 렌더 데이터가 안 나온 칸 제거 (순서 유지)
+    Result.RenderData.erase(std::remove(Result.RenderData.begin(), Result.RenderData.end(), nullptr), Result.RenderData.end());
+
+    return Result;
+}
+
+bool FParticleAsyncUpdater::UsesParticleEvents(const TArray<FParticleEmitterInstance*>& Instances)
+{
+    for (FParticleEmitterInstance* Inst : Instances)
+    {
+        if (!Inst || !Inst->CurrentLODLevel) continue;
+
+        for (UParticleModule* Module : Inst->CurrentLODLevel->AllModulesCache)
         {
-            EmitterData->EmitterIndex = Idx;
-            if (EmitterData->EmitterType == EParticleType::Sprite)
+            if (Module && Module->bEnabled &&
+                (Cast<UParticleModuleCollision>(Module) || Cast<UParticleModuleEventReceiverSpawn>(Module)))
             {
-                auto* SpriteData = static_cast<FDynamicSpriteEmitterData*>(EmitterData);
-                SpriteData->SortParticles(ViewOrigin, ViewDir, Context.ComponentWorldMatrix, SpriteData->AsyncSortedIndices);
+                return true;
             }
-            else if (EmitterData->EmitterType == EParticleType::Mesh)
-            {
-                auto* MeshData = static_cast<FDynamicMeshEmitterData*>(EmitterData);
-                MeshData->SortParticles(ViewOrigin, ViewDir, Context.ComponentWorldMatrix, MeshData->AsyncSortedIndices);
-            }
-            Result.RenderData.Add(EmitterData);
         }
     }
+    return false;
+}
 
-    return Result;
+void FParticleAsyncUpdater::AdoptResult(FAsyncSimulationResult& Result)
+{
+    // 이전 데이터 삭제 후 배열만 바꿔 끼움 (Empty는 capacity 유지)
+    InternalClearRenderData();
+    RenderData.swap(Result.RenderData);
+    SpareRenderData.swap(Result.RenderData);
+    LastFrameStats = Result.Stats;
 }
 
 void FParticleAsyncUpdater::InternalClearRenderData()
@@ -1,6 +1,7 @@
 ﻿#pragma once
-#include <future>
+#include <memory>
 
+#include "ParallelFor.h"
 #include "Source/Runtime/Engine/Particle/DynamicEmitterDataBase.h"
 
 struct FParticleFrameStats
@@ -18,12 +19,19 @@ struct FAsyncSimulationResult
     FParticleFrameStats Stats;
 };
 
+// 워커 풀에 올라간 시뮬레이션 작업 하나 (태스크와 Updater가 공유)
+struct FParticleSimulationJob
+{
+    FTaskGroup Group;
+    FAsyncSimulationResult Result;
+};
+
 class FParticleAsyncUpdater
 {
 public:
     FParticleAsyncUpdater() = default;
 
-    // TaskHandle(std::future)은 복사할 수 없으므로, 그냥 빈 상태로 초기화
+    // 진행 중인 작업은 공유하지 않으므로, 그냥 빈 상태로 초기화
     FParticleAsyncUpdater(const FParticleAsyncUpdater& Other)
     {
         LastFrameStats = FParticleFrameStats();
@@ -33,7 +41,7 @@ public:
     {
         if (this != &Other)
         {
-            if (TaskHandle.valid()) TaskHandle.wait();
+            EnsureCompletion();
             InternalClearRenderData();
             LastFrameStats = FParticleFrameStats();
         }
@@ -63,8 +71,16 @@ public:
     bool IsBusy() const;
 
 private:
-    static FAsyncSimulationResult DoSimulationWork(const TArray<FParticleEmitterInstance*>& Instances, FParticleSimulationContext Context);
+    // 이미터마다 태스크로 나눠 Tick (큰 SoA 이미터는 Tick 안에서 다시 청크 태스크로 나뉨)
+    static FAsyncSimulationResult DoSimulationWork(const TArray<FParticleEmitterInstance*>& Instances, FParticleSimulationContext& Context, TArray<FDynamicEmitterDataBase*> RecycledRenderData);
     void InternalClearRenderData();
-    // 비동기 작업 핸들
-    std::future<FAsyncSimulationResult> TaskHandle;
+    // 이벤트를 주고받는 모듈(Collision, EventReceiverSpawn)이 있는지 (있으면 이미터를 순서대로 Tick)
+    static bool UsesParticleEvents(const TArray<FParticleEmitterInstance*>& Instances);
+    // 완료된 결과를 RenderData로 교체하고, 비운 이전 배열은 다음 작업용으로 보관
+    void AdoptResult(FAsyncSimulationResult& Result);
+
+    // RenderData와 번갈아 쓰는 예비 배열 (capacity 재사용으로 작업마다 힙 할당 방지)
+    TArray<FDynamicEmitterDataBase*> SpareRenderData;
+    // 진행 중(또는 끝났지만 아직 가져오지 않은) 작업. 없으면 nullptr
+    std::shared_ptr<FParticleSimulationJob> PendingJob;
 };
\ No newline at end of file
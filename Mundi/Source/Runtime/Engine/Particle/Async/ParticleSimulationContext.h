@@ -60,6 +60,6 @@ struct FParticleSimulationContext
     int32 CurrentLODIndex;
 
     // 충돌 정보
-    TArray<FColliderProxy> WorldColliders; // 이번 프레임 월드에 있는 충돌체 정보
+    TArray<FColliderProxy> WorldColliders; // 이번 프레임 월드에 있는 충돌체 정보 (비동기 작업은 컨텍스트 복사본으로 자기 목록을 소유)
     TArray<FParticleEventData> EventData; // 이번 프레임 발생한 이벤트 정보들
 };
@@ -4,6 +4,7 @@
 // Forward declarations
 struct FParticleEmitterInstance;
 struct FBaseParticle;
+struct FParticleSoAContainer;
 
 // Distribution 타입들 - 파티클 파라미터의 랜덤/커브 값을 표현
 template<typename T>
@@ -96,7 +97,14 @@ public:
         Update(Owner, Offset, Context.DeltaTime);
     }
 
-    
+    // SoA 레이아웃 업데이트 지원 여부
+    // LOD의 모든 Update 모듈이 true를 반환해야 Emitter가 SoA 모드로 전환된다.
+    virtual bool SupportsSoAUpdate() const { return false; }
+    // SoA 스트림 [StartIndex, EndIndex) 구간의 벡터화 업데이트 (SupportsSoAUpdate()가 true인 모듈만 호출됨)
+    // 큰 Emitter는 구간을 나눠 여러 워커에서 동시에 부르므로, 파티클 하나씩 독립적으로 계산하고 RNG/이벤트를 쓰면 안 됨
+    // StartIndex는 4의 배수, EndIndex를 4로 올림한 곳까지 처리해도 된다
+    virtual void UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAContainer& Streams, int32 StartIndex, int32 EndIndex, FParticleSimulationContext& Context) {}
+
 
 public:
     EParticleModuleType ModuleType;
@@ -48,3 +48,45 @@ void UParticleModuleColor::Update(FParticleEmitterInstance* Owner, int32 Offset,
     }
     END_UPDATE_LOOP;
 }
+
+void UParticleModuleColor::UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAContainer& Streams, int32 StartIndex, int32 EndIndex, FParticleSimulationContext& Context)
+{
+    if (!bUseColorOverLife && !bUseAlphaOverLife)
+        return;
+
+    const float* RelTime = Streams.GetStream(EParticleStream::RelativeTime);
+    float* ColorR = Streams.GetStream(EParticleStream::ColorR);
+    float* ColorG = Streams.GetStream(EParticleStream::ColorG);
+    float* ColorB = Streams.GetStream(EParticleStream::ColorB);
+    float* ColorA = Streams.GetStream(EParticleStream::ColorA);
+
+    const FLinearColor& MinColor = ColorOverLife.MinValue;
+    const FLinearColor& MaxColor = ColorOverLife.MaxValue;
+    const bool bColorRange = ColorOverLife.bUseRange;
+    const __m128 MinR = _mm_set1_ps(MinColor.R);
+    const __m128 MinG = _mm_set1_ps(MinColor.G);
+    const __m128 MinB = _mm_set1_ps(MinColor.B);
+    const __m128 SlopeR = _mm_set1_ps(bColorRange ? MaxColor.R - MinColor.R : 0.0f);
+    const __m128 SlopeG = _mm_set1_ps(bColorRange ? MaxColor.G - MinColor.G : 0.0f);
+    const __m128 SlopeB = _mm_set1_ps(bColorRange ? MaxColor.B - MinColor.B : 0.0f);
+    const __m128 MinA = _mm_set1_ps(AlphaOverLife.MinValue);
+    const __m128 SlopeA = _mm_set1_ps(AlphaOverLife.bUseRange ? AlphaOverLife.MaxValue - AlphaOverLife.MinValue : 0.0f);
+
+    const int32 SimdEnd = FParticleSoAContainer::GetSimdCount(EndIndex);
+    for (int32 i = StartIndex; i < SimdEnd; i += 4)
+    {
+        const __m128 t = _mm_load_ps(RelTime + i);
+
+        if (bUseColorOverLife)
+        {
+            _mm_store_ps(ColorR + i, _mm_add_ps(MinR, _mm_mul_ps(SlopeR, t)));
+            _mm_store_ps(ColorG + i, _mm_add_ps(MinG, _mm_mul_ps(SlopeG, t)));
+            _mm_store_ps(ColorB + i, _mm_add_ps(MinB, _mm_mul_ps(SlopeB, t)));
+        }
+
+        if (bUseAlphaOverLife)
+        {
+            _mm_store_ps(ColorA + i, _mm_add_ps(MinA, _mm_mul_ps(SlopeA, t)));
+        }
+    }
+}
@@ -29,4 +29,6 @@ public:
 
     virtual void Spawn(FParticleEmitterInstance* Owner, int32 Offset, float SpawnTime, FBaseParticle* ParticleBase) override;
     virtual void Update(FParticleEmitterInstance* Owner, int32 Offset, float DeltaTime) override;
+    virtual bool SupportsSoAUpdate() const override { return true; }
+    virtual void UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAContainer& Streams, int32 StartIndex, int32 EndIndex, FParticleSimulationContext& Context) override;
 };
@@ -2,6 +2,7 @@
 #include "ParticleModuleColorOverLife.h"
 #include "../ParticleEmitter.h"
 #include "../ParticleHelper.h"
+#include "../ParticleEmitterInstance.h"
 
 IMPLEMENT_CLASS(UParticleModuleColorOverLife)
 
@@ -58,8 +59,8 @@ void UParticleModuleColorOverLife::Update(FParticleEmitterInstance* Owner, int32
             Particle.Color.A = AlphaValue;
 
             // 첫 번째 파티클만 로그 출력
-            static int LogCount = 0;
-            if (LogCount < 5)
+            static std::atomic<int32> LogCount{ 0 }; // 이미터가 여러 워커에서 동시에 돌 수 있음
+            if (LogCount.load(std::memory_order_relaxed) < 5)
             {
                 UE_LOG("[ColorOverLife] t=%.3f, Alpha=%.3f, Color=(%.2f, %.2f, %.2f, %.2f)",
                     t, AlphaValue, Particle.Color.R, Particle.Color.G, Particle.Color.B, Particle.Color.A);
@@ -69,3 +70,49 @@ void UParticleModuleColorOverLife::Update(FParticleEmitterInstance* Owner, int32
     }
     END_UPDATE_LOOP;
 }
+
+void UParticleModuleColorOverLife::UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAContainer& Streams, int32 StartIndex, int32 EndIndex, FParticleSimulationContext& Context)
+{
+    if (!bUseColorOverLife && !bUseAlphaOverLife)
+        return;
+
+    const float* RelTime = Streams.GetStream(EParticleStream::RelativeTime);
+    float* ColorR = Streams.GetStream(EParticleStream::ColorR);
+    float* ColorG = Streams.GetStream(EParticleStream::ColorG);
+    float* ColorB = Streams.GetStream(EParticleStream::ColorB);
+    float* ColorA = Streams.GetStream(EParticleStream::ColorA);
+
+    // Color(t) = Min + (Max - Min) * t, 범위가 아니면 기울기 0
+    const FLinearColor& MinColor = ColorOverLife.MinValue;
+    const FLinearColor& MaxColor = ColorOverLife.MaxValue;
+    const bool bRange = ColorOverLife.bUseRange;
+    const __m128 MinR = _mm_set1_ps(MinColor.R);
+    const __m128 MinG = _mm_set1_ps(MinColor.G);
+    const __m128 MinB = _mm_set1_ps(MinColor.B);
+    const __m128 SlopeR = _mm_set1_ps(bRange ? MaxColor.R - MinColor.R : 0.0f);
+    const __m128 SlopeG = _mm_set1_ps(bRange ? MaxColor.G - MinColor.G : 0.0f);
+    const __m128 SlopeB = _mm_set1_ps(bRange ? MaxColor.B - MinColor.B : 0.0f);
+
+    const __m128 T1 = _mm_set1_ps(AlphaPoint1Time);
+    const __m128 V1 = _mm_set1_ps(AlphaPoint1Value);
+    const __m128 T2 = _mm_set1_ps(AlphaPoint2Time);
+    const __m128 V2 = _mm_set1_ps(AlphaPoint2Value);
+
+    const int32 SimdEnd = FParticleSoAContainer::GetSimdCount(EndIndex);
+    for (int32 i = StartIndex; i < SimdEnd; i += 4)
+    {
+        const __m128 t = _mm_load_ps(RelTime + i);
+
+        if (bUseColorOverLife)
+        {
+            _mm_store_ps(ColorR + i, _mm_add_ps(MinR, _mm_mul_ps(SlopeR, t)));
+            _mm_store_ps(ColorG + i, _mm_add_ps(MinG, _mm_mul_ps(SlopeG, t)));
+            _mm_store_ps(ColorB + i, _mm_add_ps(MinB, _mm_mul_ps(SlopeB, t)));
+        }
+
+        if (bUseAlphaOverLife)
+        {
+            _mm_store_ps(ColorA + i, ParticleEvaluateTwoPointCurvePS(t, T1, V1, T2, V2));
+        }
+    }
+}
@@ -32,6 +32,9 @@ public:
 
     // Update에서 RelativeTime(0~1)에 따라 Color와 Alpha 재계산
     virtual void Update(FParticleEmitterInstance* Owner, int32 Offset, float DeltaTime) override;
+    // SoA 모드: 같은 커브를 RelativeTime 스트림 위에서 SIMD로 평가
+    virtual bool SupportsSoAUpdate() const override { return true; }
+    virtual void UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAContainer& Streams, int32 StartIndex, int32 EndIndex, FParticleSimulationContext& Context) override;
 
 private:
     // Alpha 커브 평가 (0~1 범위)
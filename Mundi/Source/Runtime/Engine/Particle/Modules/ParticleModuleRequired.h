@@ -32,6 +32,10 @@ public:
     // ---- 공간 규칙 ----
     bool bUseLocalSpace    = false;
 
+    // ---- 시뮬레이션 ----
+    // 속성별 SoA 스트림 + SIMD 커널로 업데이트 (모든 Update 모듈이 지원할 때만 적용됨)
+    bool bUseSoALayout     = false;
+
     // ---- 렌더 기본 ----
     UMaterialInterface* Material = nullptr;  // UMaterial ?? UMaterialInstanceDynamic
 
@@ -2,6 +2,7 @@
 #include "ParticleModuleRotationRate.h"
 #include "../ParticleEmitter.h"
 #include "../ParticleHelper.h"
+#include "../ParticleEmitterInstance.h"
 
 IMPLEMENT_CLASS(UParticleModuleRotationRate)
 
@@ -42,3 +43,22 @@ void UParticleModuleRotationRate::Update(FParticleEmitterInstance* Owner, int32
     }
     END_UPDATE_LOOP;
 }
+
+void UParticleModuleRotationRate::UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAContainer& Streams, int32 StartIndex, int32 EndIndex, FParticleSimulationContext& Context)
+{
+    float* RotX = Streams.GetStream(EParticleStream::RotationX);
+    float* RotY = Streams.GetStream(EParticleStream::RotationY);
+    float* RotZ = Streams.GetStream(EParticleStream::RotationZ);
+    const float* RateX = Streams.GetStream(EParticleStream::RotationRateX);
+    const float* RateY = Streams.GetStream(EParticleStream::RotationRateY);
+    const float* RateZ = Streams.GetStream(EParticleStream::RotationRateZ);
+
+    const __m128 Dt = _mm_set1_ps(Context.DeltaTime);
+    const int32 SimdEnd = FParticleSoAContainer::GetSimdCount(EndIndex);
+    for (int32 i = StartIndex; i < SimdEnd; i += 4)
+    {
+        _mm_store_ps(RotX + i, _mm_add_ps(_mm_load_ps(RotX + i), _mm_mul_ps(_mm_load_ps(RateX + i), Dt)));
+        _mm_store_ps(RotY + i, _mm_add_ps(_mm_load_ps(RotY + i), _mm_mul_ps(_mm_load_ps(RateY + i), Dt)));
+        _mm_store_ps(RotZ + i, _mm_add_ps(_mm_load_ps(RotZ + i), _mm_mul_ps(_mm_load_ps(RateZ + i), Dt)));
+    }
+}
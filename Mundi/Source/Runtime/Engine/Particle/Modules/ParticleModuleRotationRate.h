@@ -27,4 +27,7 @@ public:
 
     // Update에서 Rotation += RotationRate * dt
     virtual void Update(FParticleEmitterInstance* Owner, int32 Offset, float DeltaTime) override;
+    // SoA 모드: Rotation 스트림에 RotationRate * dt를 4개씩 더함
+    virtual bool SupportsSoAUpdate() const override { return true; }
+    virtual void UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAContainer& Streams, int32 StartIndex, int32 EndIndex, FParticleSimulationContext& Context) override;
 };
@@ -53,3 +53,36 @@ void UParticleModuleSize::Update(FParticleEmitterInstance* Owner, int32 Offset,
     }
     END_UPDATE_LOOP;
 }
+
+void UParticleModuleSize::UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAContainer& Streams, int32 StartIndex, int32 EndIndex, FParticleSimulationContext& Context)
+{
+    if (!bUseSizeOverLife)
+        return;
+
+    const float* RelTime = Streams.GetStream(EParticleStream::RelativeTime);
+    const float* BaseX = Streams.GetStream(EParticleStream::BaseSizeX);
+    const float* BaseY = Streams.GetStream(EParticleStream::BaseSizeY);
+    const float* BaseZ = Streams.GetStream(EParticleStream::BaseSizeZ);
+    float* SizeX = Streams.GetStream(EParticleStream::SizeX);
+    float* SizeY = Streams.GetStream(EParticleStream::SizeY);
+    float* SizeZ = Streams.GetStream(EParticleStream::SizeZ);
+
+    // SizeOverLife(t) = Min + (Max - Min) * t, bUniformSize면 X 성분을 모든 축에 사용
+    const FVector MinValue = SizeOverLife.MinValue;
+    const FVector Slope = SizeOverLife.bUseRange ? SizeOverLife.MaxValue - SizeOverLife.MinValue : FVector::Zero();
+    const __m128 MinX = _mm_set1_ps(MinValue.X);
+    const __m128 MinY = _mm_set1_ps(bUniformSize ? MinValue.X : MinValue.Y);
+    const __m128 MinZ = _mm_set1_ps(bUniformSize ? MinValue.X : MinValue.Z);
+    const __m128 SlopeX = _mm_set1_ps(Slope.X);
+    const __m128 SlopeY = _mm_set1_ps(bUniformSize ? Slope.X : Slope.Y);
+    const __m128 SlopeZ = _mm_set1_ps(bUniformSize ? Slope.X : Slope.Z);
+
+    const int32 SimdEnd = FParticleSoAContainer::GetSimdCount(EndIndex);
+    for (int32 i = StartIndex; i < SimdEnd; i += 4)
+    {
+        const __m128 t = _mm_load_ps(RelTime + i);
+        _mm_store_ps(SizeX + i, _mm_mul_ps(_mm_load_ps(BaseX + i), _mm_add_ps(MinX, _mm_mul_ps(SlopeX, t))));
+        _mm_store_ps(SizeY + i, _mm_mul_ps(_mm_load_ps(BaseY + i), _mm_add_ps(MinY, _mm_mul_ps(SlopeY, t))));
+        _mm_store_ps(SizeZ + i, _mm_mul_ps(_mm_load_ps(BaseZ + i), _mm_add_ps(MinZ, _mm_mul_ps(SlopeZ, t))));
+    }
+}
@@ -2,6 +2,7 @@
 #include "ParticleModuleSizeMultiplyLife.h"
 #include "../ParticleEmitter.h"
 #include "../ParticleHelper.h"
+#include "../ParticleEmitterInstance.h"
 
 IMPLEMENT_CLASS(UParticleModuleSizeMultiplyLife)
 
@@ -65,3 +66,46 @@ void UParticleModuleSizeMultiplyLife::Update(FParticleEmitterInstance* Owner, in
     }
     END_UPDATE_LOOP;
 }
+
+void UParticleModuleSizeMultiplyLife::UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAContainer& Streams, int32 StartIndex, int32 EndIndex, FParticleSimulationContext& Context)
+{
+    const float* RelTime = Streams.GetStream(EParticleStream::RelativeTime);
+    const float* OneOverLife = Streams.GetStream(EParticleStream::OneOverMaxLifetime);
+    const float* BaseX = Streams.GetStream(EParticleStream::BaseSizeX);
+    const float* BaseY = Streams.GetStream(EParticleStream::BaseSizeY);
+    const float* BaseZ = Streams.GetStream(EParticleStream::BaseSizeZ);
+    float* SizeX = Streams.GetStream(EParticleStream::SizeX);
+    float* SizeY = Streams.GetStream(EParticleStream::SizeY);
+    float* SizeZ = Streams.GetStream(EParticleStream::SizeZ);
+
+    const __m128 One = _mm_set1_ps(1.0f);
+    const __m128 T1 = _mm_set1_ps(Point1Time);
+    const __m128 T2 = _mm_set1_ps(Point2Time);
+    const __m128 V1X = _mm_set1_ps(Point1Value.X);
+    const __m128 V1Y = _mm_set1_ps(Point1Value.Y);
+    const __m128 V1Z = _mm_set1_ps(Point1Value.Z);
+    const __m128 V2X = _mm_set1_ps(Point2Value.X);
+    const __m128 V2Y = _mm_set1_ps(Point2Value.Y);
+    const __m128 V2Z = _mm_set1_ps(Point2Value.Z);
+
+    // 꺼진 축은 BaseSize 그대로 (레인 마스크로 선택)
+    const __m128 AllBits = _mm_castsi128_ps(_mm_set1_epi32(-1));
+    const __m128 MaskX = bMultiplyX ? AllBits : _mm_setzero_ps();
+    const __m128 MaskY = bMultiplyY ? AllBits : _mm_setzero_ps();
+    const __m128 MaskZ = bMultiplyZ ? AllBits : _mm_setzero_ps();
+
+    const int32 SimdEnd = FParticleSoAContainer::GetSimdCount(EndIndex);
+    for (int32 i = StartIndex; i < SimdEnd; i += 4)
+    {
+        // 절대 시간 t = RelativeTime * (1 / OneOverMaxLifetime)
+        const __m128 Lifetime = _mm_div_ps(One, _mm_load_ps(OneOverLife + i));
+        const __m128 t = _mm_mul_ps(_mm_load_ps(RelTime + i), Lifetime);
+
+        const __m128 BX = _mm_load_ps(BaseX + i);
+        const __m128 BY = _mm_load_ps(BaseY + i);
+        const __m128 BZ = _mm_load_ps(BaseZ + i);
+        _mm_store_ps(SizeX + i, ParticleSelectPS(MaskX, _mm_mul_ps(BX, ParticleEvaluateTwoPointCurvePS(t, T1, V1X, T2, V2X)), BX));
+        _mm_store_ps(SizeY + i, ParticleSelectPS(MaskY, _mm_mul_ps(BY, ParticleEvaluateTwoPointCurvePS(t, T1, V1Y, T2, V2Y)), BY));
+        _mm_store_ps(SizeZ + i, ParticleSelectPS(MaskZ, _mm_mul_ps(BZ, ParticleEvaluateTwoPointCurvePS(t, T1, V1Z, T2, V2Z)), BZ));
+    }
+}
@@ -30,6 +30,9 @@ public:
 
     // Update에서 BaseSize에 Curve(t)를 곱해서 Size 애니메이션
     virtual void Update(FParticleEmitterInstance* Owner, int32 Offset, float DeltaTime) override;
+    // SoA 모드: Size = BaseSize * Curve(t)를 SIMD로 계산
+    virtual bool SupportsSoAUpdate() const override { return true; }
+    virtual void UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAContainer& Streams, int32 StartIndex, int32 EndIndex, FParticleSimulationContext& Context) override;
 
 private:
     // t (0~1)에 따라 3개 키프레임 사이를 선형 보간
@@ -78,7 +78,7 @@ float UParticleModuleSubUV::CalculateSubImageIndex(FParticleEmitterInstance* Own
     int32 NY = Required->SubImages_Vertical;
     int32 TotalFrames = NX * NY;
 
-    static int32 CalcLogCounter = 0;
+    static std::atomic<int32> CalcLogCounter{ 0 }; // 이미터가 여러 워커에서 동시에 돌 수 있음
     if (CalcLogCounter++ % 60 == 0)
     {
         // UE_LOG("SubUV Calculate: NX=%d, NY=%d, TotalFrames=%d", NX, NY, TotalFrames);
@@ -131,7 +131,7 @@ float UParticleModuleSubUV::CalculateSubImageIndex(FParticleEmitterInstance* Own
         // 0~1 범위를 0 ~ (TotalFrames-1) 범위로 스케일링
         Index = NormalizedIndex * (TotalFrames - 1);
 
-        static int32 LinearLogCounter = 0;
+        static std::atomic<int32> LinearLogCounter{ 0 };
         if (LinearLogCounter++ % 60 == 0)
         {
             // UE_LOG("SubUV Linear: t=%f, bUseRange=%d, MinVal=%f, NormalizedIndex=%f, Index=%f",
@@ -47,3 +47,47 @@ void UParticleModuleVelocity::Update(FParticleEmitterInstance* Owner, int32 Offs
     }
     END_UPDATE_LOOP;
 }
+
+void UParticleModuleVelocity::UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAContainer& Streams, int32 StartIndex, int32 EndIndex, FParticleSimulationContext& Context)
+{
+    const float DeltaTime = Context.DeltaTime;
+
+    float* PosX = Streams.GetStream(EParticleStream::LocationX);
+    float* PosY = Streams.GetStream(EParticleStream::LocationY);
+    float* PosZ = Streams.GetStream(EParticleStream::LocationZ);
+    float* OldX = Streams.GetStream(EParticleStream::OldLocationX);
+    float* OldY = Streams.GetStream(EParticleStream::OldLocationY);
+    float* OldZ = Streams.GetStream(EParticleStream::OldLocationZ);
+    float* VelX = Streams.GetStream(EParticleStream::VelocityX);
+    float* VelY = Streams.GetStream(EParticleStream::VelocityY);
+    float* VelZ = Streams.GetStream(EParticleStream::VelocityZ);
+
+    // 파티클마다 같은 값인 중력/감쇠 항은 루프 밖에서 한 번만 계산
+    const __m128 Dt = _mm_set1_ps(DeltaTime);
+    const __m128 GravityX = _mm_set1_ps(Gravity.X * DeltaTime);
+    const __m128 GravityY = _mm_set1_ps(Gravity.Y * DeltaTime);
+    const __m128 GravityZ = _mm_set1_ps(Gravity.Z * DeltaTime);
+    const __m128 DampingFactor = _mm_set1_ps(Damping > 0.0f ? FMath::Max(0.0f, 1.0f - Damping * DeltaTime) : 1.0f);
+
+    const int32 SimdEnd = FParticleSoAContainer::GetSimdCount(EndIndex);
+    for (int32 i = StartIndex; i < SimdEnd; i += 4)
+    {
+        const __m128 X = _mm_load_ps(PosX + i);
+        const __m128 Y = _mm_load_ps(PosY + i);
+        const __m128 Z = _mm_load_ps(PosZ + i);
+        _mm_store_ps(OldX + i, X);
+        _mm_store_ps(OldY + i, Y);
+        _mm_store_ps(OldZ + i, Z);
+
+        const __m128 VX = _mm_mul_ps(_mm_add_ps(_mm_load_ps(VelX + i), GravityX), DampingFactor);
+        const __m128 VY = _mm_mul_ps(_mm_add_ps(_mm_load_ps(VelY + i), GravityY), DampingFactor);
+        const __m128 VZ = _mm_mul_ps(_mm_add_ps(_mm_load_ps(VelZ + i), GravityZ), DampingFactor);
+        _mm_store_ps(VelX + i, VX);
+        _mm_store_ps(VelY + i, VY);
+        _mm_store_ps(VelZ + i, VZ);
+
+        _mm_store_ps(PosX + i, _mm_add_ps(X, _mm_mul_ps(VX, Dt)));
+        _mm_store_ps(PosY + i, _mm_add_ps(Y, _mm_mul_ps(VY, Dt)));
+        _mm_store_ps(PosZ + i, _mm_add_ps(Z, _mm_mul_ps(VZ, Dt)));
+    }
+}
@@ -0,0 +1,233 @@
+﻿#include "pch.h"
+#include "ParticleBenchmark.h"
+#include "ParticleSystem.h"
+#include "ParticleEmitter.h"
+#include "ParticleEmitterInstance.h"
+#include "ParticleLODLevel.h"
+#include "PlatformTime.h"
+#include "ResourceManager.h"
+#include "Async/ParticleSimulationContext.h"
+#include "Modules/ParticleModule.h"
+
+namespace
+{
+	struct FEmitterBenchResult
+	{
+		FParticleTickProfile Profile;
+		uint64 TickCycles = 0;
+		uint64 ParticleFrames = 0;   // 프레임마다 살아있던 파티클 수의 합 (ns/particle/frame의 분모)
+		uint64 Spawned = 0;
+		uint64 Killed = 0;
+		int32 PeakParticles = 0;
+		uint64 ParticleBytes = 0;    // ParticleData + Indices + InstanceData + SoA 스트림
+		bool bSoA = false;
+	};
+
+	/** LOD 0이 켜져 있는 이미터만 측정 (꺼진 LOD는 Tick이 매 프레임 경고만 남김) */
+	bool IsSimulatable(const UParticleEmitter* Emitter)
+	{
+		return Emitter && !Emitter->LODLevels.IsEmpty() && Emitter->LODLevels[0] && Emitter->LODLevels[0]->bEnabled;
+	}
+
+	double CyclesToNs(uint64 Cycles)
+	{
+		return FPlatformTime::ToMilliseconds(Cycles) * 1.0e6;
+	}
+
+	double PerParticleFrame(uint64 Cycles, uint64 ParticleFrames)
+	{
+		return ParticleFrames > 0 ? CyclesToNs(Cycles) / static_cast<double>(ParticleFrames) : 0.0;
+	}
+
+	/** 컴포넌트 없이 시뮬레이션에 필요한 값만 채운 컨텍스트 (원점, 항등 변환, 충돌체 없음) */
+	void InitSyntheticContext(FParticleSimulationContext& Context, float DeltaTime)
+	{
+		Context.DeltaTime = DeltaTime;
+		Context.RealTimeSeconds = 0.0f;
+		Context.ComponentLocation = FVector::Zero();
+		Context.ComponentRotation = FQuat::Identity();
+		Context.ComponentScale = FVector(1.0f, 1.0f, 1.0f);
+		Context.ComponentWorldMatrix = FMatrix::Identity();
+		Context.CameraLocation = FVector::Zero();
+		Context.CameraRotation = FQuat::Identity();
+		Context.bIsActive = true;
+		Context.bSuppressSpawning = false;
+		Context.CurrentLODIndex = 0;
+	}
+
+	uint64 GetParticleBytes(const FParticleEmitterInstance& Instance)
+	{
+		uint64 Bytes = static_cast<uint64>(Instance.MaxActiveParticles) * (Instance.ParticleStride + sizeof(uint16));
+		Bytes += static_cast<uint64>(Instance.InstancePayloadSize);
+		if (Instance.SoAData.IsAllocated())
+		{
+			Bytes += static_cast<uint64>(Instance.SoAData.Capacity) * static_cast<uint64>(EParticleStream::Count) * sizeof(float);
+		}
+		return Bytes;
+	}
+
+	/** 시스템 하나를 NumFrames 동안 시뮬레이션하고 이미터별 결과를 채운다 */
+	void RunSystem(UParticleSystem* System, int32 NumFrames, float DeltaTime, TArray<std::unique_ptr<FEmitterBenchResult>>& OutResults, uint64& OutPeakHeapDelta)
+	{
+		TArray<FParticleEmitterInstance*> Instances;
+		for (int32 i = 0; i < System->Emitters.Num(); i++)
+		{
+			UParticleEmitter* Emitter = System->Emitters[i];
+			if (!IsSimulatable(Emitter)) { continue; }
+
+			// 시드를 고정해 실행마다 같은 스폰 시퀀스로 비교
+			FParticleEmitterInstance* Instance = new FParticleEmitterInstance();
+			Instance->Init(Emitter, nullptr, 0x9E3779B9u + static_cast<uint32>(i));
+			Instances.Add(Instance);
+		}
+
+		// 프로파일은 atomic이라 옮길 수 없으므로 이미터마다 따로 할당
+		for (FParticleEmitterInstance* Instance : Instances)
+		{
+			OutResults.Emplace(std::make_unique<FEmitterBenchResult>());
+			Instance->Profile = &OutResults.Last()->Profile;
+		}
+
+		const uint64 HeapBaseline = FMemoryManager::TotalAllocationBytes.load(std::memory_order_relaxed);
+		OutPeakHeapDelta = 0;
+
+		FParticleSimulationContext Context;
+		InitSyntheticContext(Context, DeltaTime);
+
+		for (int32 Frame = 0; Frame < NumFrames; Frame++)
+		{
+			Context.RealTimeSeconds = static_cast<float>(Frame) * DeltaTime;
+			Context.EventData.clear();
+
+			for (int32 i = 0; i < Instances.Num(); i++)
+			{
+				FParticleEmitterInstance* Instance = Instances[i];
+				FEmitterBenchResult& Result = *OutResults[i];
+
+				const uint32 CounterBefore = Instance->ParticleCounter;
+				const int32 ActiveBefore = Instance->ActiveParticles;
+
+				const uint64 Start = FPlatformTime::Cycles64();
+				Instance->Tick(Context);
+				Result.TickCycles += FPlatformTime::Cycles64() - Start;
+
+				const uint64 NewlySpawned = Instance->ParticleCounter - CounterBefore;
+				Result.Spawned += NewlySpawned;
+				Result.Killed += static_cast<uint64>(ActiveBefore) + NewlySpawned - static_cast<uint64>(Instance->ActiveParticles);
+				Result.ParticleFrames += static_cast<uint64>(Instance->ActiveParticles);
+				Result.PeakParticles = FMath::Max(Result.PeakParticles, Instance->ActiveParticles);
+				Result.ParticleBytes = FMath::Max(Result.ParticleBytes, GetParticleBytes(*Instance));
+				Result.bSoA = Result.bSoA || Instance->bUseSoALayout;
+			}
+
+			// 전역 카운터라 다른 스레드 할당도 섞일 수 있음 (벤치마크 중엔 에디터가 멈춰 있으므로 근사치로 충분)
+			const uint64 HeapNow = FMemoryManager::TotalAllocationBytes.load(std::memory_order_relaxed);
+			if (HeapNow > HeapBaseline)
+			{
+				OutPeakHeapDelta = FMath::Max(OutPeakHeapDelta, HeapNow - HeapBaseline);
+			}
+		}
+
+		for (FParticleEmitterInstance* Instance : Instances)
+		{
+			Instance->Profile = nullptr;
+			Instance->FreeParticleMemory();
+			delete Instance;
+		}
+	}
+
+	void ReportSystem(const FString& Path, const TArray<UParticleEmitter*>& Emitters, const TArray<std::unique_ptr<FEmitterBenchResult>>& Results, int32 NumFrames, uint64 PeakHeapDelta)
+	{
+		uint64 TickCycles = 0;
+		uint64 ParticleFrames = 0;
+		uint64 Spawned = 0;
+		uint64 Killed = 0;
+		uint64 SpawnCycles = 0;
+		uint64 ParticleBytes = 0;
+		int32 PeakParticles = 0;
+		for (const std::unique_ptr<FEmitterBenchResult>& ResultPtr : Results)
+		{
+			const FEmitterBenchResult& Result = *ResultPtr;
+			TickCycles += Result.TickCycles;
+			ParticleFrames += Result.ParticleFrames;
+			Spawned += Result.Spawned;
+			Killed += Result.Killed;
+			SpawnCycles += Result.Profile.SpawnCycles.load();
+			ParticleBytes += Result.ParticleBytes;
+			PeakParticles += Result.PeakParticles;
+		}
+
+		const double TickMs = FPlatformTime::ToMilliseconds(TickCycles);
+		const double SpawnMs = FPlatformTime::ToMilliseconds(SpawnCycles);
+
+		char Buf[512];
+		std::snprintf(Buf, sizeof(Buf),
+			"[Particle Bench] %s | emitters=%d | tick %.3f ms/frame, %.2f ns/particle/frame | spawned %llu (%.2f M/s) killed %llu | peak %d particles, %.1f KB particle data, heap +%.1f KB\r\n",
+			Path.c_str(), Results.Num(),
+			NumFrames > 0 ? TickMs / NumFrames : 0.0, PerParticleFrame(TickCycles, ParticleFrames),
+			static_cast<unsigned long long>(Spawned), SpawnMs > 0.0 ? static_cast<double>(Spawned) / (SpawnMs * 1000.0) : 0.0,
+			static_cast<unsigned long long>(Killed),
+			PeakParticles, static_cast<double>(ParticleBytes) / 1024.0, static_cast<double>(PeakHeapDelta) / 1024.0);
+		UE_LOG(Buf);
+
+		int32 ResultIndex = 0;
+		for (UParticleEmitter* Emitter : Emitters)
+		{
+			if (!IsSimulatable(Emitter)) { continue; }
+			const FEmitterBenchResult& Result = *Results[ResultIndex++];
+
+			std::snprintf(Buf, sizeof(Buf),
+				"[Particle Bench]   %s (%s) peak %d | spawn %.1f ns/spawned | integrate+kill %.2f ns/p/f\r\n",
+				Emitter->GetName().c_str(), Result.bSoA ? "SoA" : "AoS", Result.PeakParticles,
+				Result.Spawned > 0 ? CyclesToNs(Result.Profile.SpawnCycles.load()) / static_cast<double>(Result.Spawned) : 0.0,
+				PerParticleFrame(Result.Profile.IntegrateCycles.load(), Result.ParticleFrames));
+			UE_LOG(Buf);
+
+			// LOD 0 기준 (벤치마크는 LOD를 바꾸지 않음)
+			const UParticleLODLevel* LOD = Emitter->LODLevels[0];
+			const int32 NumModules = FMath::Min(LOD->UpdateModules.Num(), FParticleTickProfile::MaxModules);
+			for (int32 m = 0; m < NumModules; m++)
+			{
+				const UParticleModule* Module = LOD->UpdateModules[m];
+				if (!Module || !Module->bEnabled) { continue; }
+
+				std::snprintf(Buf, sizeof(Buf), "[Particle Bench]     %-32s %8.2f ns/p/f\r\n",
+					Module->GetClass()->Name, PerParticleFrame(Result.Profile.ModuleCycles[m].load(), Result.ParticleFrames));
+				UE_LOG(Buf);
+			}
+		}
+	}
+}
+
+void FParticleBenchmark::Run(int32 NumFrames, float DeltaTime)
+{
+	// PreloadParticles가 Data/Particle에서 읽어 둔 에셋 중 파일에서 온 것만 (에디터에서 새로 만든 미저장 에셋 제외)
+	TArray<UParticleSystem*> Systems;
+	for (UParticleSystem* System : RESOURCE.GetAll<UParticleSystem>())
+	{
+		if (System && !System->GetFilePath().empty())
+		{
+			Systems.Add(System);
+		}
+	}
+	std::sort(Systems.begin(), Systems.end(), [](UParticleSystem* A, UParticleSystem* B) { return A->GetFilePath() < B->GetFilePath(); });
+
+	if (Systems.IsEmpty())
+	{
+		UE_LOG("[Particle Bench] no particle assets loaded (Data/Particle)\r\n");
+		return;
+	}
+
+	char Buf[256];
+	std::snprintf(Buf, sizeof(Buf), "[Particle Bench] %d systems, frames=%d, dt=%.4f (ns/p/f = ns per live particle per frame)\r\n",
+		Systems.Num(), NumFrames, DeltaTime);
+	UE_LOG(Buf);
+
+	for (UParticleSystem* System : Systems)
+	{
+		TArray<std::unique_ptr<FEmitterBenchResult>> Results;
+		uint64 PeakHeapDelta = 0;
+		RunSystem(System, NumFrames, DeltaTime, Results, PeakHeapDelta);
+		ReportSystem(System->GetFilePath(), System->Emitters, Results, NumFrames, PeakHeapDelta);
+	}
+}
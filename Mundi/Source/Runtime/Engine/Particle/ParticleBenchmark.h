@@ -0,0 +1,13 @@
+﻿#pragma once
+
+/**
+ * @brief 저장된 .particle 에셋(Data/Particle)으로 파티클 시뮬레이션만 돌리는 벤치마크
+ * - 컴포넌트/월드/렌더러 없이 FParticleEmitterInstance를 직접 만들고 합성 컨텍스트로 N프레임 Tick
+ * - 모듈별 ns/particle/frame, 스폰/킬 처리량, 최대 파티클 메모리를 측정
+ * - 콘솔 명령 "BENCH PARTICLES [Frames]"로 실행, 결과는 UE_LOG로 출력
+ */
+class FParticleBenchmark
+{
+public:
+	static void Run(int32 NumFrames = 600, float DeltaTime = 1.0f / 60.0f);
+};
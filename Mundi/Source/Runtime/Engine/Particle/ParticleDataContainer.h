@@ -1,4 +1,6 @@
 ﻿#pragma once
+#include <emmintrin.h>
+
 FORCEINLINE uint32 AlignUp(uint32 Value, uint32 Alignment)
 {
     return (Value + (Alignment - 1)) & ~(Alignment - 1);
@@ -46,3 +48,90 @@ struct FParticleDataContainer
         MemBlockSize = 0;
     }
 };
+
+// SoA 레이아웃에서 파티클 속성 하나가 차지하는 float 스트림
+enum class EParticleStream : uint8
+{
+    LocationX, LocationY, LocationZ,
+    OldLocationX, OldLocationY, OldLocationZ,
+    VelocityX, VelocityY, VelocityZ,
+    SizeX, SizeY, SizeZ,
+    BaseSizeX, BaseSizeY, BaseSizeZ,
+    ColorR, ColorG, ColorB, ColorA,
+    RotationX, RotationY, RotationZ,
+    RotationRateX, RotationRateY, RotationRateZ,
+    RelativeTime,
+    OneOverMaxLifetime,
+
+    Count
+};
+
+// 시뮬레이션 스레드용 SoA 스트림 블록 (opt-in)
+// 업데이트가 자주 건드리는 속성만 속성별 연속 배열로 분리하고, 나머지(Base 값, 플래그, 페이로드)는 AoS에 남긴다.
+// 스트림 용량은 16의 배수라 모든 스트림이 64바이트 정렬되고, SSE 루프는 꼬리 처리 없이 4개씩 돈다.
+struct FParticleSoAContainer
+{
+    int32 Capacity = 0; // 스트림 하나당 float 개수
+    float* RawBlock = nullptr;
+
+    void Allocate(int32 InMaxParticles)
+    {
+        Free();
+
+        constexpr uint32 Alignment = 64;
+        Capacity = static_cast<int32>(AlignUp(static_cast<uint32>(InMaxParticles), Alignment / sizeof(float)));
+        const SIZE_T BlockSize = static_cast<SIZE_T>(Capacity) * sizeof(float) * static_cast<SIZE_T>(EParticleStream::Count);
+
+        RawBlock = static_cast<float*>(FMemoryManager::Allocate(BlockSize, Alignment));
+        std::memset(RawBlock, 0, BlockSize);
+    }
+
+    void Free()
+    {
+        if (RawBlock)
+        {
+            FMemoryManager::Deallocate(RawBlock);
+            RawBlock = nullptr;
+        }
+        Capacity = 0;
+    }
+
+    bool IsAllocated() const { return RawBlock != nullptr; }
+
+    FORCEINLINE float* GetStream(EParticleStream Stream) const
+    {
+        return RawBlock + static_cast<int32>(Stream) * Capacity;
+    }
+
+    // Swap & Pop 용 - 모든 스트림에서 Src 칸을 Dest 칸으로 복사
+    void CopyElement(int32 DestIndex, int32 SrcIndex)
+    {
+        for (int32 s = 0; s < static_cast<int32>(EParticleStream::Count); ++s)
+        {
+            float* Stream = RawBlock + s * Capacity;
+            Stream[DestIndex] = Stream[SrcIndex];
+        }
+    }
+
+    // 4개 단위로 올림한 처리 개수 (꼬리 레인은 죽은 슬롯이라 계산해도 무해)
+    static FORCEINLINE int32 GetSimdCount(int32 NumParticles)
+    {
+        return (NumParticles + 3) & ~3;
+    }
+};
+
+// Mask가 선 레인은 A, 아니면 B (SSE2에는 blendv가 없으므로 and/andnot 조합)
+FORCEINLINE __m128 ParticleSelectPS(__m128 Mask, __m128 A, __m128 B)
+{
+    return _mm_or_ps(_mm_and_ps(Mask, A), _mm_andnot_ps(Mask, B));
+}
+
+// 2-point 커브 평가: t < T1 이면 V1, t >= T2 이면 V2, 그 사이는 선형 보간 (스칼라 EvaluateXXXCurve와 동일한 분기)
+FORCEINLINE __m128 ParticleEvaluateTwoPointCurvePS(__m128 t, __m128 T1, __m128 V1, __m128 T2, __m128 V2)
+{
+    const __m128 Alpha = _mm_div_ps(_mm_sub_ps(t, T1), _mm_sub_ps(T2, T1));
+    __m128 Result = _mm_add_ps(V1, _mm_mul_ps(_mm_sub_ps(V2, V1), Alpha));
+    Result = ParticleSelectPS(_mm_cmpge_ps(t, T2), V2, Result);
+    Result = ParticleSelectPS(_mm_cmplt_ps(t, T1), V1, Result);
+    return Result;
+}
@@ -4,6 +4,7 @@
 #include "ParticleLODLevel.h"
 #include "ParticleSystemComponent.h"
 #include "PlatformTime.h"
+#include "ParallelFor.h"
 #include "Modules/ParticleModuleRequired.h"
 #include "Modules/ParticleModuleSpawn.h"
 #include "Modules/ParticleModuleSubUV.h"
@@ -11,7 +12,7 @@
 #include "Modules/ParticleModuleBeam.h"
 #include "Modules/ParticleModuleRibbon.h"
 
-void FParticleEmitterInstance::Init(UParticleEmitter* InTemplate, UParticleSystemComponent* InComponent)
+void FParticleEmitterInstance::Init(UParticleEmitter* InTemplate, UParticleSystemComponent* InComponent, uint32 RandomSeed)
 {
     Template = InTemplate;
     Component = InComponent;
@@ -50,8 +51,7 @@ void FParticleEmitterInstance::Init(UParticleEmitter* InTemplate, UParticleSyste
     InitializeParticleMemory();
     InitializeRibbonState();
 
-    std::random_device Rd;
-    InitRandom(Rd());
+    InitRandom(RandomSeed);
 }
 
 void FParticleEmitterInstance::InitializeParticleMemory()
@@ -127,6 +127,10 @@ void FParticleEmitterInstance::FreeParticleMemory()
         InstanceData = nullptr;
     }
 
+    // SoA 스트림은 다음 Tick의 ApplyLayoutMode에서 새 용량으로 다시 잡힌다
+    SoAData.Free();
+    bUseSoALayout = false;
+
     ActiveParticles = 0;
     MaxActiveParticles = 0;  // ← 여기서 리셋됨!
 }
@@ -192,7 +196,7 @@ void FParticleEmitterInstance::SpawnParticles(int32 Count, float StartTime, floa
 
         if (CurrentLODLevel)
         {
-            TArray<UParticleModule*> SpawnModules = CurrentLODLevel->SpawnModules;
+            const TArray<UParticleModule*>& SpawnModules = CurrentLODLevel->SpawnModules;
             for (int32 i = 0; i < SpawnModules.Num(); i++)
             {
                 UParticleModule* Module = SpawnModules[i];
@@ -257,6 +261,12 @@ void FParticleEmitterInstance::SpawnParticles(int32 Count, float StartTime, floa
             AttachRibbonParticle(NewParticleIndex, TrailPayload);
         }
 
+        // 스폰 모듈은 AoS 레코드에 값을 쓰므로, SoA 모드면 핫 필드를 스트림으로 옮긴다
+        if (bUseSoALayout)
+        {
+            StoreParticleToSoA(NewParticleIndex, *Particle);
+        }
+
         ParticleIndices[NewParticleIndex] = NewParticleIndex;
         ActiveParticles++;
         ParticleCounter++;
@@ -283,6 +293,11 @@ void FParticleEmitterInstance::KillParticle(int32 Index)
         DECLARE_PARTICLE_PTR(Src, ParticleData, ParticleStride, LastIndex)
         memcpy(Dest, Src, ParticleStride);
 
+        if (bUseSoALayout)
+        {
+            SoAData.CopyElement(Index, LastIndex);
+        }
+
         if (bHasRibbonTrails)
         {
             RemapRibbonParticleIndex(LastIndex, Index);
@@ -312,6 +327,8 @@ void FParticleEmitterInstance::Tick(FParticleSimulationContext& Context)
         return;
     }
 
+    ApplyLayoutMode();
+
     // ============================================================
     // Spawn
     // ============================================================
@@ -320,6 +337,7 @@ void FParticleEmitterInstance::Tick(FParticleSimulationContext& Context)
                                 && LoopCount >= CachedRequiredModule->EmitterLoops;
 
     float RandomValue = GetRandomFloat();
+    const uint64 SpawnStartCycles = Profile ? FPlatformTime::Cycles64() : 0;
 
     // 아직 안 끝났을 때만 스폰 시도
     if (!bEmitterFinished && !Context.bSuppressSpawning)
@@ -363,42 +381,66 @@ void FParticleEmitterInstance::Tick(FParticleSimulationContext& Context)
             }
         }
     }
+
+    if (Profile)
+    {
+        Profile->SpawnCycles += FPlatformTime::Cycles64() - SpawnStartCycles;
+    }
     
-    // ============================================================
-    // Time Update & Kill
-    // ============================================================
-    for (int32 i = 0; i < ActiveParticles; i++)
+    if (bUseSoALayout)
     {
-        DECLARE_PARTICLE_PTR(Particle, ParticleData, ParticleStride, i)
+        TickSoA(Context);
+    }
+    else
+    {
+        // ============================================================
+        // Time Update & Kill
+        // ============================================================
+        const uint64 IntegrateStartCycles = Profile ? FPlatformTime::Cycles64() : 0;
+        for (int32 i = 0; i < ActiveParticles; i++)
+        {
+            DECLARE_PARTICLE_PTR(Particle, ParticleData, ParticleStride, i)
+
+            Particle->OldLocation = Particle->Location;
+            Particle->Location += Particle->Velocity * Context.DeltaTime;
+
+            if (Particle->OneOverMaxLifetime > 0.0f)
+            {
+                Particle->RelativeTime += Particle->OneOverMaxLifetime * Context.DeltaTime;
+            }
 
-        Particle->OldLocation = Particle->Location;
-        Particle->Location += Particle->Velocity * Context.DeltaTime;
+            if (Particle->RelativeTime >= 1.0f)
+            {
+                KillParticle(i);
+                i--; // Swap & Pop 인덱스 보정
+            }
+        }
 
-        if (Particle->OneOverMaxLifetime > 0.0f)
+        if (Profile)
         {
-            Particle->RelativeTime += Particle->OneOverMaxLifetime * Context.DeltaTime;
+            Profile->IntegrateCycles += FPlatformTime::Cycles64() - IntegrateStartCycles;
         }
 
-        if (Particle->RelativeTime >= 1.0f)
+        // ============================================================
+        // Module Update
+        // ============================================================
+        if (bHasRibbonTrails)
         {
-            KillParticle(i);
-            i--; // Swap & Pop 인덱스 보정
+            UpdateRibbonTrailDistances();
         }
-    }
-    
-    // ============================================================
-    // Module Update
-    // ============================================================
-    if (bHasRibbonTrails)
-    {
-        UpdateRibbonTrailDistances();
-    }
 
-    for (int32 i = 0; i < CurrentLODLevel->UpdateModules.Num(); i++)
-    {
-        UParticleModule* Module = CurrentLODLevel->UpdateModules[i];
-        if (!Module || !Module->bEnabled) { continue; }
-        Module->UpdateAsync(this, Module->PayloadOffset, Context);
+        for (int32 i = 0; i < CurrentLODLevel->UpdateModules.Num(); i++)
+        {
+            UParticleModule* Module = CurrentLODLevel->UpdateModules[i];
+            if (!Module || !Module->bEnabled) { continue; }
+
+            const uint64 ModuleStartCycles = Profile ? FPlatformTime::Cycles64() : 0;
+            Module->UpdateAsync(this, Module->PayloadOffset, Context);
+            if (Profile)
+            {
+                Profile->ModuleCycles[FMath::Min(i, FParticleTickProfile::MaxModules - 1)] += FPlatformTime::Cycles64() - ModuleStartCycles;
+            }
+        }
     }
 
     // ============================================================
@@ -482,6 +524,213 @@ void FParticleEmitterInstance::UpdateModuleCache()
         RibbonPayloadOffset = -1;
         CachedRibbonModule = nullptr;
     }
+
+    // SoA 모드 조건: 에셋이 opt-in 했고, 리본/빔처럼 AoS 링크/페이로드에 기대는 타입이 아니며,
+    // 켜져 있는 Update 모듈이 전부 SoA 커널을 가지고 있어야 한다
+    bWantsSoALayout = CachedRequiredModule && CachedRequiredModule->bUseSoALayout &&
+        (Template->RenderType == EParticleType::Sprite || Template->RenderType == EParticleType::Mesh);
+    if (bWantsSoALayout)
+    {
+        for (UParticleModule* Module : CurrentLODLevel->UpdateModules)
+        {
+            if (Module && Module->bEnabled && !Module->SupportsSoAUpdate())
+            {
+                bWantsSoALayout = false;
+                break;
+            }
+        }
+    }
+}
+
+void FParticleEmitterInstance::ApplyLayoutMode()
+{
+    if (bWantsSoALayout == bUseSoALayout)
+    {
+        return;
+    }
+
+    if (bWantsSoALayout)
+    {
+        if (!SoAData.IsAllocated() || SoAData.Capacity < MaxActiveParticles)
+        {
+            SoAData.Allocate(MaxActiveParticles);
+        }
+
+        for (int32 i = 0; i < ActiveParticles; i++)
+        {
+            DECLARE_PARTICLE_CONST(Particle, ParticleData, ParticleStride, i)
+            StoreParticleToSoA(i, Particle);
+        }
+    }
+    else
+    {
+        // 에디터에서 모듈을 바꿔 SoA 조건이 깨진 경우: 스트림 값을 AoS로 되돌린다
+        for (int32 i = 0; i < ActiveParticles; i++)
+        {
+            DECLARE_PARTICLE(Particle, ParticleData, ParticleStride, i)
+            LoadParticleFromSoA(i, Particle);
+        }
+    }
+
+    bUseSoALayout = bWantsSoALayout;
+}
+
+void FParticleEmitterInstance::StoreParticleToSoA(int32 Index, const FBaseParticle& Particle)
+{
+    const FParticleSoAContainer& S = SoAData;
+    S.GetStream(EParticleStream::LocationX)[Index] = Particle.Location.X;
+    S.GetStream(EParticleStream::LocationY)[Index] = Particle.Location.Y;
+    S.GetStream(EParticleStream::LocationZ)[Index] = Particle.Location.Z;
+    S.GetStream(EParticleStream::OldLocationX)[Index] = Particle.OldLocation.X;
+    S.GetStream(EParticleStream::OldLocationY)[Index] = Particle.OldLocation.Y;
+    S.GetStream(EParticleStream::OldLocationZ)[Index] = Particle.OldLocation.Z;
+    S.GetStream(EParticleStream::VelocityX)[Index] = Particle.Velocity.X;
+    S.GetStream(EParticleStream::VelocityY)[Index] = Particle.Velocity.Y;
+    S.GetStream(EParticleStream::VelocityZ)[Index] = Particle.Velocity.Z;
+    S.GetStream(EParticleStream::SizeX)[Index] = Particle.Size.X;
+    S.GetStream(EParticleStream::SizeY)[Index] = Particle.Size.Y;
+    S.GetStream(EParticleStream::SizeZ)[Index] = Particle.Size.Z;
+    S.GetStream(EParticleStream::BaseSizeX)[Index] = Particle.BaseSize.X;
+    S.GetStream(EParticleStream::BaseSizeY)[Index] = Particle.BaseSize.Y;
+    S.GetStream(EParticleStream::BaseSizeZ)[Index] = Particle.BaseSize.Z;
+    S.GetStream(EParticleStream::ColorR)[Index] = Particle.Color.R;
+    S.GetStream(EParticleStream::ColorG)[Index] = Particle.Color.G;
+    S.GetStream(EParticleStream::ColorB)[Index] = Particle.Color.B;
+    S.GetStream(EParticleStream::ColorA)[Index] = Particle.Color.A;
+    S.GetStream(EParticleStream::RotationX)[Index] = Particle.Rotation.X;
+    S.GetStream(EParticleStream::RotationY)[Index] = Particle.Rotation.Y;
+    S.GetStream(EParticleStream::RotationZ)[Index] = Particle.Rotation.Z;
+    S.GetStream(EParticleStream::RotationRateX)[Index] = Particle.RotationRate.X;
+    S.GetStream(EParticleStream::RotationRateY)[Index] = Particle.RotationRate.Y;
+    S.GetStream(EParticleStream::RotationRateZ)[Index] = Particle.RotationRate.Z;
+    S.GetStream(EParticleStream::RelativeTime)[Index] = Particle.RelativeTime;
+    S.GetStream(EParticleStream::OneOverMaxLifetime)[Index] = Particle.OneOverMaxLifetime;
+}
+
+void FParticleEmitterInstance::LoadParticleFromSoA(int32 Index, FBaseParticle& OutParticle) const
+{
+    const FParticleSoAContainer& S = SoAData;
+    OutParticle.Location = FVector(S.GetStream(EParticleStream::LocationX)[Index],
+        S.GetStream(EParticleStream::LocationY)[Index], S.GetStream(EParticleStream::LocationZ)[Index]);
+    OutParticle.OldLocation = FVector(S.GetStream(EParticleStream::OldLocationX)[Index],
+        S.GetStream(EParticleStream::OldLocationY)[Index], S.GetStream(EParticleStream::OldLocationZ)[Index]);
+    OutParticle.Velocity = FVector(S.GetStream(EParticleStream::VelocityX)[Index],
+        S.GetStream(EParticleStream::VelocityY)[Index], S.GetStream(EParticleStream::VelocityZ)[Index]);
+    OutParticle.Size = FVector(S.GetStream(EParticleStream::SizeX)[Index],
+        S.GetStream(EParticleStream::SizeY)[Index], S.GetStream(EParticleStream::SizeZ)[Index]);
+    OutParticle.BaseSize = FVector(S.GetStream(EParticleStream::BaseSizeX)[Index],
+        S.GetStream(EParticleStream::BaseSizeY)[Index], S.GetStream(EParticleStream::BaseSizeZ)[Index]);
+    OutParticle.Color = FLinearColor(S.GetStream(EParticleStream::ColorR)[Index], S.GetStream(EParticleStream::ColorG)[Index],
+        S.GetStream(EParticleStream::ColorB)[Index], S.GetStream(EParticleStream::ColorA)[Index]);
+    OutParticle.Rotation = FVector(S.GetStream(EParticleStream::RotationX)[Index],
+        S.GetStream(EParticleStream::RotationY)[Index], S.GetStream(EParticleStream::RotationZ)[Index]);
+    OutParticle.RotationRate = FVector(S.GetStream(EParticleStream::RotationRateX)[Index],
+        S.GetStream(EParticleStream::RotationRateY)[Index], S.GetStream(EParticleStream::RotationRateZ)[Index]);
+    OutParticle.RelativeTime = S.GetStream(EParticleStream::RelativeTime)[Index];
+    OutParticle.OneOverMaxLifetime = S.GetStream(EParticleStream::OneOverMaxLifetime)[Index];
+}
+
+void FParticleEmitterInstance::TickSoA(FParticleSimulationContext& Context)
+{
+    // SoA 모듈은 파티클끼리 독립적이라 (적분 -> 모듈 업데이트)를 청크 단위로 묶어 돌리고, Kill은 마지막에 한 번만 한다.
+    // Kill 대상은 RelativeTime만으로 정해지고 SoA 모듈은 RelativeTime을 바꾸지 않으므로
+    // Kill을 모듈 업데이트 앞에 두는 AoS 경로와 살아남는 파티클의 결과/순서가 같다.
+    const TArray<UParticleModule*>& UpdateModules = CurrentLODLevel->UpdateModules;
+    auto UpdateChunk = [this, &UpdateModules, &Context](int32 ChunkIndex)
+        {
+            const int32 StartIndex = ChunkIndex * SoAChunkSize;
+            const int32 EndIndex = FMath::Min(StartIndex + SoAChunkSize, ActiveParticles);
+
+            if (!Profile)
+            {
+                IntegrateSoAChunk(StartIndex, EndIndex, Context.DeltaTime);
+                for (UParticleModule* Module : UpdateModules)
+                {
+                    if (!Module || !Module->bEnabled) { continue; }
+                    Module->UpdateSoA(this, SoAData, StartIndex, EndIndex, Context);
+                }
+                return;
+            }
+
+            // 벤치마크 측정 경로: 단계마다 사이클을 재서 청크 합산
+            uint64 Cycles = FPlatformTime::Cycles64();
+            IntegrateSoAChunk(StartIndex, EndIndex, Context.DeltaTime);
+            uint64 Now = FPlatformTime::Cycles64();
+            Profile->IntegrateCycles += Now - Cycles;
+            for (int32 i = 0; i < UpdateModules.Num(); i++)
+            {
+                UParticleModule* Module = UpdateModules[i];
+                if (!Module || !Module->bEnabled) { continue; }
+                Cycles = Now;
+                Module->UpdateSoA(this, SoAData, StartIndex, EndIndex, Context);
+                Now = FPlatformTime::Cycles64();
+                Profile->ModuleCycles[FMath::Min(i, FParticleTickProfile::MaxModules - 1)] += Now - Cycles;
+            }
+        };
+
+    const int32 NumChunks = (ActiveParticles + SoAChunkSize - 1) / SoAChunkSize;
+    if (NumChunks > 1)
+    {
+        // 청크마다 태스크가 되어 놀고 있는 워커가 훔쳐 감
+        ParallelFor(NumChunks, UpdateChunk);
+    }
+    else if (NumChunks == 1)
+    {
+        UpdateChunk(0);
+    }
+
+    // Kill은 스트림 하나만 훑는다 (Swap & Pop으로 당겨온 파티클도 이미 갱신된 상태)
+    const uint64 KillStartCycles = Profile ? FPlatformTime::Cycles64() : 0;
+    const float* RelTime = SoAData.GetStream(EParticleStream::RelativeTime);
+    for (int32 i = 0; i < ActiveParticles; i++)
+    {
+        if (RelTime[i] >= 1.0f)
+        {
+            KillParticle(i);
+            i--; // Swap & Pop 인덱스 보정
+        }
+    }
+
+    if (Profile)
+    {
+        Profile->IntegrateCycles += FPlatformTime::Cycles64() - KillStartCycles;
+    }
+}
+
+void FParticleEmitterInstance::IntegrateSoAChunk(int32 StartIndex, int32 EndIndex, float DeltaTime)
+{
+    float* PosX = SoAData.GetStream(EParticleStream::LocationX);
+    float* PosY = SoAData.GetStream(EParticleStream::LocationY);
+    float* PosZ = SoAData.GetStream(EParticleStream::LocationZ);
+    float* OldX = SoAData.GetStream(EParticleStream::OldLocationX);
+    float* OldY = SoAData.GetStream(EParticleStream::OldLocationY);
+    float* OldZ = SoAData.GetStream(EParticleStream::OldLocationZ);
+    const float* VelX = SoAData.GetStream(EParticleStream::VelocityX);
+    const float* VelY = SoAData.GetStream(EParticleStream::VelocityY);
+    const float* VelZ = SoAData.GetStream(EParticleStream::VelocityZ);
+    float* RelTime = SoAData.GetStream(EParticleStream::RelativeTime);
+    const float* OneOverLife = SoAData.GetStream(EParticleStream::OneOverMaxLifetime);
+
+    const __m128 Dt = _mm_set1_ps(DeltaTime);
+    const __m128 Zero = _mm_setzero_ps();
+    const int32 SimdEnd = FParticleSoAContainer::GetSimdCount(EndIndex);
+    for (int32 i = StartIndex; i < SimdEnd; i += 4)
+    {
+        const __m128 X = _mm_load_ps(PosX + i);
+        const __m128 Y = _mm_load_ps(PosY + i);
+        const __m128 Z = _mm_load_ps(PosZ + i);
+        _mm_store_ps(OldX + i, X);
+        _mm_store_ps(OldY + i, Y);
+        _mm_store_ps(OldZ + i, Z);
+        _mm_store_ps(PosX + i, _mm_add_ps(X, _mm_mul_ps(_mm_load_ps(VelX + i), Dt)));
+        _mm_store_ps(PosY + i, _mm_add_ps(Y, _mm_mul_ps(_mm_load_ps(VelY + i), Dt)));
+        _mm_store_ps(PosZ + i, _mm_add_ps(Z, _mm_mul_ps(_mm_load_ps(VelZ + i), Dt)));
+
+        // OneOverMaxLifetime > 0 인 레인만 나이 증가
+        const __m128 Rate = _mm_load_ps(OneOverLife + i);
+        const __m128 Step = _mm_and_ps(_mm_cmpgt_ps(Rate, Zero), _mm_mul_ps(Rate, Dt));
+        _mm_store_ps(RelTime + i, _mm_add_ps(_mm_load_ps(RelTime + i), Step));
+    }
 }
 
 FDynamicEmitterDataBase* FParticleEmitterInstance::CreateDynamicData()
@@ -593,6 +842,16 @@ void FParticleEmitterInstance::BuildReplayData(FDynamicEmitterReplayDataBase& Ou
         );
     }
 
+    // SoA 모드면 AoS 사본의 핫 필드가 낡았으므로 스트림 값으로 덮어쓴다 (렌더러는 FBaseParticle만 읽음)
+    if (bUseSoALayout)
+    {
+        for (int32 i = 0; i < ActiveParticles; i++)
+        {
+            DECLARE_PARTICLE(Particle, OutData.DataContainer.ParticleData, ParticleStride, i)
+            LoadParticleFromSoA(i, Particle);
+        }
+    }
+
     // 타입별 추가 필드 세팅
      // 3) 타입별 추가 필드 세팅
     switch (OutData.EmitterType)
@@ -1,6 +1,8 @@
 ﻿#pragma once
+#include <atomic>
 #include <random>
 #include "ParticleEmitter.h"
+#include "ParticleDataContainer.h"
 
 class UParticleSystemComponent;
 class UParticleModuleRequired;
@@ -9,6 +11,22 @@ struct FBaseParticle;
 struct FDynamicEmitterReplayDataBase;
 struct FParticleSimulationContext;
 
+/**
+ * Tick 구간별 누적 사이클 (FParticleBenchmark가 연결, 평소엔 nullptr라 측정 비용 없음)
+ * SoA 청크는 여러 워커에서 동시에 더하므로 atomic, 값은 스레드 합산 CPU 시간이다.
+ */
+struct FParticleTickProfile
+{
+    static constexpr int32 MaxModules = 32;
+
+    /** Spawn 모듈 포함 SpawnParticles 전체 */
+    std::atomic<uint64> SpawnCycles{ 0 };
+    /** Location/RelativeTime 적분 + Kill */
+    std::atomic<uint64> IntegrateCycles{ 0 };
+    /** CurrentLODLevel->UpdateModules 인덱스별 (MaxModules를 넘는 모듈은 마지막 칸에 합산) */
+    std::atomic<uint64> ModuleCycles[MaxModules] = {};
+};
+
 // 런타임 Emitter Instance
 struct FParticleEmitterInstance
 {
@@ -32,6 +50,17 @@ struct FParticleEmitterInstance
     /** InstanceData 배열의 크기 */
     int32 InstancePayloadSize = 0;
     
+    /**
+     * SoA 스트림 (opt-in, Required->bUseSoALayout)
+     * SoA 모드에서는 스트림이 Location/Velocity/Size/Color/Rotation/RelativeTime의 원본이고,
+     * ParticleData 쪽 같은 필드는 BuildReplayData에서 렌더용으로 다시 채워진다.
+     */
+    FParticleSoAContainer SoAData;
+    /** 현재 SoA 모드로 시뮬레이션 중인지 */
+    bool bUseSoALayout = false;
+    /** 현재 LOD 구성이 SoA 모드를 허용하는지 (UpdateModuleCache에서 갱신) */
+    bool bWantsSoALayout = false;
+
     /** 추가 페이로드의 시작 오프셋 */
     int32 PayloadOffset = 0;
     /** 기본 파티클 하나의 실제 크기 (패딩 제외) */
@@ -65,6 +94,9 @@ struct FParticleEmitterInstance
 
     /** 랜덤 생성기 */
     std::mt19937 RandomStream;
+
+    /** 벤치마크 측정용 (nullptr이면 측정 안 함) */
+    FParticleTickProfile* Profile = nullptr;
     
     /** 필수 모듈 캐싱(LOD에 따라 바뀜) */
     UParticleModuleRequired* CachedRequiredModule;
@@ -73,8 +105,8 @@ struct FParticleEmitterInstance
     // ============================================================
     // 메서드
     // ============================================================
-    /** 초기화 */
-    void Init(UParticleEmitter* InTemplate, UParticleSystemComponent* InComponent);
+    /** 초기화 (RandomSeed는 InitRandom으로 전달) */
+    void Init(UParticleEmitter* InTemplate, UParticleSystemComponent* InComponent, uint32 RandomSeed);
     
     /** 메모리 초기화 */
     void InitializeParticleMemory();
@@ -102,6 +134,20 @@ struct FParticleEmitterInstance
     /** LOD에 따른 모듈 캐싱 업데이트 */
     void UpdateModuleCache();
 
+    /** bWantsSoALayout에 맞춰 AoS <-> SoA 전환 (살아있는 파티클 데이터 이전) */
+    void ApplyLayoutMode();
+    /** AoS 레코드의 핫 필드를 SoA 스트림 Index 칸에 기록 */
+    void StoreParticleToSoA(int32 Index, const FBaseParticle& Particle);
+    /** SoA 스트림 Index 칸을 AoS 레코드 핫 필드로 복원 */
+    void LoadParticleFromSoA(int32 Index, FBaseParticle& OutParticle) const;
+    /** SoA 모드 Time Update + Module Update + Kill (큰 Emitter는 청크 단위로 병렬 처리) */
+    void TickSoA(FParticleSimulationContext& Context);
+    /** SoA 모드 [StartIndex, EndIndex) 구간의 Location/RelativeTime 적분 */
+    void IntegrateSoAChunk(int32 StartIndex, int32 EndIndex, float DeltaTime);
+
+    /** 이 수를 넘는 SoA Emitter는 청크마다 별도 태스크로 업데이트 (4의 배수) */
+    static constexpr int32 SoAChunkSize = 4096;
+
     struct FDynamicEmitterDataBase* CreateDynamicData();
     void BuildReplayData(FDynamicEmitterReplayDataBase& OutData);
 
@@ -116,6 +162,7 @@ struct FParticleEmitterInstance
 
     EParticleType GetDynamicType() const { return Template->RenderType; };
 
+    /** RandomStream 시드 설정 (같은 시드면 스레드 배치와 무관하게 같은 결과) */
     void InitRandom(uint32 Seed);
 
     float GetRandomFloat();
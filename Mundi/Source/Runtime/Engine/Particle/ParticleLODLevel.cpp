@@ -117,6 +117,7 @@ void UParticleLODLevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
                 FJsonSerializer::ReadFloat(ReqJson, "SpawnRateBase", Req->SpawnRateBase);
                 
                 FJsonSerializer::ReadBool(ReqJson, "bUseLocalSpace", Req->bUseLocalSpace);
+                FJsonSerializer::ReadBool(ReqJson, "bUseSoALayout", Req->bUseSoALayout, false, false);
 
                 int32 AlignVal = 0, SortVal = 0;
                 if (FJsonSerializer::ReadInt32(ReqJson, "ScreenAlignment", AlignVal)) Req->ScreenAlignment = (EScreenAlignment)AlignVal;
@@ -269,6 +270,7 @@ void UParticleLODLevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
             RequiredJson["EmitterLoops"] = RequiredModule->EmitterLoops;
             RequiredJson["SpawnRateBase"] = RequiredModule->SpawnRateBase;
             RequiredJson["bUseLocalSpace"] = RequiredModule->bUseLocalSpace;
+            RequiredJson["bUseSoALayout"] = RequiredModule->bUseSoALayout;
             RequiredJson["ScreenAlignment"] = static_cast<int>(RequiredModule->ScreenAlignment);
             RequiredJson["SortMode"] = static_cast<int>(RequiredModule->SortMode);
             RequiredJson["BlendMode"] = static_cast<int>(RequiredModule->MaterialBlendMode);
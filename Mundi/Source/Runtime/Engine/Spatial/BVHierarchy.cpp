@@ -1,9 +1,9 @@
 ﻿#include "pch.h"
 #include <algorithm>
+#include <bit>
 #include <cfloat>
 #include <cmath>
 #include <functional>
-#include <queue>
 #include "BVHierarchy.h"
 #include "Actor.h"
 #include "Collision.h"
@@ -11,6 +11,10 @@
 #include "OBB.h"
 #include "Frustum.h"
 #include "Picking.h" // FRay
+#include "BoundingSphere.h"
+#include "PlatformTime.h"
+#include "SpatialQueryScratch.h"
+#include "ParallelFor.h"
 
 #include "StaticMeshComponent.h"
 
@@ -45,6 +49,163 @@ namespace {
         outTMax = tmax;
         return true;
     }
+
+    inline bool IsSameBounds(const FAABB& A, const FAABB& B)
+    {
+        return A.Min.X == B.Min.X && A.Min.Y == B.Min.Y && A.Min.Z == B.Min.Z
+            && A.Max.X == B.Max.X && A.Max.Y == B.Max.Y && A.Max.Z == B.Max.Z;
+    }
+
+    // SAH 비용 상수 (노드 순회 1회 / 컴포넌트 AABB 교차 1회의 상대 비용)
+    constexpr float SAHTraversalCost = 1.0f;
+    constexpr float SAHIntersectCost = 1.0f;
+    // Refit 누적으로 SAH 비용이 빌드 직후 대비 이 배율을 넘으면 재빌드
+    constexpr float RebuildSAHRatio = 1.5f;
+    // Remove로 비워진 슬롯이 이 비율을 넘으면 재빌드
+    constexpr float RebuildRemovedSlotRatio = 0.25f;
+
+    // === BVH4 레인 검사 (자식 4개를 SSE 한 번에) ===
+    constexpr float BVH4EmptyLaneExtent = 1e30f;
+    // BVH4 깊이는 이진 트리 깊이(중앙 분할이라 최대 32) 이하, 노드당 최대 3개씩 쌓임
+    constexpr int32 BVH4StackSize = 128;
+
+    // 병렬 프러스텀 컬링: 스레드당 서브트리 수 (작업량 편차 흡수용), 이보다 작은 트리는 태스크 하나로 처리
+    constexpr int32 ParallelCullTasksPerThread = 4;
+    constexpr int32 ParallelCullMinNodes = 64;
+
+    struct FBVH4Lanes
+    {
+        __m128 MinX, MinY, MinZ;
+        __m128 MaxX, MaxY, MaxZ;
+    };
+
+    template<typename NodeType>
+    inline FBVH4Lanes LoadLanes(const NodeType& Node)
+    {
+        return FBVH4Lanes{
+            _mm_load_ps(Node.MinX), _mm_load_ps(Node.MinY), _mm_load_ps(Node.MinZ),
+            _mm_load_ps(Node.MaxX), _mm_load_ps(Node.MaxY), _mm_load_ps(Node.MaxZ) };
+    }
+
+    // FAABB::Intersects와 동일한 판정 (경계 포함)
+    inline int32 AABBLaneMask(const FBVH4Lanes& L, const FAABB& Box)
+    {
+        __m128 Mask = _mm_and_ps(_mm_cmple_ps(L.MinX, _mm_set1_ps(Box.Max.X)), _mm_cmpge_ps(L.MaxX, _mm_set1_ps(Box.Min.X)));
+        Mask = _mm_and_ps(Mask, _mm_and_ps(_mm_cmple_ps(L.MinY, _mm_set1_ps(Box.Max.Y)), _mm_cmpge_ps(L.MaxY, _mm_set1_ps(Box.Min.Y))));
+        Mask = _mm_and_ps(Mask, _mm_and_ps(_mm_cmple_ps(L.MinZ, _mm_set1_ps(Box.Max.Z)), _mm_cmpge_ps(L.MaxZ, _mm_set1_ps(Box.Min.Z))));
+        return _mm_movemask_ps(Mask);
+    }
+
+    // 구 중심에서 박스 최근접점까지의 거리² <= 반지름²
+    inline int32 SphereLaneMask(const FBVH4Lanes& L, const FBoundingSphere& Sphere)
+    {
+        const __m128 CX = _mm_set1_ps(Sphere.Center.X);
+        const __m128 CY = _mm_set1_ps(Sphere.Center.Y);
+        const __m128 CZ = _mm_set1_ps(Sphere.Center.Z);
+        const __m128 DX = _mm_sub_ps(CX, _mm_max_ps(_mm_min_ps(CX, L.MaxX), L.MinX));
+        const __m128 DY = _mm_sub_ps(CY, _mm_max_ps(_mm_min_ps(CY, L.MaxY), L.MinY));
+        const __m128 DZ = _mm_sub_ps(CZ, _mm_max_ps(_mm_min_ps(CZ, L.MaxZ), L.MinZ));
+        const __m128 Dist2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(DX, DX), _mm_mul_ps(DY, DY)), _mm_mul_ps(DZ, DZ));
+        const float Radius = Sphere.GetRadius();
+        return _mm_movemask_ps(_mm_cmple_ps(Dist2, _mm_set1_ps(Radius * Radius)));
+    }
+
+    // OBB를 감싸는 월드 AABB (레인 사전 필터용, 통과한 레인만 정밀 SAT)
+    inline FAABB GetEnclosingAABB(const FOBB& Obb)
+    {
+        FVector Extent;
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            Extent[Axis] = std::abs(Obb.Axes[0][Axis]) * Obb.HalfExtent.X
+                + std::abs(Obb.Axes[1][Axis]) * Obb.HalfExtent.Y
+                + std::abs(Obb.Axes[2][Axis]) * Obb.HalfExtent.Z;
+        }
+        return FAABB(Obb.Center - Extent, Obb.Center + Extent);
+    }
+
+    // IsAABBVisible과 동일하게 측면 4개 평면만 검사
+    inline int32 FrustumLaneMask(const FBVH4Lanes& L, const FFrustum& Frustum)
+    {
+        const __m128 Half = _mm_set1_ps(0.5f);
+        const __m128 CX = _mm_mul_ps(_mm_add_ps(L.MinX, L.MaxX), Half);
+        const __m128 CY = _mm_mul_ps(_mm_add_ps(L.MinY, L.MaxY), Half);
+        const __m128 CZ = _mm_mul_ps(_mm_add_ps(L.MinZ, L.MaxZ), Half);
+        const __m128 EX = _mm_mul_ps(_mm_sub_ps(L.MaxX, L.MinX), Half);
+        const __m128 EY = _mm_mul_ps(_mm_sub_ps(L.MaxY, L.MinY), Half);
+        const __m128 EZ = _mm_mul_ps(_mm_sub_ps(L.MaxZ, L.MinZ), Half);
+
+        const FPlane* Planes[4] = { &Frustum.LeftFace, &Frustum.RightFace, &Frustum.TopFace, &Frustum.BottomFace };
+        __m128 Mask = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (const FPlane* Plane : Planes)
+        {
+            const __m128 NX = _mm_set1_ps(Plane->Normal.X);
+            const __m128 NY = _mm_set1_ps(Plane->Normal.Y);
+            const __m128 NZ = _mm_set1_ps(Plane->Normal.Z);
+            const __m128 Distance = _mm_sub_ps(
+                _mm_add_ps(_mm_add_ps(_mm_mul_ps(NX, CX), _mm_mul_ps(NY, CY)), _mm_mul_ps(NZ, CZ)),
+                _mm_set1_ps(Plane->Distance));
+            const __m128 Radius = _mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(_mm_set1_ps(std::abs(Plane->Normal.X)), EX),
+                _mm_mul_ps(_mm_set1_ps(std::abs(Plane->Normal.Y)), EY)),
+                _mm_mul_ps(_mm_set1_ps(std::abs(Plane->Normal.Z)), EZ));
+            Mask = _mm_and_ps(Mask, _mm_cmpge_ps(_mm_add_ps(Distance, Radius), _mm_setzero_ps()));
+        }
+        return _mm_movemask_ps(Mask);
+    }
+
+    struct FRayLanes
+    {
+        __m128 OX, OY, OZ;
+        __m128 IX, IY, IZ;
+    };
+
+    inline FRayLanes MakeRayLanes(const FRay& Ray)
+    {
+        // 축 방향 성분이 0에 가까우면 큰 유한값으로 대체 (0 * inf = NaN 방지)
+        const auto SafeInv = [](float D)
+            {
+                if (std::abs(D) < 1e-6f)
+                {
+                    return D < 0.0f ? -BVH4EmptyLaneExtent : BVH4EmptyLaneExtent;
+                }
+                return 1.0f / D;
+            };
+        return FRayLanes{
+            _mm_set1_ps(Ray.Origin.X), _mm_set1_ps(Ray.Origin.Y), _mm_set1_ps(Ray.Origin.Z),
+            _mm_set1_ps(SafeInv(Ray.Direction.X)), _mm_set1_ps(SafeInv(Ray.Direction.Y)), _mm_set1_ps(SafeInv(Ray.Direction.Z)) };
+    }
+
+    // 슬랩 테스트, 진입 거리(0 이상으로 클램프)를 OutTMin에 기록
+    inline int32 RayLaneMask(const FBVH4Lanes& L, const FRayLanes& R, float MaxT, __m128& OutTMin)
+    {
+        const __m128 TX1 = _mm_mul_ps(_mm_sub_ps(L.MinX, R.OX), R.IX);
+        const __m128 TX2 = _mm_mul_ps(_mm_sub_ps(L.MaxX, R.OX), R.IX);
+        const __m128 TY1 = _mm_mul_ps(_mm_sub_ps(L.MinY, R.OY), R.IY);
+        const __m128 TY2 = _mm_mul_ps(_mm_sub_ps(L.MaxY, R.OY), R.IY);
+        const __m128 TZ1 = _mm_mul_ps(_mm_sub_ps(L.MinZ, R.OZ), R.IZ);
+        const __m128 TZ2 = _mm_mul_ps(_mm_sub_ps(L.MaxZ, R.OZ), R.IZ);
+
+        __m128 TMin = _mm_max_ps(_mm_max_ps(_mm_min_ps(TX1, TX2), _mm_min_ps(TY1, TY2)), _mm_min_ps(TZ1, TZ2));
+        const __m128 TMax = _mm_min_ps(_mm_min_ps(_mm_max_ps(TX1, TX2), _mm_max_ps(TY1, TY2)), _mm_max_ps(TZ1, TZ2));
+        TMin = _mm_max_ps(TMin, _mm_setzero_ps());
+
+        OutTMin = TMin;
+        return _mm_movemask_ps(_mm_and_ps(_mm_cmple_ps(TMin, TMax), _mm_cmple_ps(TMin, _mm_set1_ps(MaxT))));
+    }
+
+    struct FRayHeapItem
+    {
+        int32 Idx;
+        float TMin;
+        bool operator<(const FRayHeapItem& Other) const { return TMin > Other.TMin; } // min-heap behavior
+    };
+
+    inline int32 PopLane(int32& Mask)
+    {
+        const int32 Lane = std::countr_zero(static_cast<uint32>(Mask));
+        Mask &= Mask - 1;
+        return Lane;
+    }
 }
 
 FBVHierarchy::FBVHierarchy(const FAABB& InBounds, int InDepth, int InMaxDepth, int InMaxObjects)
@@ -66,6 +227,14 @@ void FBVHierarchy::Clear()
     StaticMeshComponentBounds = TMap<UPrimitiveComponent*, FAABB>();
     StaticMeshComponentArray = TArray<UPrimitiveComponent*>();
     Nodes = TArray<FLBVHNode>();
+    Nodes4 = TArray<FBVH4Node>();
+    BinaryToBVH4Lane = TArray<int32>();
+    ComponentLeafIndex = TMap<UPrimitiveComponent*, int32>();
+    DirtyLeaves = TArray<int32>();
+    LeafDirtyFlags = TArray<uint8>();
+    RemovedSlotCount = 0;
+    SAHCostSum = 0.0f;
+    BuiltSAHCost = 0.0f;
     Bounds = FAABB();
     bPendingRebuild = false;
 }
@@ -101,6 +270,21 @@ void FBVHierarchy::Update(UPrimitiveComponent* InComponent)
 
     const FAABB WorldBounds = InComponent->GetWorldAABB();
 
+    // 이미 트리에 들어있는 컴포넌트는 바운드만 갱신하고 Refit 대상으로 표시
+    if (const int32* LeafIdx = ComponentLeafIndex.Find(InComponent))
+    {
+        if (FAABB* Cached = StaticMeshComponentBounds.Find(InComponent))
+        {
+            if (!IsSameBounds(*Cached, WorldBounds))
+            {
+                *Cached = WorldBounds;
+                MarkLeafDirty(*LeafIdx);
+            }
+            return;
+        }
+    }
+
+    // 신규 컴포넌트는 리프 구간에 끼워 넣을 수 없으므로 재빌드
     StaticMeshComponentBounds.Add(InComponent, WorldBounds);
     bPendingRebuild = true;
 }
@@ -112,14 +296,38 @@ void FBVHierarchy::Remove(UPrimitiveComponent* InComponent)
         return;
     }
 
-    if (StaticMeshComponentBounds.Find(InComponent))
+    if (!StaticMeshComponentBounds.Find(InComponent))
+    {
+        return;
+    }
+    StaticMeshComponentBounds.Remove(InComponent);
+
+    // 트리에 들어있던 컴포넌트는 슬롯만 비우고 소속 리프를 Refit
+    auto It = ComponentLeafIndex.find(InComponent);
+    if (It == ComponentLeafIndex.end())
     {
-        StaticMeshComponentBounds.Remove(InComponent);
         bPendingRebuild = true;
+        return;
     }
+
+    const int32 LeafIdx = It->second;
+    ComponentLeafIndex.erase(It);
+
+    const FLBVHNode& Leaf = Nodes[LeafIdx];
+    for (int32 i = Leaf.First; i < Leaf.First + Leaf.Count; ++i)
+    {
+        if (StaticMeshComponentArray[i] == InComponent)
+        {
+            StaticMeshComponentArray[i] = nullptr;
+            ++RemovedSlotCount;
+            break;
+        }
+    }
+    MarkLeafDirty(LeafIdx);
 }
 
-void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum)
+template<typename VisibleFunc>
+void FBVHierarchy::ForEachFrustumVisible(const FFrustum& InFrustum, VisibleFunc OnVisible) const
 {
     if (Nodes.empty()) return;
     //프러스텀 외부에 바운드 존재
@@ -132,45 +340,172 @@ void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum)
             if (!Component) continue;
             if (StaticMeshComponentBounds.find(Component) == StaticMeshComponentBounds.end())
                 continue;
+            OnVisible(Component);
+        }
+        return;
+    }
+
+    const auto VisitLeaf = [&](const FLBVHNode& Leaf)
+        {
+            for (int32 i = 0; i < Leaf.Count; ++i)
+            {
+                UPrimitiveComponent* Component = StaticMeshComponentArray[Leaf.First + i];
+                if (!Component) continue;
+                const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
+                if (!Cached) continue;
+                if (IsAABBVisible(InFrustum, *Cached))
+                {
+                    OnVisible(Component);
+                }
+            }
+        };
+
+    //프러스텀과 바운드가 교차
+    if (bUseBVH4 && !Nodes4.empty())
+    {
+        int32 Stack[BVH4StackSize];
+        int32 StackSize = 0;
+        Stack[StackSize++] = 0;
+        while (StackSize > 0)
+        {
+            const FBVH4Node& Node = Nodes4[Stack[--StackSize]];
+            int32 Mask = FrustumLaneMask(LoadLanes(Node), InFrustum) & Node.ValidMask;
+            while (Mask)
+            {
+                const int32 Lane = PopLane(Mask);
+                if (Node.LeafMask & (1 << Lane))
+                {
+                    VisitLeaf(Nodes[Node.Child[Lane]]);
+                }
+                else
+                {
+                    Stack[StackSize++] = Node.Child[Lane];
+                }
+            }
+        }
+        return;
+    }
+
+    // 이진 LBVH: 전위 순서 + Skip 인덱스로 스택 없이 순회
+    const int32 NumNodes = Nodes.Num();
+    int32 Idx = 0;
+    while (Idx < NumNodes)
+    {
+        const FLBVHNode& Node = Nodes[Idx];
+        if (!IsAABBVisible(InFrustum, Node.Bounds))
+        {
+            Idx = Node.Skip;
+            continue;
+        }
+        if (Node.IsLeaf())
+        {
+            VisitLeaf(Node);
+            Idx = Node.Skip;
+            continue;
+        }
+        Idx = Node.Left;
+    }
+}
+
+void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum)
+{
+    ForEachFrustumVisible(InFrustum, [](UPrimitiveComponent* Component)
+        {
             if (AActor* Owner = Component->GetOwner())
             {
                 Owner->SetCulled(false);
             }
+        });
+}
+
+void FBVHierarchy::QueryFrustumParallel(const FFrustum& InFrustum, TFunctionRef<bool(UPrimitiveComponent*)> Filter, TArray<UPrimitiveComponent*>& OutVisible) const
+{
+    OutVisible.clear();
+    if (Nodes.empty()) return;
+    if (!IsAABBVisible(InFrustum, Nodes[0].Bounds)) return;
+
+    // 1) 루트부터 보이는 자식만 남기며 한 단계씩 펼쳐 서브트리 루트 목록 생성
+    //    노드를 제자리에서 자식 둘로 바꾸므로 목록은 항상 전위 순서 (= 서브트리 구간이 오름차순으로 겹치지 않음)
+    const int32 NumThreads = FWorkerPool::GetInstance().GetNumWorkers() + 1;
+    const int32 TargetTaskCount = Nodes.Num() < ParallelCullMinNodes ? 1 : NumThreads * ParallelCullTasksPerThread;
+
+    ParallelCullRoots.clear();
+    ParallelCullRoots.push_back(0);
+    bool bExpanded = true;
+    while (bExpanded && ParallelCullRoots.Num() < TargetTaskCount)
+    {
+        bExpanded = false;
+        ParallelCullFrontier.clear();
+        for (int32 Idx : ParallelCullRoots)
+        {
+            const FLBVHNode& Node = Nodes[Idx];
+            if (Node.IsLeaf())
+            {
+                ParallelCullFrontier.push_back(Idx);
+                continue;
+            }
+            if (IsAABBVisible(InFrustum, Nodes[Node.Left].Bounds)) ParallelCullFrontier.push_back(Node.Left);
+            if (IsAABBVisible(InFrustum, Nodes[Node.Right].Bounds)) ParallelCullFrontier.push_back(Node.Right);
+            bExpanded = true;
         }
-        return;
+        std::swap(ParallelCullRoots, ParallelCullFrontier);
     }
-    //프러스텀과 바운드가 교차
-    TArray<int32> IdxStack;
-    IdxStack.push_back({ 0 });
 
-    while (!IdxStack.empty())
+    const int32 NumTasks = ParallelCullRoots.Num();
+    if (NumTasks == 0) return;
+    if (ParallelCullResults.Num() < NumTasks)
     {
-        int32 Idx = IdxStack.back();
-        IdxStack.pop_back();
-        const FLBVHNode& node = Nodes[Idx];
-        if (node.IsLeaf())
+        ParallelCullResults.resize(NumTasks);
+    }
+
+    // 2) 서브트리마다 [Root, Skip) 구간을 스택 없이 순회, 결과는 태스크 전용 배열에만 기록
+    ParallelFor(NumTasks, [this, &InFrustum, &Filter](int32 TaskIdx)
         {
-            for (int32 i = 0; i < node.Count; ++i)
+            TArray<UPrimitiveComponent*>& Out = ParallelCullResults[TaskIdx];
+            Out.clear();
+
+            const int32 Root = ParallelCullRoots[TaskIdx];
+            const int32 End = Nodes[Root].Skip;
+            int32 Idx = Root;
+            while (Idx < End)
             {
-                UPrimitiveComponent* Component = StaticMeshComponentArray[node.First + i];
-                if (!Component || StaticMeshComponentBounds.find(Component) == StaticMeshComponentBounds.end())
+                const FLBVHNode& Node = Nodes[Idx];
+                if (!IsAABBVisible(InFrustum, Node.Bounds))
+                {
+                    Idx = Node.Skip;
                     continue;
-                const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
-                const FAABB Box = Cached ? *Cached : Component->GetWorldAABB();
-                if (IsAABBVisible(InFrustum, Box))
+                }
+                if (!Node.IsLeaf())
                 {
-                    if (AActor* Owner = Component->GetOwner())
+                    Idx = Node.Left;
+                    continue;
+                }
+
+                for (int32 i = 0; i < Node.Count; ++i)
+                {
+                    UPrimitiveComponent* Component = StaticMeshComponentArray[Node.First + i];
+                    if (!Component) continue;
+                    const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
+                    if (!Cached) continue;
+                    if (IsAABBVisible(InFrustum, *Cached) && Filter(Component))
                     {
-                        Owner->SetCulled(false);
+                        Out.push_back(Component);
                     }
                 }
+                Idx = Node.Skip;
             }
-            continue;
-        }
-        if (node.Left >= 0 && IsAABBVisible(InFrustum, Nodes[node.Left].Bounds))
-            IdxStack.push_back({ node.Left });
-        if (node.Right >= 0 && IsAABBVisible(InFrustum, Nodes[node.Right].Bounds))
-            IdxStack.push_back({ node.Right });
+        });
+
+    // 3) 태스크 순서대로 이어붙임 (결정적)
+    int32 TotalCount = 0;
+    for (int32 i = 0; i < NumTasks; ++i)
+    {
+        TotalCount += ParallelCullResults[i].Num();
+    }
+    OutVisible.reserve(TotalCount);
+    for (int32 i = 0; i < NumTasks; ++i)
+    {
+        OutVisible.insert(OutVisible.end(), ParallelCullResults[i].begin(), ParallelCullResults[i].end());
     }
 }
 
@@ -239,12 +574,15 @@ void FBVHierarchy::DebugDump() const
     char buf[256];
     std::snprintf(buf, sizeof(buf), "nodes=%zu, components=%zu\r\n", Nodes.size(), StaticMeshComponentArray.size());
     UE_LOG(buf);
+    std::snprintf(buf, sizeof(buf), "rebuilds=%u, refits=%u (last refit leaves=%u), removed slots=%d, SAH=%.3f (built %.3f)\r\n",
+        RebuildCount, RefitCount, LastRefitLeafCount, RemovedSlotCount, GetSAHCost(), BuiltSAHCost);
+    UE_LOG(buf);
     for (size_t i = 0; i < Nodes.size(); ++i)
     {
         const auto& n = Nodes[i];
         std::snprintf(buf, sizeof(buf),
-            "[%zu] L=%d R=%d F=%d C=%d | [(%.1f,%.1f,%.1f)-(%.1f,%.1f,%.1f)]\r\n",
-            i, n.Left, n.Right, n.First, n.Count,
+            "[%zu] P=%d L=%d R=%d F=%d C=%d | [(%.1f,%.1f,%.1f)-(%.1f,%.1f,%.1f)]\r\n",
+            i, n.Parent, n.Left, n.Right, n.First, n.Count,
             n.Bounds.Min.X, n.Bounds.Min.Y, n.Bounds.Min.Z,
             n.Bounds.Max.X, n.Bounds.Max.Y, n.Bounds.Max.Z);
         UE_LOG(buf);
@@ -271,9 +609,18 @@ namespace
 
 void FBVHierarchy::BuildLBVH()
 {
+    ++RebuildCount;
     StaticMeshComponentArray = StaticMeshComponentBounds.GetKeys();
     const int N = StaticMeshComponentArray.Num();
     Nodes = TArray<FLBVHNode>();
+    Nodes4 = TArray<FBVH4Node>();
+    BinaryToBVH4Lane = TArray<int32>();
+    ComponentLeafIndex.clear();
+    DirtyLeaves.clear();
+    LeafDirtyFlags.clear();
+    RemovedSlotCount = 0;
+    SAHCostSum = 0.0f;
+    BuiltSAHCost = 0.0f;
 
     if (N == 0)
     {
@@ -354,6 +701,29 @@ void FBVHierarchy::BuildLBVH()
     Nodes.reserve(std::max(1, 2 * N));
     Nodes.clear();
     BuildRange(0, N);
+
+    // Refit용 역참조 / SAH 기준값
+    ComponentLeafIndex.reserve(N);
+    LeafDirtyFlags.SetNum(Nodes.Num(), 0);
+    for (int32 i = 0; i < Nodes.Num(); ++i)
+    {
+        const FLBVHNode& Node = Nodes[i];
+        SAHCostSum += SurfaceArea(Node.Bounds) * NodeSAHWeight(Node);
+        if (!Node.IsLeaf())
+        {
+            continue;
+        }
+        for (int32 j = Node.First; j < Node.First + Node.Count; ++j)
+        {
+            if (UPrimitiveComponent* Component = StaticMeshComponentArray[j])
+            {
+                ComponentLeafIndex[Component] = i;
+            }
+        }
+    }
+    BuiltSAHCost = GetSAHCost();
+
+    BuildBVH4();
 }
 
 int FBVHierarchy::BuildRange(int s, int e)
@@ -390,6 +760,7 @@ int FBVHierarchy::BuildRange(int s, int e)
             }
         }
         node.Bounds = bInitialized ? Accumulated : Bounds;
+        node.Skip = nodeIdx + 1;
         return nodeIdx;
     }
 
@@ -398,9 +769,118 @@ int FBVHierarchy::BuildRange(int s, int e)
     int R = BuildRange(mid, e);
     node.Left = L; node.Right = R; node.First = -1; node.Count = 0;
     node.Bounds = FAABB::Union(Nodes[L].Bounds, Nodes[R].Bounds);
+    Nodes[L].Parent = nodeIdx;
+    Nodes[R].Parent = nodeIdx;
+    Nodes[nodeIdx].Skip = static_cast<int32>(Nodes.size());
     return nodeIdx;
 }
 
+void FBVHierarchy::MarkLeafDirty(int32 LeafIdx)
+{
+    if (LeafIdx < 0 || LeafIdx >= LeafDirtyFlags.Num())
+    {
+        bPendingRebuild = true;
+        return;
+    }
+    if (!LeafDirtyFlags[LeafIdx])
+    {
+        LeafDirtyFlags[LeafIdx] = 1;
+        DirtyLeaves.Add(LeafIdx);
+    }
+}
+
+void FBVHierarchy::Refit()
+{
+    ++RefitCount;
+    LastRefitLeafCount = static_cast<uint32>(DirtyLeaves.Num());
+
+    for (int32 LeafIdx : DirtyLeaves)
+    {
+        LeafDirtyFlags[LeafIdx] = 0;
+        if (!RefitLeaf(LeafIdx))
+        {
+            continue;
+        }
+        SyncBVH4Lane(LeafIdx);
+
+        // 조상 방향으로 올라가며 갱신, 합집합이 그대로면 그 위는 볼 필요 없음
+        int32 ParentIdx = Nodes[LeafIdx].Parent;
+        while (ParentIdx >= 0)
+        {
+            FLBVHNode& Parent = Nodes[ParentIdx];
+            const FAABB NewBounds = FAABB::Union(Nodes[Parent.Left].Bounds, Nodes[Parent.Right].Bounds);
+            if (IsSameBounds(NewBounds, Parent.Bounds))
+            {
+                break;
+            }
+            SAHCostSum += (SurfaceArea(NewBounds) - SurfaceArea(Parent.Bounds)) * NodeSAHWeight(Parent);
+            Parent.Bounds = NewBounds;
+            SyncBVH4Lane(ParentIdx);
+            ParentIdx = Parent.Parent;
+        }
+    }
+    DirtyLeaves.clear();
+
+    if (!Nodes.empty())
+    {
+        Bounds = Nodes[0].Bounds;
+    }
+}
+
+bool FBVHierarchy::RefitLeaf(int32 LeafIdx)
+{
+    FLBVHNode& Leaf = Nodes[LeafIdx];
+
+    bool bInitialized = false;
+    FAABB Accumulated;
+    for (int32 i = Leaf.First; i < Leaf.First + Leaf.Count; ++i)
+    {
+        UPrimitiveComponent* Component = StaticMeshComponentArray[i];
+        if (!Component)
+        {
+            continue;
+        }
+        const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
+        if (!Cached)
+        {
+            continue;
+        }
+        Accumulated = bInitialized ? FAABB::Union(Accumulated, *Cached) : *Cached;
+        bInitialized = true;
+    }
+
+    // 전부 제거된 리프는 이전 바운드를 유지 (빈 슬롯은 쿼리에서 건너뜀, 비율 초과 시 재빌드)
+    if (!bInitialized || IsSameBounds(Accumulated, Leaf.Bounds))
+    {
+        return false;
+    }
+
+    SAHCostSum += (SurfaceArea(Accumulated) - SurfaceArea(Leaf.Bounds)) * NodeSAHWeight(Leaf);
+    Leaf.Bounds = Accumulated;
+    return true;
+}
+
+float FBVHierarchy::NodeSAHWeight(const FLBVHNode& Node) const
+{
+    return Node.IsLeaf() ? static_cast<float>(Node.Count) * SAHIntersectCost : SAHTraversalCost;
+}
+
+float FBVHierarchy::SurfaceArea(const FAABB& Box)
+{
+    const FVector D = Box.Max - Box.Min;
+    return 2.0f * (D.X * D.Y + D.Y * D.Z + D.Z * D.X);
+}
+
+float FBVHierarchy::GetSAHCost() const
+{
+    if (Nodes.empty())
+    {
+        return 0.0f;
+    }
+    const float RootArea = SurfaceArea(Nodes[0].Bounds);
+    return RootArea > KINDA_SMALL_NUMBER ? SAHCostSum / RootArea : 0.0f;
+}
+
 void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const
 {
     OutActor = nullptr;
@@ -412,25 +892,70 @@ void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float
 
     if (Nodes.empty()) return;
 
-    float tminRoot, tmaxRoot;
-    if (!RayAABB_IntersectT(Ray, Nodes[0].Bounds, tminRoot, tmaxRoot)) return;
+    if (bUseBVH4 && !Nodes4.empty())
+    {
+        QueryRayClosestBVH4(Ray, OutActor, OutBestT);
+    }
+    else
+    {
+        QueryRayClosestBinary(Ray, OutActor, OutBestT);
+    }
+}
 
-    struct HeapItem
+void FBVHierarchy::RayTestLeaf(const FLBVHNode& Leaf, const FRay& Ray, AActor*& OutActor, float& OutBestT) const
+{
+    const float Epsilon = 1e-3f;
+    for (int i = 0; i < Leaf.Count; ++i)
     {
-        int Idx;
-        float TMin;
-        bool operator<(const HeapItem& other) const { return TMin > other.TMin; } // min-heap behavior
-    };
+        UPrimitiveComponent* Component = StaticMeshComponentArray[Leaf.First + i];
+        if (!Component) continue;
+        AActor* Owner = Component->GetOwner();
+        if (!Owner) continue;
+        if (Owner->GetActorHiddenInEditor()) continue;
+
+        const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
+        const FAABB Box = Cached ? *Cached : Component->GetWorldAABB();
 
-    std::priority_queue<HeapItem> heap;
-    heap.push({ 0, tminRoot });
+        float tmin, tmax;
+        if (!RayAABB_IntersectT(Ray, Box, tmin, tmax))
+            continue;
+        if (OutActor && tmin > OutBestT + Epsilon)
+            continue;
+
+        float hitDistance;
+        if (CPickingSystem::CheckActorPicking(Owner, Ray, hitDistance))
+        {
+            if (hitDistance < OutBestT)
+            {
+                OutBestT = hitDistance;
+                OutActor = Owner;
+            }
+        }
+    }
+}
+
+void FBVHierarchy::QueryRayClosestBinary(const FRay& Ray, AActor*& OutActor, float& OutBestT) const
+{
+    float tminRoot, tmaxRoot;
+    if (!RayAABB_IntersectT(Ray, Nodes[0].Bounds, tminRoot, tmaxRoot)) return;
+
+    // 스레드별 스크래치 배열 위에서 힙 연산 (호출마다 priority_queue 할당 방지)
+    TSpatialQueryScratch<FRayHeapItem> Scratch;
+    TArray<FRayHeapItem>& heap = *Scratch;
+    const auto Push = [&heap](int32 Idx, float TMin)
+        {
+            heap.push_back({ Idx, TMin });
+            std::push_heap(heap.begin(), heap.end());
+        };
+    Push(0, tminRoot);
 
     const float Epsilon = 1e-3f;
     bool isPick = false;
     while (!heap.empty())
     {
-        HeapItem entry = heap.top();
-        heap.pop();
+        std::pop_heap(heap.begin(), heap.end());
+        const FRayHeapItem entry = heap.back();
+        heap.pop_back();
 
         if (OutActor && entry.TMin > OutBestT + Epsilon)
             break;
@@ -438,34 +963,8 @@ void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float
         const FLBVHNode& node = Nodes[entry.Idx];
         if (node.IsLeaf())
         {
-            for (int i = 0; i < node.Count; ++i)
-            {
-                UPrimitiveComponent* Component = StaticMeshComponentArray[node.First + i];
-                if (!Component) continue;
-                AActor* Owner = Component->GetOwner();
-                if (!Owner) continue;
-                if (Owner->GetActorHiddenInEditor()) continue;
-
-                const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
-                const FAABB Box = Cached ? *Cached : Component->GetWorldAABB();
-
-                float tmin, tmax;
-                if (!RayAABB_IntersectT(Ray, Box, tmin, tmax))
-                    continue;
-                if (OutActor && tmin > OutBestT + Epsilon)
-                    continue;
-
-                float hitDistance;
-                if (CPickingSystem::CheckActorPicking(Owner, Ray, hitDistance))
-                {
-                    if (hitDistance < OutBestT)
-                    {
-                        OutBestT = hitDistance;
-                        OutActor = Owner;
-                        isPick = true;
-                    }
-                }
-            }
+            RayTestLeaf(node, Ray, OutActor, OutBestT);
+            isPick = OutActor != nullptr;
             continue;
         }
         if (isPick == true)
@@ -479,7 +978,7 @@ void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float
             if (RayAABB_IntersectT(Ray, Nodes[node.Left].Bounds, tminL, tmaxL))
             {
                 if (!OutActor || tminL <= OutBestT + Epsilon)
-                    heap.push({ node.Left, tminL });
+                    Push(node.Left, tminL);
             }
         }
         if (node.Right >= 0)
@@ -488,7 +987,64 @@ void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float
             if (RayAABB_IntersectT(Ray, Nodes[node.Right].Bounds, tminR, tmaxR))
             {
                 if (!OutActor || tminR <= OutBestT + Epsilon)
-                    heap.push({ node.Right, tminR });
+                    Push(node.Right, tminR);
+            }
+        }
+    }
+}
+
+void FBVHierarchy::QueryRayClosestBVH4(const FRay& Ray, AActor*& OutActor, float& OutBestT) const
+{
+    struct FStackItem
+    {
+        int32 Idx;
+        float TMin;
+    };
+
+    const float Epsilon = 1e-3f;
+    const FRayLanes RayLanes = MakeRayLanes(Ray);
+
+    FStackItem Stack[BVH4StackSize];
+    int32 StackSize = 0;
+    Stack[StackSize++] = { 0, 0.0f };
+
+    while (StackSize > 0)
+    {
+        const FStackItem Entry = Stack[--StackSize];
+        if (OutActor && Entry.TMin > OutBestT + Epsilon)
+            continue;
+
+        const FBVH4Node& Node = Nodes4[Entry.Idx];
+        const float MaxT = OutActor ? OutBestT + Epsilon : std::numeric_limits<float>::infinity();
+
+        alignas(16) float LaneTMin[4];
+        __m128 TMin;
+        int32 Mask = RayLaneMask(LoadLanes(Node), RayLanes, MaxT, TMin) & Node.ValidMask;
+        _mm_store_ps(LaneTMin, TMin);
+
+        // 리프는 가까운 순서로 바로 검사, 내부 노드는 먼 것부터 쌓아서 가까운 것이 먼저 꺼내지도록
+        int32 Order[4];
+        int32 OrderCount = 0;
+        while (Mask)
+        {
+            Order[OrderCount++] = PopLane(Mask);
+        }
+        std::sort(Order, Order + OrderCount, [&LaneTMin](int32 A, int32 B) { return LaneTMin[A] < LaneTMin[B]; });
+
+        for (int32 i = 0; i < OrderCount; ++i)
+        {
+            const int32 Lane = Order[i];
+            if ((Node.LeafMask & (1 << Lane)) && (!OutActor || LaneTMin[Lane] <= OutBestT + Epsilon))
+            {
+                RayTestLeaf(Nodes[Node.Child[Lane]], Ray, OutActor, OutBestT);
+            }
+        }
+        for (int32 i = OrderCount - 1; i >= 0; --i)
+        {
+            const int32 Lane = Order[i];
+            if (!(Node.LeafMask & (1 << Lane)))
+            {
+                Stack[StackSize++] = { Node.Child[Lane], LaneTMin[Lane] };
             }
         }
     }
@@ -500,79 +1056,406 @@ void FBVHierarchy::FlushRebuild()
     {
         BuildLBVH();
         bPendingRebuild = false;
+        return;
+    }
+
+    if (DirtyLeaves.empty())
+    {
+        return;
+    }
+
+    Refit();
+
+    // Refit으로 트리 품질이 떨어졌거나 빈 슬롯이 많으면 그때만 전체 재빌드
+    const int32 SlotCount = StaticMeshComponentArray.Num();
+    const bool bTooManyHoles = SlotCount > 0 && RemovedSlotCount > static_cast<int32>(SlotCount * RebuildRemovedSlotRatio);
+    const bool bDegraded = BuiltSAHCost > 0.0f && GetSAHCost() > BuiltSAHCost * RebuildSAHRatio;
+    if (bTooManyHoles || bDegraded)
+    {
+        BuildLBVH();
     }
 }
 
-template<typename BoundType, typename NodeIntersectFunc, typename ComponentIntersectFunc>
-TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponentsGeneric(
+template<typename BoundType, typename NodeIntersectFunc, typename LaneMaskFunc, typename ComponentIntersectFunc>
+void FBVHierarchy::QueryIntersectedComponentsGeneric(
     const BoundType& InBound,
     NodeIntersectFunc NodeIntersects,
-    ComponentIntersectFunc ComponentIntersects) const
+    LaneMaskFunc LaneMask,
+    ComponentIntersectFunc ComponentIntersects,
+    TFunctionRef<void(UPrimitiveComponent*)> Visitor) const
 {
-    TSet<UPrimitiveComponent*> IntersectedComponents;
     if (Nodes.empty())
-        return TArray<UPrimitiveComponent*>();
-    TArray<int32> IdxStack;
-    IdxStack.push_back({ 0 });
+        return;
 
-    while (!IdxStack.empty())
-    {
-        int32 Idx = IdxStack.back();
-        IdxStack.pop_back();
-        const FLBVHNode& Node = Nodes[Idx];
-        if (NodeIntersects(Node.Bounds, InBound))
+    const auto VisitLeaf = [&](const FLBVHNode& Leaf)
         {
-            if (Node.IsLeaf())
+            for (int32 i = 0; i < Leaf.Count; ++i)
             {
-                for (int32 i = 0; i < Node.Count; ++i)
+                UPrimitiveComponent* Component = StaticMeshComponentArray[Leaf.First + i];
+                if (!Component)
+                    continue;
+                const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
+                if (!Cached)
+                    continue;
+                // 컴포넌트는 트리에 한 번만 들어있으므로 중복 제거 불필요
+                if (ComponentIntersects(*Cached, InBound))
                 {
-                    UPrimitiveComponent* Component = StaticMeshComponentArray[Node.First + i];
-                    if (!Component || StaticMeshComponentBounds.find(Component) == StaticMeshComponentBounds.end())
-                        continue;
-                    const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
-                    const FAABB Box = Cached ? *Cached : Component->GetWorldAABB();
-                    if (ComponentIntersects(Box, InBound))
-                    {
-                        IntersectedComponents.insert(Component);
-                    }
+                    Visitor(Component);
                 }
             }
-            else
+        };
+
+    if (bUseBVH4 && !Nodes4.empty())
+    {
+        int32 Stack[BVH4StackSize];
+        int32 StackSize = 0;
+        Stack[StackSize++] = 0;
+        while (StackSize > 0)
+        {
+            const FBVH4Node& Node = Nodes4[Stack[--StackSize]];
+            int32 Mask = LaneMask(Node, InBound) & Node.ValidMask;
+            while (Mask)
             {
-                if (Node.Left >= 0) IdxStack.push_back({ Node.Left });
-                if (Node.Right >= 0) IdxStack.push_back({ Node.Right });
+                const int32 Lane = PopLane(Mask);
+                if (Node.LeafMask & (1 << Lane))
+                {
+                    VisitLeaf(Nodes[Node.Child[Lane]]);
+                }
+                else
+                {
+                    Stack[StackSize++] = Node.Child[Lane];
+                }
             }
         }
+        return;
+    }
+
+    // 이진 LBVH: 전위 순서 + Skip 인덱스로 스택 없이 순회
+    const int32 NumNodes = Nodes.Num();
+    int32 Idx = 0;
+    while (Idx < NumNodes)
+    {
+        const FLBVHNode& Node = Nodes[Idx];
+        if (!NodeIntersects(Node.Bounds, InBound))
+        {
+            Idx = Node.Skip;
+            continue;
+        }
+        if (Node.IsLeaf())
+        {
+            VisitLeaf(Node);
+            Idx = Node.Skip;
+            continue;
+        }
+        Idx = Node.Left;
     }
-    return IntersectedComponents.Array();
 }
 
 // FAABB 오버로드
-TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FAABB& InBound) const
+void FBVHierarchy::ForEachIntersectedComponent(const FAABB& InBound, TFunctionRef<void(UPrimitiveComponent*)> Visitor) const
 {
-    return QueryIntersectedComponentsGeneric(
+    QueryIntersectedComponentsGeneric(
         InBound,
         [](const FAABB& nodeBound, const FAABB& inBound) { return nodeBound.Intersects(inBound); },
-        [](const FAABB& compBound, const FAABB& inBound) { return inBound.Intersects(compBound); }
+        [](const FBVH4Node& node, const FAABB& inBound) { return AABBLaneMask(LoadLanes(node), inBound); },
+        [](const FAABB& compBound, const FAABB& inBound) { return inBound.Intersects(compBound); },
+        Visitor
     );
 }
 
 // FOBB 오버로드
-TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FOBB& InBound) const
+void FBVHierarchy::ForEachIntersectedComponent(const FOBB& InBound, TFunctionRef<void(UPrimitiveComponent*)> Visitor) const
 {
-    return QueryIntersectedComponentsGeneric(
+    // 레인은 OBB를 감싸는 AABB로 거르고, 통과한 레인만 정밀 판정
+    const FAABB Enclosing = GetEnclosingAABB(InBound);
+    QueryIntersectedComponentsGeneric(
         InBound,
         [](const FAABB& nodeBound, const FOBB& inBound) { return Collision::Intersects(nodeBound, inBound); },
-        [](const FAABB& compBound, const FOBB& inBound) { return Collision::Intersects(compBound, inBound); }
+        [&Enclosing](const FBVH4Node& node, const FOBB& inBound)
+        {
+            int32 Mask = AABBLaneMask(LoadLanes(node), Enclosing) & node.ValidMask;
+            int32 Result = 0;
+            while (Mask)
+            {
+                const int32 Lane = PopLane(Mask);
+                const FAABB LaneBox(
+                    FVector(node.MinX[Lane], node.MinY[Lane], node.MinZ[Lane]),
+                    FVector(node.MaxX[Lane], node.MaxY[Lane], node.MaxZ[Lane]));
+                if (Collision::Intersects(LaneBox, inBound))
+                {
+                    Result |= 1 << Lane;
+                }
+            }
+            return Result;
+        },
+        [](const FAABB& compBound, const FOBB& inBound) { return Collision::Intersects(compBound, inBound); },
+        Visitor
     );
 }
 
 // FBoundingSphere 오버로드
-TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FBoundingSphere& InBound) const
+void FBVHierarchy::ForEachIntersectedComponent(const FBoundingSphere& InBound, TFunctionRef<void(UPrimitiveComponent*)> Visitor) const
 {
-    return QueryIntersectedComponentsGeneric(
+    QueryIntersectedComponentsGeneric(
         InBound,
         [](const FAABB& nodeBound, const FBoundingSphere& inBound) { return Collision::Intersects(nodeBound, inBound); },
-        [](const FAABB& compBound, const FBoundingSphere& inBound) { return Collision::Intersects(compBound, inBound); }
+        [](const FBVH4Node& node, const FBoundingSphere& inBound) { return SphereLaneMask(LoadLanes(node), inBound); },
+        [](const FAABB& compBound, const FBoundingSphere& inBound) { return Collision::Intersects(compBound, inBound); },
+        Visitor
     );
 }
+
+// 값 반환 래퍼
+TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FAABB& InBound) const
+{
+    TArray<UPrimitiveComponent*> Result;
+    QueryIntersectedComponents(InBound, Result);
+    return Result;
+}
+
+TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FOBB& InBound) const
+{
+    TArray<UPrimitiveComponent*> Result;
+    QueryIntersectedComponents(InBound, Result);
+    return Result;
+}
+
+TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FBoundingSphere& InBound) const
+{
+    TArray<UPrimitiveComponent*> Result;
+    QueryIntersectedComponents(InBound, Result);
+    return Result;
+}
+
+void FBVHierarchy::SetBVH4Lane(FBVH4Node& Node, int32 Lane, const FAABB& Box)
+{
+    Node.MinX[Lane] = Box.Min.X;
+    Node.MinY[Lane] = Box.Min.Y;
+    Node.MinZ[Lane] = Box.Min.Z;
+    Node.MaxX[Lane] = Box.Max.X;
+    Node.MaxY[Lane] = Box.Max.Y;
+    Node.MaxZ[Lane] = Box.Max.Z;
+}
+
+void FBVHierarchy::BuildBVH4()
+{
+    Nodes4 = TArray<FBVH4Node>();
+    BinaryToBVH4Lane = TArray<int32>();
+    if (Nodes.empty())
+    {
+        return;
+    }
+    BinaryToBVH4Lane.SetNum(Nodes.Num(), -1);
+    // 이진 노드 2N-1개 -> 4-wide 노드는 대략 그 1/3
+    Nodes4.reserve(Nodes.size() / 3 + 1);
+    CollapseBVH4(0);
+}
+
+int32 FBVHierarchy::CollapseBVH4(int32 BinaryIdx)
+{
+    // 이진 서브트리 상단에서 표면적이 큰 내부 노드부터 펼쳐 자식 슬롯을 최대 4개까지 채운다
+    int32 Slots[4];
+    int32 NumSlots = 0;
+    const FLBVHNode& Root = Nodes[BinaryIdx];
+    if (Root.IsLeaf())
+    {
+        Slots[NumSlots++] = BinaryIdx;
+    }
+    else
+    {
+        Slots[NumSlots++] = Root.Left;
+        Slots[NumSlots++] = Root.Right;
+        while (NumSlots < 4)
+        {
+            int32 Best = -1;
+            float BestArea = -1.0f;
+            for (int32 i = 0; i < NumSlots; ++i)
+            {
+                const FLBVHNode& Candidate = Nodes[Slots[i]];
+                if (Candidate.IsLeaf())
+                {
+                    continue;
+                }
+                const float Area = SurfaceArea(Candidate.Bounds);
+                if (Area > BestArea)
+                {
+                    BestArea = Area;
+                    Best = i;
+                }
+            }
+            if (Best < 0)
+            {
+                break;
+            }
+            const FLBVHNode& Expand = Nodes[Slots[Best]];
+            Slots[Best] = Expand.Left;
+            Slots[NumSlots++] = Expand.Right;
+        }
+    }
+
+    const int32 NodeIdx = Nodes4.Num();
+    Nodes4.Add(FBVH4Node{});
+    {
+        FBVH4Node& Node = Nodes4[NodeIdx];
+        // 빈 레인은 뒤집힌 바운드 + ValidMask로 항상 탈락
+        const FAABB EmptyBox(FVector(BVH4EmptyLaneExtent, BVH4EmptyLaneExtent, BVH4EmptyLaneExtent),
+            FVector(-BVH4EmptyLaneExtent, -BVH4EmptyLaneExtent, -BVH4EmptyLaneExtent));
+        for (int32 Lane = 0; Lane < 4; ++Lane)
+        {
+            SetBVH4Lane(Node, Lane, EmptyBox);
+            Node.Child[Lane] = -1;
+        }
+    }
+
+    for (int32 Lane = 0; Lane < NumSlots; ++Lane)
+    {
+        const int32 SrcIdx = Slots[Lane];
+        const bool bLeaf = Nodes[SrcIdx].IsLeaf();
+        // 재귀 중 Nodes4가 재할당될 수 있으므로 참조를 잡아두지 않는다
+        const int32 ChildIdx = bLeaf ? SrcIdx : CollapseBVH4(SrcIdx);
+
+        FBVH4Node& Node = Nodes4[NodeIdx];
+        SetBVH4Lane(Node, Lane, Nodes[SrcIdx].Bounds);
+        Node.Child[Lane] = ChildIdx;
+        BinaryToBVH4Lane[SrcIdx] = NodeIdx * 4 + Lane;
+        Node.ValidMask |= static_cast<uint8>(1 << Lane);
+        if (bLeaf)
+        {
+            Node.LeafMask |= static_cast<uint8>(1 << Lane);
+        }
+    }
+    return NodeIdx;
+}
+
+void FBVHierarchy::SyncBVH4Lane(int32 BinaryIdx)
+{
+    // 토폴로지는 Refit에서 바뀌지 않으므로 바운드가 바뀐 이진 노드를 가리키는 레인 하나만 다시 복사
+    // (접혀서 레인이 없는 내부 노드는 위쪽 레인 바운드에 이미 포함돼 있으니 건너뜀)
+    if (BinaryIdx >= BinaryToBVH4Lane.Num())
+    {
+        return;
+    }
+    const int32 Slot = BinaryToBVH4Lane[BinaryIdx];
+    if (Slot < 0)
+    {
+        return;
+    }
+    SetBVH4Lane(Nodes4[Slot / 4], Slot % 4, Nodes[BinaryIdx].Bounds);
+}
+
+void FBVHierarchy::RunQueryBenchmark(int32 Iterations) const
+{
+    if (Nodes.empty())
+    {
+        UE_LOG("[BVH Bench] BVH is empty\r\n");
+        return;
+    }
+
+    // 쿼리 세트: 트리 안 컴포넌트 바운드를 기준으로 AABB / 구 / 회전된 OBB 생성
+    constexpr int32 MaxQueries = 1024;
+    TArray<FAABB> BoxQueries;
+    TArray<FBoundingSphere> SphereQueries;
+    TArray<FOBB> ObbQueries;
+    const int32 Stride = std::max(1, StaticMeshComponentArray.Num() / MaxQueries);
+    const FMatrix Rotation = FQuat::MakeFromEulerZYX(FVector(0.0f, 30.0f, 45.0f)).ToMatrix();
+    for (int32 i = 0; i < StaticMeshComponentArray.Num(); i += Stride)
+    {
+        UPrimitiveComponent* Component = StaticMeshComponentArray[i];
+        const FAABB* Cached = Component ? StaticMeshComponentBounds.Find(Component) : nullptr;
+        if (!Cached)
+        {
+            continue;
+        }
+        const FVector Center = Cached->GetCenter();
+        const FVector Extent = Cached->GetHalfExtent() * 2.0f;
+        BoxQueries.Add(FAABB(Center - Extent, Center + Extent));
+        SphereQueries.Add(FBoundingSphere(Center, Extent.Size()));
+        FOBB Obb(FAABB(Extent * -1.0f, Extent), Rotation);
+        Obb.Center = Center;
+        ObbQueries.Add(Obb);
+    }
+
+    // 프러스텀: 월드 바운드 모서리에서 중심을 바라보는 뷰
+    const FVector WorldCenter = Bounds.GetCenter();
+    const FVector Eye = Bounds.Min - Bounds.GetHalfExtent() * 0.25f;
+    const FVector Forward = (WorldCenter - Eye).GetSafeNormal();
+    const FFrustum Frustum = CreateFrustumFromViewInfo(Eye, FQuat::FindBetweenVectors(FVector(1, 0, 0), Forward),
+        60.0f, 16.0f / 9.0f, 0.1f, (Bounds.Max - Bounds.Min).Size() * 2.0f);
+
+    // 레이: 각 쿼리 중심 위에서 아래로
+    TArray<FRay> RayQueries;
+    for (const FAABB& Box : BoxQueries)
+    {
+        FRay Ray;
+        Ray.Origin = FVector(Box.GetCenter().X, Box.GetCenter().Y, Bounds.Max.Z + 1.0f);
+        Ray.Direction = FVector(0.0f, 0.0f, -1.0f);
+        RayQueries.Add(Ray);
+    }
+
+    FBVHierarchy* Self = const_cast<FBVHierarchy*>(this);
+    const bool bPrevUseBVH4 = bUseBVH4;
+
+    struct FResult
+    {
+        double Ms[2] = { 0.0, 0.0 };
+        uint64 Hits[2] = { 0, 0 };
+    };
+    FResult Box, Sphere, Obb, Frust, Ray;
+
+    for (int32 Mode = 0; Mode < 2; ++Mode)
+    {
+        Self->bUseBVH4 = (Mode == 1);
+
+        uint64 Start = FPlatformTime::Cycles64();
+        for (int32 It = 0; It < Iterations; ++It)
+            for (const FAABB& Q : BoxQueries)
+                Box.Hits[Mode] += QueryIntersectedComponents(Q).size();
+        Box.Ms[Mode] = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+        Start = FPlatformTime::Cycles64();
+        for (int32 It = 0; It < Iterations; ++It)
+            for (const FBoundingSphere& Q : SphereQueries)
+                Sphere.Hits[Mode] += QueryIntersectedComponents(Q).size();
+        Sphere.Ms[Mode] = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+        Start = FPlatformTime::Cycles64();
+        for (int32 It = 0; It < Iterations; ++It)
+            for (const FOBB& Q : ObbQueries)
+                Obb.Hits[Mode] += QueryIntersectedComponents(Q).size();
+        Obb.Ms[Mode] = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+        Start = FPlatformTime::Cycles64();
+        for (int32 It = 0; It < Iterations * 16; ++It)
+            ForEachFrustumVisible(Frustum, [&](UPrimitiveComponent*) { ++Frust.Hits[Mode]; });
+        Frust.Ms[Mode] = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+
+        // 레이는 메시 피킹 비용이 포함되므로 1회만
+        Start = FPlatformTime::Cycles64();
+        for (const FRay& Q : RayQueries)
+        {
+            AActor* HitActor = nullptr;
+            float BestT = -1.0f;
+            QueryRayClosest(Q, HitActor, BestT);
+            Ray.Hits[Mode] += HitActor ? 1 : 0;
+        }
+        Ray.Ms[Mode] = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+    }
+    Self->bUseBVH4 = bPrevUseBVH4;
+
+    char Buf[256];
+    std::snprintf(Buf, sizeof(Buf), "[BVH Bench] components=%d, binary nodes=%d, bvh4 nodes=%d, iterations=%d\r\n",
+        StaticMeshComponentArray.Num(), Nodes.Num(), Nodes4.Num(), Iterations);
+    UE_LOG(Buf);
+    const auto Report = [&Buf](const char* Name, int32 QueryCount, const FResult& R)
+        {
+            std::snprintf(Buf, sizeof(Buf), "[BVH Bench] %-7s x%-6d binary %8.3f ms | bvh4 %8.3f ms | x%.2f | hits %llu/%llu%s\r\n",
+                Name, QueryCount, R.Ms[0], R.Ms[1], R.Ms[1] > 0.0 ? R.Ms[0] / R.Ms[1] : 0.0,
+                R.Hits[0], R.Hits[1], R.Hits[0] == R.Hits[1] ? "" : " (MISMATCH)");
+            UE_LOG(Buf);
+        };
+    Report("AABB", BoxQueries.Num() * Iterations, Box);
+    Report("Sphere", SphereQueries.Num() * Iterations, Sphere);
+    Report("OBB", ObbQueries.Num() * Iterations, Obb);
+    Report("Frustum", Iterations * 16, Frust);
+    Report("Ray", RayQueries.Num(), Ray);
+}
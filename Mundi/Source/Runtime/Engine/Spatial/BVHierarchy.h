@@ -30,22 +30,78 @@ public:
     void Update(UPrimitiveComponent* InComponent);
     void Remove(UPrimitiveComponent* InComponent);
 
+    // 대기 중인 변경 사항 반영
+    // - 구조 변경(신규 컴포넌트)이 있으면 전체 LBVH 재빌드
+    // - 기존 컴포넌트의 바운드 변경만 있으면 변경된 리프와 조상 노드만 Refit
+    // - Refit 후 SAH 비용이 빌드 직후 대비 RebuildSAHRatio배를 넘으면 재빌드로 전환
     void FlushRebuild();
 
     void QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const;
     void QueryFrustum(const FFrustum& InFrustum);
+
+    // 병렬 프러스텀 컬링: 보이는 노드를 서브트리 단위로 쪼개 워커 풀에서 컬링하고 태스크별 결과를 순서대로 이어붙임
+    // - 결과 순서는 워커 수와 무관하게 이진 LBVH 전위 순회 순서와 같음 (락 없이 병합)
+    // - Filter는 여러 스레드에서 동시에 호출되므로 읽기 전용이어야 함
+    // - 내부 스크래치를 재사용하므로 같은 BVH에 대해 동시에 두 번 호출하면 안 됨
+    void QueryFrustumParallel(const FFrustum& InFrustum, TFunctionRef<bool(UPrimitiveComponent*)> Filter, TArray<UPrimitiveComponent*>& OutVisible) const;
+
+    // 현재 빌드된 트리에 포함된 컴포넌트인지 (재빌드 대기 중인 신규 컴포넌트는 false)
+    bool Contains(UPrimitiveComponent* InComponent) const { return ComponentLeafIndex.find(InComponent) != ComponentLeafIndex.end(); }
+
+    // 할당 없는 쿼리 (방문자): 교차한 컴포넌트마다 Visitor 호출
+    void ForEachIntersectedComponent(const FAABB& InBound, TFunctionRef<void(UPrimitiveComponent*)> Visitor) const;
+    void ForEachIntersectedComponent(const FOBB& InBound, TFunctionRef<void(UPrimitiveComponent*)> Visitor) const;
+    void ForEachIntersectedComponent(const FBoundingSphere& InBound, TFunctionRef<void(UPrimitiveComponent*)> Visitor) const;
+
+    // 할당 없는 쿼리 (호출자 소유 배열): OutComponents를 비우고 채움, capacity는 유지되므로 재사용하면 할당 없음
+    template<typename BoundType>
+    void QueryIntersectedComponents(const BoundType& InBound, TArray<UPrimitiveComponent*>& OutComponents) const
+    {
+        OutComponents.clear();
+        ForEachIntersectedComponent(InBound, [&OutComponents](UPrimitiveComponent* Component) { OutComponents.push_back(Component); });
+    }
+
+    // 할당 없는 쿼리 (고정 버퍼): 최대 BufferCapacity개까지 기록, 반환값은 교차한 전체 개수 (Capacity 초과 가능)
+    template<typename BoundType>
+    int32 QueryIntersectedComponents(const BoundType& InBound, UPrimitiveComponent** OutBuffer, int32 BufferCapacity) const
+    {
+        int32 Count = 0;
+        ForEachIntersectedComponent(InBound, [OutBuffer, BufferCapacity, &Count](UPrimitiveComponent* Component)
+            {
+                if (Count < BufferCapacity)
+                {
+                    OutBuffer[Count] = Component;
+                }
+                ++Count;
+            });
+        return Count;
+    }
+
+    // 값 반환 쿼리 (호출마다 배열 할당, 자주 부르는 곳은 위 오버로드 사용)
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FAABB& InBound) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FOBB& InBound) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FBoundingSphere& InBound) const;
 
     void DebugDraw(URenderer* Renderer) const;
 
+    // 쿼리 경로 선택: true면 4-wide SoA 노드(BVH4) + SSE, false면 이진 LBVH 스택리스 순회
+    void SetUseBVH4(bool bInUseBVH4) { bUseBVH4 = bInUseBVH4; }
+    bool IsUsingBVH4() const { return bUseBVH4; }
+
+    // 현재 트리에 들어있는 컴포넌트로 쿼리 세트를 만들어 이진 LBVH / BVH4 쿼리 비용을 비교 (결과는 콘솔 로그)
+    void RunQueryBenchmark(int32 Iterations = 16) const;
+
     // Debug/Stats
     int TotalNodeCount() const;
     int TotalActorCount() const;
     int MaxOccupiedDepth() const;
     void DebugDump() const;
     const FAABB& GetBounds() const { return Bounds; }
+    uint32 GetRebuildCount() const { return RebuildCount; }
+    uint32 GetRefitCount() const { return RefitCount; }
+    uint32 GetLastRefitLeafCount() const { return LastRefitLeafCount; }
+    float GetSAHCost() const;
+    float GetBuiltSAHCost() const { return BuiltSAHCost; }
 
     // 프러스텀 기준으로 오클루더(내부노드 AABB) / 오클루디(리프의 액터들) 수집
     // VP는 행벡터 기준(네 컨벤션): p' = p * VP
@@ -59,15 +115,53 @@ private:
         int32 Right = -1;
         int32 First = -1;
         int32 Count = 0;
+        int32 Parent = -1;
+        int32 Skip = -1;    // 전위 순서에서 이 서브트리 다음 노드 (스택리스 순회용)
         bool IsLeaf() const { return Count > 0; }
     };
     void BuildLBVH();
 
+    // === BVH4 data ===
+    // 이진 LBVH를 접어서 만든 4-wide 노드. 자식 4개의 바운드를 축별 레인(SoA)으로 저장해 SSE 한 번에 검사
+    struct alignas(16) FBVH4Node
+    {
+        float MinX[4];
+        float MinY[4];
+        float MinZ[4];
+        float MaxX[4];
+        float MaxY[4];
+        float MaxZ[4];
+        int32 Child[4];     // 내부 자식: Nodes4 인덱스, 리프 자식: Nodes(이진) 리프 인덱스, 빈 레인: -1
+        uint8 LeafMask = 0;
+        uint8 ValidMask = 0;
+    };
+    void BuildBVH4();
+    int32 CollapseBVH4(int32 BinaryIdx);
+    void SyncBVH4Lane(int32 BinaryIdx);
+    static void SetBVH4Lane(FBVH4Node& Node, int32 Lane, const FAABB& Box);
+
+    // 리프 공용 처리
+    void RayTestLeaf(const FLBVHNode& Leaf, const FRay& Ray, AActor*& OutActor, float& OutBestT) const;
+    void QueryRayClosestBinary(const FRay& Ray, AActor*& OutActor, float& OutBestT) const;
+    void QueryRayClosestBVH4(const FRay& Ray, AActor*& OutActor, float& OutBestT) const;
+
+    template<typename VisibleFunc>
+    void ForEachFrustumVisible(const FFrustum& InFrustum, VisibleFunc OnVisible) const;
+
+    // === Refit ===
+    void MarkLeafDirty(int32 LeafIdx);
+    void Refit();
+    bool RefitLeaf(int32 LeafIdx);
+    float NodeSAHWeight(const FLBVHNode& Node) const;
+    static float SurfaceArea(const FAABB& Box);
+
 private:
-    template<typename BoundType, typename NodeIntersectFunc, typename ComponentIntersectFunc>
-    TArray<UPrimitiveComponent*> QueryIntersectedComponentsGeneric(const BoundType& InBound
+    template<typename BoundType, typename NodeIntersectFunc, typename LaneMaskFunc, typename ComponentIntersectFunc>
+    void QueryIntersectedComponentsGeneric(const BoundType& InBound
         , NodeIntersectFunc NodeIntersects
-        , ComponentIntersectFunc ComponentIntersects) const;
+        , LaneMaskFunc LaneMask
+        , ComponentIntersectFunc ComponentIntersects
+        , TFunctionRef<void(UPrimitiveComponent*)> Visitor) const;
 
     int BuildRange(int s, int e);
 
@@ -81,6 +175,33 @@ private:
 
     // LBVH nodes
     TArray<FLBVHNode> Nodes;
+    // BVH4 nodes (Nodes에서 파생, 0번이 루트)
+    TArray<FBVH4Node> Nodes4;
+    // 이진 노드 -> 그 노드를 레인으로 가진 BVH4 위치 (Node4Idx * 4 + Lane, 접혀서 레인이 없으면 -1)
+    TArray<int32> BinaryToBVH4Lane;
+    bool bUseBVH4 = true;
+
+    // 컴포넌트 -> 소속 리프 노드 인덱스 (Refit 시 리프 역추적용)
+    TMap<UPrimitiveComponent*, int32> ComponentLeafIndex;
+    // Refit 대기 리프 목록 / 중복 방지 플래그 (Nodes와 같은 크기)
+    TArray<int32> DirtyLeaves;
+    TArray<uint8> LeafDirtyFlags;
+    // Remove로 비워진 슬롯 수 (비율이 높아지면 재빌드)
+    int32 RemovedSlotCount = 0;
+
+    // SAH 비용: Σ(내부노드 SA * 순회비용) + Σ(리프 SA * 개수 * 교차비용), 루트 SA로 정규화해서 비교
+    float SAHCostSum = 0.0f;
+    float BuiltSAHCost = 0.0f;
+
+    // Stats
+    uint32 RebuildCount = 0;
+    uint32 RefitCount = 0;
+    uint32 LastRefitLeafCount = 0;
 
     bool bPendingRebuild = false;
+
+    // QueryFrustumParallel 스크래치 (서브트리 루트 목록, 태스크별 결과), capacity 유지용
+    mutable TArray<int32> ParallelCullRoots;
+    mutable TArray<int32> ParallelCullFrontier;
+    mutable TArray<TArray<UPrimitiveComponent*>> ParallelCullResults;
 };
@@ -1,6 +1,7 @@
 ﻿#include "pch.h"
 #include "Octree.h"
 #include "Actor.h"
+#include "SpatialQueryScratch.h"
 
 FOctree::FOctree(const FAABB& InBounds, int InDepth, int InMaxDepth, int InMaxObjects)
 	: Bounds(InBounds), Depth(InDepth), MaxDepth(InMaxDepth), MaxObjects(InMaxObjects)
@@ -440,16 +441,19 @@ void FOctree::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& Out
         return;
 
     // BFS 사용해서 가까운 노드부터 탐색 시작 
-    std::priority_queue<FNodeEntry> Heap;
+    // 스레드별 스크래치 배열 위에서 힙 연산 (호출마다 priority_queue 할당 방지)
+    TSpatialQueryScratch<FNodeEntry> Scratch;
+    TArray<FNodeEntry>& Heap = *Scratch;
     // 레이가 가장 먼저 도착한 노드 부터 탐색 
-    Heap.push({ this, NodeTMin });
+    Heap.push_back({ this, NodeTMin });
 
     const float Epsilon = 1e-3f;
 
     while (!Heap.empty())
     {
-        FNodeEntry Entry = Heap.top();
-        Heap.pop();
+        std::pop_heap(Heap.begin(), Heap.end());
+        const FNodeEntry Entry = Heap.back();
+        Heap.pop_back();
 
         // 이미 더 가까운 정확한 교차가 있으면, 더 먼 노드는 굳이 탐색하지 않고 중단 
         if (OutActor && Entry.TMin > OutBestT + Epsilon)
@@ -520,13 +524,74 @@ void FOctree::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& Out
                 if (Child->Bounds.IntersectsRay(Ray, Cmin, Cmax))
                 {
                     if (!OutActor || Cmin <= OutBestT + Epsilon)
-                        Heap.push({ Child, Cmin });
+                    {
+                        Heap.push_back({ Child, Cmin });
+                        std::push_heap(Heap.begin(), Heap.end());
+                    }
                 }
             }
         }
     }
 }
 
+void FOctree::ForEachIntersectedActor(const FAABB& InBound, TFunctionRef<void(AActor*)> Visitor) const
+{
+    if (!Bounds.Intersects(InBound))
+    {
+        return;
+    }
+
+    TSpatialQueryScratch<const FOctree*> Scratch;
+    TArray<const FOctree*>& Stack = *Scratch;
+    Stack.push_back(this);
+
+    while (!Stack.empty())
+    {
+        const FOctree* Node = Stack.back();
+        Stack.pop_back();
+
+        for (size_t i = 0; i < Node->Actors.size(); ++i)
+        {
+            AActor* Actor = Node->Actors[i];
+            if (!Actor)
+            {
+                continue;
+            }
+            // 바운드 캐시가 없는 액터는 노드 바운드 교차만으로 후보 처리
+            if (i < Node->ActorBoundsCache.size() && !Node->ActorBoundsCache[i].Intersects(InBound))
+            {
+                continue;
+            }
+            Visitor(Actor);
+        }
+
+        if (Node->Children[0])
+        {
+            for (int i = 0; i < 8; ++i)
+            {
+                const FOctree* Child = Node->Children[i];
+                if (Child && Child->Bounds.Intersects(InBound))
+                {
+                    Stack.push_back(Child);
+                }
+            }
+        }
+    }
+}
+
+void FOctree::QueryIntersectedActors(const FAABB& InBound, TArray<AActor*>& OutActors) const
+{
+    OutActors.clear();
+    ForEachIntersectedActor(InBound, [&OutActors](AActor* Actor) { OutActors.push_back(Actor); });
+}
+
+TArray<AActor*> FOctree::QueryIntersectedActors(const FAABB& InBound) const
+{
+    TArray<AActor*> Result;
+    QueryIntersectedActors(InBound, Result);
+    return Result;
+}
+
 void FOctree::DebugDraw(URenderer* InRenderer) const
 {
     if (!InRenderer)
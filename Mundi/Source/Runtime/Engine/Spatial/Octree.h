@@ -49,6 +49,12 @@ public:
 
     void QueryRayClosest(const FRay& Ray, AActor*& OutActor,OUT float& OutBestT);
 
+    // 할당 없는 AABB 쿼리 (방문자 / 호출자 소유 배열, OutActors는 비우고 채움)
+    void ForEachIntersectedActor(const FAABB& InBound, TFunctionRef<void(AActor*)> Visitor) const;
+    void QueryIntersectedActors(const FAABB& InBound, TArray<AActor*>& OutActors) const;
+    // 값 반환 래퍼
+    TArray<AActor*> QueryIntersectedActors(const FAABB& InBound) const;
+
     // Debug draw
     void DebugDraw(URenderer* InRenderer) const;
 
@@ -0,0 +1,50 @@
+﻿#pragma once
+
+/**
+ * @brief 공간 쿼리 순회용 스레드별 스크래치 버퍼
+ * - 스레드마다 버퍼 풀을 두고 capacity를 유지하므로 정상 상태에서는 힙 할당이 없음
+ * - 방문자 안에서 다시 쿼리하는 중첩 호출은 깊이별로 다른 버퍼를 받음
+ * - 스코프 객체로만 사용 (생성 시 비워진 버퍼를 빌리고 소멸 시 반납)
+ */
+template<typename T>
+class TSpatialQueryScratch
+{
+public:
+    TSpatialQueryScratch()
+    {
+        FPool& Pool = GetPool();
+        if (Pool.Depth == static_cast<int32>(Pool.Buffers.size()))
+        {
+            // deque는 뒤에 추가해도 기존 원소 참조가 유지됨
+            Pool.Buffers.emplace_back();
+        }
+        Buffer = &Pool.Buffers[Pool.Depth++];
+        Buffer->clear();
+    }
+
+    ~TSpatialQueryScratch()
+    {
+        --GetPool().Depth;
+    }
+
+    TSpatialQueryScratch(const TSpatialQueryScratch&) = delete;
+    TSpatialQueryScratch& operator=(const TSpatialQueryScratch&) = delete;
+
+    TArray<T>& operator*() { return *Buffer; }
+    TArray<T>* operator->() { return Buffer; }
+
+private:
+    struct FPool
+    {
+        std::deque<TArray<T>> Buffers;
+        int32 Depth = 0;
+    };
+
+    static FPool& GetPool()
+    {
+        thread_local FPool Pool;
+        return Pool;
+    }
+
+    TArray<T>* Buffer = nullptr;
+};
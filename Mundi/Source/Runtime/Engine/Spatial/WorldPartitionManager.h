@@ -35,6 +35,13 @@ public:
 
 	void Update(float DeltaTime, const uint32 BudgetCount = 256);
 
+	// 더티 큐에 남아 BVH 바운드가 아직 갱신되지 않은 컴포넌트인지 (렌더 스레드 읽기 전용)
+	bool IsPendingUpdate(UPrimitiveComponent* Component) const { return ComponentDirtySet.find(Component) != ComponentDirtySet.end(); }
+
+	// 스태틱 메시의 등록/해제/바운드 변경/BVH 반영이 있을 때마다 증가
+	// (BVH 쿼리 결과를 프레임 간에 캐시하는 쪽이 값 비교로 무효화 여부를 판단)
+	uint64 GetStaticBoundsRevision() const { return StaticBoundsRevision; }
+
     //void RayQueryOrdered(FRay InRay, OUT TArray<std::pair<AActor*, float>>& Candidates);
     void RayQueryClosest(FRay InRay, OUT AActor*& OutActor, OUT float& OutBestT);
 	void FrustumQuery(FFrustum InFrustum);
@@ -56,6 +63,7 @@ private:
 	
 	TQueue<UPrimitiveComponent*> ComponentDirtyQueue; // 추가 혹은 갱신이 필요한 요소의 대기 큐
 	TSet<UPrimitiveComponent*> ComponentDirtySet;     // 더티 큐 중복 추가를 막기 위한 Set
+	uint64 StaticBoundsRevision = 0;
 	FOctree* SceneOctree = nullptr;
 	FBVHierarchy* BVH = nullptr;
 };
@@ -211,7 +211,8 @@ struct ColorBufferType // b3
 {
     FLinearColor Color;
     uint32 UUID;
-    FVector Padding;
+    uint32 InstanceOffset; // 자동 인스턴싱 드로우의 인스턴스 버퍼 시작 위치 (UberLit USE_INSTANCING)
+    FVector2D Padding;
 };
 
 struct FLightBufferType
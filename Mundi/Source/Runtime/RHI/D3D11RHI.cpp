@@ -68,6 +68,7 @@ void D3D11RHI::Release()
     if (DepthStencilStateAlwaysNoWrite) { DepthStencilStateAlwaysNoWrite->Release(); DepthStencilStateAlwaysNoWrite = nullptr; }
     if (DepthStencilStateDisable) { DepthStencilStateDisable->Release(); DepthStencilStateDisable = nullptr; }
     if (DepthStencilStateGreaterEqualWrite) { DepthStencilStateGreaterEqualWrite->Release(); DepthStencilStateGreaterEqualWrite = nullptr; }
+    if (DepthStencilStateAlwaysWrite) { DepthStencilStateAlwaysWrite->Release(); DepthStencilStateAlwaysWrite = nullptr; }
     if (DepthStencilStateOverlayWriteStencil) { DepthStencilStateOverlayWriteStencil->Release(); DepthStencilStateOverlayWriteStencil = nullptr; }
     if (DepthStencilStateStencilRejectOverlay) { DepthStencilStateStencilRejectOverlay->Release(); DepthStencilStateStencilRejectOverlay = nullptr; }
 
@@ -227,6 +228,14 @@ void D3D11RHI::CreateDepthStencilState()
     desc.FrontFace.StencilFunc = D3D11_COMPARISON_EQUAL; // pass only when stencil==ref
     desc.BackFace = desc.FrontFace;
     Device->CreateDepthStencilState(&desc, &DepthStencilStateStencilRejectOverlay);
+
+    // 8) AlwaysWrite: Always + Write ALL (픽셀 셰이더가 SV_Depth로 깊이를 그대로 복사할 때)
+    ZeroMemory(&desc, sizeof(desc));
+    desc.DepthEnable = TRUE;
+    desc.DepthWriteMask = D3D11_DEPTH_WRITE_MASK_ALL;
+    desc.DepthFunc = D3D11_COMPARISON_ALWAYS;
+    desc.StencilEnable = FALSE;
+    Device->CreateDepthStencilState(&desc, &DepthStencilStateAlwaysWrite);
 }
 
 void D3D11RHI::CreateSamplerState()
@@ -1196,6 +1205,9 @@ void D3D11RHI::OMSetDepthStencilState(EComparisonFunc Func)
     case EComparisonFunc::Disable:
 		DeviceContext->OMSetDepthStencilState(DepthStencilStateDisable, 0);
         break;
+    case EComparisonFunc::AlwaysWrite:
+        DeviceContext->OMSetDepthStencilState(DepthStencilStateAlwaysWrite, 0);
+        break;
     }
 }
 
@@ -159,6 +159,9 @@ void FLightManager::Initialize(D3D11RHI* RHIDevice, uint32 InShadowAtlasSize2D,
 		}
 	}
 
+	// --- 4. 정적 캐스터 섀도우 캐시 (라이브 아틀라스와 같은 크기/포맷) ---
+	ShadowMapCache.Initialize(RHIDevice->GetDevice(), ShadowAtlasTexture2D, ShadowAtlasTextureCube);
+
 	if (!VSMShadowAtlasSRV2D)
 	{
 		D3D11_TEXTURE2D_DESC VSMDesc = {};
@@ -261,6 +264,9 @@ void FLightManager::Release()
 	ShadowCubeFaceSRVs.clear();
 	if (ShadowAtlasTextureCube) { ShadowAtlasTextureCube->Release(); ShadowAtlasTextureCube = nullptr; }
 
+	// Static Shadow Cache Release
+	ShadowMapCache.Release();
+
 	if (VSMShadowAtlasRTV2D)
 	{
 		VSMShadowAtlasRTV2D->Release();
@@ -657,6 +663,8 @@ void FLightManager::ClearAllLightList()
 
 	ShadowDataCache2D.clear();
 	ShadowDataCacheCube.clear();
+	ShadowCasterCache.Clear();
+	ShadowMapCache.Clear();
 }
 
 template<typename T>
@@ -741,6 +749,8 @@ void FLightManager::DeRegisterLight<UDirectionalLightComponent>(UDirectionalLigh
 	bHaveToUpdate = true;
 
 	ShadowDataCache2D.Remove(LightComponent);
+	ShadowCasterCache.RemoveLight(LightComponent);
+	ShadowMapCache.RemoveLight(LightComponent);
 }
 template<>
 void FLightManager::DeRegisterLight<UPointLightComponent>(UPointLightComponent* LightComponent)
@@ -757,6 +767,8 @@ void FLightManager::DeRegisterLight<UPointLightComponent>(UPointLightComponent*
 	bHaveToUpdate = true;
 
 	ShadowDataCacheCube.Remove(LightComponent);
+	ShadowCasterCache.RemoveLight(LightComponent);
+	ShadowMapCache.RemoveLight(LightComponent);
 }
 template<>
 void FLightManager::DeRegisterLight<USpotLightComponent>(USpotLightComponent* LightComponent)
@@ -772,6 +784,8 @@ void FLightManager::DeRegisterLight<USpotLightComponent>(USpotLightComponent* Li
 	bHaveToUpdate = true;
 
 	ShadowDataCache2D.Remove(LightComponent);
+	ShadowCasterCache.RemoveLight(LightComponent);
+	ShadowMapCache.RemoveLight(LightComponent);
 }
 
 
@@ -790,6 +804,8 @@ template<> void FLightManager::UpdateLight<UDirectionalLightComponent>(UDirectio
 		return;
 	}
 	bHaveToUpdate = true;
+
+	ShadowMapCache.InvalidateLight(LightComponent);
 }
 template<> void FLightManager::UpdateLight<UPointLightComponent>(UPointLightComponent* LightComponent)
 {
@@ -800,6 +816,8 @@ template<> void FLightManager::UpdateLight<UPointLightComponent>(UPointLightComp
 	}
 	bPointLightDirty = true;
 	bHaveToUpdate = true;
+
+	ShadowMapCache.InvalidateLight(LightComponent);
 }
 template<> void FLightManager::UpdateLight<USpotLightComponent>(USpotLightComponent* LightComponent)
 {
@@ -809,4 +827,6 @@ template<> void FLightManager::UpdateLight<USpotLightComponent>(USpotLightCompon
 	}
 	bSpotLightDirty = true;
 	bHaveToUpdate = true;
+
+	ShadowMapCache.InvalidateLight(LightComponent);
 }
\ No newline at end of file
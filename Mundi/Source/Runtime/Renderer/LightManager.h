@@ -1,4 +1,6 @@
 ﻿#pragma once
+#include "ShadowCasterCache.h"
+#include "ShadowMapCache.h"
 #define CASCADED_MAX 8
 
 class UAmbientLightComponent;
@@ -150,9 +152,12 @@ public:
     bool GetCachedShadowData(ULightComponent* Light, int32 SubViewIndex, FShadowMapData& OutData) const;
     bool GetCachedShadowCubeSliceIndex(ULightComponent* Light, int32& OutSliceIndex) const;
     ID3D11ShaderResourceView* GetShadowAtlasSRVCube() const { return ShadowAtlasSRVCube; }
+    ID3D11Texture2D* GetShadowAtlasTextureCube() const { return ShadowAtlasTextureCube; }
     ID3D11ShaderResourceView* GetShadowCubeFaceSRV(UINT SliceIndex, UINT FaceIndex) const; // Cube의 각 면을 2D SRV로 반환
 
     void ClearAllDepthStencilView(D3D11RHI* RHIDevice);
+    FShadowCasterCache& GetShadowCasterCache() { return ShadowCasterCache; }
+    FShadowMapCache& GetShadowMapCache() { return ShadowMapCache; }
     ID3D11RenderTargetView* GetVSMShadowAtlasRTV2D() const { return VSMShadowAtlasRTV2D; }
 
     void AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D);
@@ -208,6 +213,10 @@ private:
     TMap<ULightComponent*, TArray<FShadowMapData>> ShadowDataCache2D;
     // Key: 라이트, Value: 할당된 큐브맵 슬라이스 인덱스
     TMap<ULightComponent*, int32> ShadowDataCacheCube;
+    // 섀도우 요청별 BVH 캐스터 후보 (라이트/스태틱 캐스터가 움직이지 않으면 재사용)
+    FShadowCasterCache ShadowCasterCache;
+    // 섀도우 요청별 정적 캐스터 깊이 레이어 (라이트/정적 캐스터가 그대로면 다시 그리지 않고 복사)
+    FShadowMapCache ShadowMapCache;
 
 
     //structured buffer
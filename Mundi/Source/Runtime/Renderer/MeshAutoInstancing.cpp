@@ -0,0 +1,108 @@
+﻿#include "pch.h"
+#include "MeshAutoInstancing.h"
+#include "MeshBatchElement.h"
+
+FMeshInstancingStats FMeshAutoInstancing::FrameStats;
+
+bool FMeshAutoInstancing::CanInstance(const FMeshBatchElement& Batch)
+{
+	// 이미 인스턴싱된 파티클, GPU 스키닝, 빌보드/SubUV 배치는 제외
+	return Batch.InstancedVertexShader && Batch.InstancedPixelShader && Batch.InstancedInputLayout &&
+		Batch.PixelShader && Batch.VertexBuffer && Batch.IndexBuffer && Batch.VertexStride > 0 &&
+		!Batch.bInstancedDraw &&
+		!Batch.GPUSkinMatrixSRV &&
+		Batch.ScreenAlignment == EScreenAlignment::None &&
+		Batch.SubImages_Horizontal <= 1 && Batch.SubImages_Vertical <= 1;
+}
+
+bool FMeshAutoInstancing::CanMerge(const FMeshBatchElement& First, const FMeshBatchElement& Other)
+{
+	return CanInstance(Other) &&
+		First.InstancedVertexShader == Other.InstancedVertexShader &&
+		First.InstancedPixelShader == Other.InstancedPixelShader &&
+		First.InstancedInputLayout == Other.InstancedInputLayout &&
+		First.PixelShader == Other.PixelShader &&
+		First.Material == Other.Material &&
+		First.InstanceShaderResourceView == Other.InstanceShaderResourceView &&
+		First.InstanceNormalSRV == Other.InstanceNormalSRV &&
+		First.VertexBuffer == Other.VertexBuffer &&
+		First.IndexBuffer == Other.IndexBuffer &&
+		First.VertexStride == Other.VertexStride &&
+		First.PrimitiveTopology == Other.PrimitiveTopology &&
+		First.IndexCount == Other.IndexCount &&
+		First.StartIndex == Other.StartIndex &&
+		First.BaseVertexIndex == Other.BaseVertexIndex &&
+		First.InstanceColor == Other.InstanceColor &&
+		First.bUseWindAnimation == Other.bUseWindAnimation &&
+		First.WindMeshHeight == Other.WindMeshHeight &&
+		First.SortPriority == Other.SortPriority;
+}
+
+int32 FMeshAutoInstancing::MergeInstancedRuns(TFrameArray<FMeshBatchElement>& InOutBatches, const TFrameArray<uint32>& InSortedOrder,
+	TFrameArray<uint32>& OutDrawOrder, TFrameArray<FMeshInstanceData>& OutInstances)
+{
+	OutDrawOrder.Empty();
+	OutInstances.Empty();
+	OutDrawOrder.reserve(InSortedOrder.Num());
+
+	int32 NumInstancedDraws = 0;
+	const int32 NumSorted = InSortedOrder.Num();
+	int32 RunStart = 0;
+	while (RunStart < NumSorted)
+	{
+		const uint32 FirstIndex = InSortedOrder[RunStart];
+		int32 RunEnd = RunStart + 1;
+		if (CanInstance(InOutBatches[FirstIndex]))
+		{
+			while (RunEnd < NumSorted && CanMerge(InOutBatches[FirstIndex], InOutBatches[InSortedOrder[RunEnd]]))
+			{
+				++RunEnd;
+			}
+		}
+
+		if (RunEnd - RunStart < MinInstancesPerDraw)
+		{
+			for (int32 OrderIndex = RunStart; OrderIndex < RunEnd; ++OrderIndex)
+			{
+				OutDrawOrder.Add(InSortedOrder[OrderIndex]);
+			}
+			RunStart = RunEnd;
+			continue;
+		}
+
+		// 첫 배치를 복사해 인스턴스 드로우로 바꾼다 (Add가 재할당할 수 있으므로 참조 대신 복사)
+		FMeshBatchElement Merged = InOutBatches[FirstIndex];
+		Merged.VertexShader = Merged.InstancedVertexShader;
+		Merged.PixelShader = Merged.InstancedPixelShader;
+		Merged.InputLayout = Merged.InstancedInputLayout;
+		Merged.bInstancedDraw = true;
+		Merged.InstanceVertexBuffer = nullptr;
+		Merged.InstanceStride = 0;
+		Merged.InstanceStart = static_cast<uint32>(OutInstances.Num());
+		Merged.InstanceCount = static_cast<uint32>(RunEnd - RunStart);
+
+		for (int32 OrderIndex = RunStart; OrderIndex < RunEnd; ++OrderIndex)
+		{
+			const FMeshBatchElement& Batch = InOutBatches[InSortedOrder[OrderIndex]];
+			FMeshInstanceData& Instance = OutInstances.emplace_back();
+			Instance.WorldMatrix = Batch.WorldMatrix;
+			Instance.WorldInverseTranspose = Batch.WorldMatrix.InverseAffine().Transpose();
+			Instance.ObjectID = Batch.ObjectID;
+		}
+
+		OutDrawOrder.Add(static_cast<uint32>(InOutBatches.Num()));
+		InOutBatches.Add(Merged);
+		++NumInstancedDraws;
+		RunStart = RunEnd;
+	}
+
+	return NumInstancedDraws;
+}
+
+void FMeshAutoInstancing::AddFrameStats(uint32 DrawsBefore, uint32 DrawsAfter, uint32 InstancedDraws, uint32 InstancedBatches)
+{
+	FrameStats.DrawsBeforeInstancing += DrawsBefore;
+	FrameStats.DrawsAfterInstancing += DrawsAfter;
+	FrameStats.InstancedDraws += InstancedDraws;
+	FrameStats.InstancedBatches += InstancedBatches;
+}
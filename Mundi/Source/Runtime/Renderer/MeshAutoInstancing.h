@@ -0,0 +1,66 @@
+﻿#pragma once
+
+struct FMeshBatchElement;
+
+/** 인스턴스 버퍼(t14) 원소. UberLit.hlsl의 FInstanceData와 정확히 일치해야 함 (144 bytes) */
+struct alignas(16) FMeshInstanceData
+{
+	FMatrix WorldMatrix;
+	FMatrix WorldInverseTranspose;
+	uint32 ObjectID = 0;
+	uint32 Padding[3] = {};
+};
+static_assert(sizeof(FMeshInstanceData) == 144, "FMeshInstanceData must match FInstanceData in UberLit.hlsl");
+
+/** 프레임별 드로우 콜 통계 (인스턴싱 전/후) */
+struct FMeshInstancingStats
+{
+	uint32 DrawsBeforeInstancing = 0;
+	uint32 DrawsAfterInstancing = 0;
+	uint32 InstancedDraws = 0;		// 합쳐진 인스턴스 드로우 수
+	uint32 InstancedBatches = 0;	// 인스턴스 드로우로 합쳐진 원래 배치 수
+
+	void Reset()
+	{
+		DrawsBeforeInstancing = 0;
+		DrawsAfterInstancing = 0;
+		InstancedDraws = 0;
+		InstancedBatches = 0;
+	}
+};
+
+/**
+ * @brief 정렬된 배치 목록에서 같은 메시/머티리얼/셰이더가 연속된 구간을 인스턴스 드로우 하나로 합친다
+ * - 정렬 키가 (프로그램, 머티리얼, 버퍼) 순이라 합칠 수 있는 배치는 정렬 후 연속해서 나온다
+ * - InstancedVertexShader가 있는 배치만 대상 (셰이더가 USE_INSTANCING 변형을 지원해야 함)
+ * - 디바이스를 쓰지 않는 CPU 로직: 합친 드로우는 배치 배열 뒤에 추가하고, 인스턴스 데이터는 OutInstances에 모은다
+ *   (GPU 업로드와 InstanceDataSRV 지정은 호출 측 몫)
+ */
+class FMeshAutoInstancing
+{
+public:
+	/** 이보다 짧은 구간은 합치지 않고 원래 드로우로 그린다 */
+	static constexpr int32 MinInstancesPerDraw = 2;
+
+	static bool CanInstance(const FMeshBatchElement& Batch);
+
+	/** 월드 행렬/오브젝트 ID를 뺀 모든 드로우 상태가 같으면 true */
+	static bool CanMerge(const FMeshBatchElement& First, const FMeshBatchElement& Other);
+
+	/**
+	 * @param InOutBatches	수집한 배치. 합친 드로우가 뒤에 추가됨 (원래 배치는 그대로)
+	 * @param InSortedOrder	SortMeshBatches 결과
+	 * @param OutDrawOrder	그릴 순서 (합쳐지지 않은 원래 배치 인덱스 + 추가된 인스턴스 드로우 인덱스)
+	 * @param OutInstances	인스턴스 드로우가 InstanceStart부터 InstanceCount개 읽을 데이터
+	 * @return 합쳐진 인스턴스 드로우 수
+	 */
+	static int32 MergeInstancedRuns(TFrameArray<FMeshBatchElement>& InOutBatches, const TFrameArray<uint32>& InSortedOrder,
+		TFrameArray<uint32>& OutDrawOrder, TFrameArray<FMeshInstanceData>& OutInstances);
+
+	static void ResetFrameStats() { FrameStats.Reset(); }
+	static void AddFrameStats(uint32 DrawsBefore, uint32 DrawsAfter, uint32 InstancedDraws, uint32 InstancedBatches);
+	static const FMeshInstancingStats& GetFrameStats() { return FrameStats; }
+
+private:
+	static FMeshInstancingStats FrameStats;
+};
@@ -0,0 +1,225 @@
+﻿#include "pch.h"
+#include "MeshAutoInstancingBenchmark.h"
+#include "MeshAutoInstancing.h"
+#include "MeshDrawSortKey.h"
+#include "MeshBatchElement.h"
+#include "PlatformTime.h"
+#include <random>
+
+namespace
+{
+	template<typename T>
+	T* FakePointer(uint32 Slot, uint32 Salt)
+	{
+		// 역참조하지 않는 비교 전용 주소
+		return reinterpret_cast<T*>(static_cast<uintptr_t>(Salt) * 0x100000 + (static_cast<uintptr_t>(Slot) + 1) * 64);
+	}
+
+	/** CanInstance를 통과하는 배치 (Mesh/Material 슬롯이 같으면 CanMerge도 통과) */
+	FMeshBatchElement MakeBatch(uint32 Mesh, uint32 Material, uint32 ObjectID, bool bInstanceable = true)
+	{
+		FMeshBatchElement Batch;
+		Batch.VertexShader = FakePointer<ID3D11VertexShader>(0, 1);
+		Batch.PixelShader = FakePointer<ID3D11PixelShader>(0, 2);
+		Batch.Material = FakePointer<UMaterialInterface>(Material, 3);
+		Batch.VertexBuffer = FakePointer<ID3D11Buffer>(Mesh, 4);
+		Batch.IndexBuffer = FakePointer<ID3D11Buffer>(Mesh, 5);
+		Batch.VertexStride = 48;
+		Batch.IndexCount = 36;
+		Batch.ObjectID = ObjectID;
+		Batch.WorldMatrix = FMatrix::Identity();
+		Batch.WorldMatrix.M[3][0] = static_cast<float>(ObjectID);
+		if (bInstanceable)
+		{
+			Batch.InstancedVertexShader = FakePointer<ID3D11VertexShader>(0, 6);
+			Batch.InstancedPixelShader = FakePointer<ID3D11PixelShader>(0, 7);
+			Batch.InstancedInputLayout = FakePointer<ID3D11InputLayout>(0, 8);
+		}
+		return Batch;
+	}
+
+	/**
+	 * 정해진 정렬 순서로 MergeInstancedRuns를 돌려 결과를 기대값과 비교
+	 * @param ExpectedDraws		0 이상: 그대로 그리는 원래 배치 인덱스, 음수 -N: 인스턴스 N개짜리 합친 드로우
+	 * @param ExpectedObjectIDs	OutInstances에 쌓여야 하는 ObjectID 순서
+	 */
+	bool RunCase(const char* Name, const TArray<FMeshBatchElement>& Source, std::initializer_list<uint32> Order,
+		std::initializer_list<int32> ExpectedDraws, std::initializer_list<uint32> ExpectedObjectIDs)
+	{
+		TFrameArray<FMeshBatchElement> Batches(Source.begin(), Source.end());
+		TFrameArray<uint32> SortedOrder(Order.begin(), Order.end());
+		TFrameArray<uint32> DrawOrder;
+		TFrameArray<FMeshInstanceData> Instances;
+		const int32 NumSource = Batches.Num();
+
+		const int32 NumInstancedDraws = FMeshAutoInstancing::MergeInstancedRuns(Batches, SortedOrder, DrawOrder, Instances);
+
+		const char* Failure = nullptr;
+		int32 ExpectedInstancedDraws = 0;
+		uint32 NextInstance = 0;
+		if (DrawOrder.Num() != static_cast<int32>(ExpectedDraws.size()))
+		{
+			Failure = "draw count";
+		}
+		else
+		{
+			int32 DrawIndex = 0;
+			for (int32 Expected : ExpectedDraws)
+			{
+				const uint32 Drawn = DrawOrder[DrawIndex++];
+				if (Expected >= 0)
+				{
+					if (Drawn != static_cast<uint32>(Expected) || Batches[Drawn].bInstancedDraw)
+					{
+						Failure = "plain draw order";
+						break;
+					}
+					continue;
+				}
+
+				// 합친 드로우는 원래 배치 뒤에 추가되고, 인스턴스 구간은 앞 드로우에 이어서 붙어야 함
+				++ExpectedInstancedDraws;
+				const FMeshBatchElement& Merged = Batches[Drawn];
+				if (static_cast<int32>(Drawn) < NumSource || !Merged.bInstancedDraw ||
+					Merged.InstanceStart != NextInstance || Merged.InstanceCount != static_cast<uint32>(-Expected) ||
+					Merged.VertexShader != Merged.InstancedVertexShader)
+				{
+					Failure = "instanced draw";
+					break;
+				}
+				// 첫 인스턴스의 원래 배치와 머티리얼이 같아야 함 (ObjectID - 1 = 원래 배치 인덱스)
+				if (Merged.InstanceStart < static_cast<uint32>(Instances.Num()) &&
+					Merged.Material != Source[Instances[Merged.InstanceStart].ObjectID - 1].Material)
+				{
+					Failure = "instanced material";
+					break;
+				}
+				NextInstance += Merged.InstanceCount;
+			}
+		}
+
+		if (!Failure && (NumInstancedDraws != ExpectedInstancedDraws || Batches.Num() != NumSource + ExpectedInstancedDraws))
+		{
+			Failure = "instanced draw count";
+		}
+		if (!Failure)
+		{
+			if (Instances.Num() != static_cast<int32>(ExpectedObjectIDs.size()))
+			{
+				Failure = "instance count";
+			}
+			else
+			{
+				int32 InstanceIndex = 0;
+				for (uint32 ObjectID : ExpectedObjectIDs)
+				{
+					const FMeshInstanceData& Instance = Instances[InstanceIndex++];
+					if (Instance.ObjectID != ObjectID || Instance.WorldMatrix.M[3][0] != static_cast<float>(ObjectID))
+					{
+						Failure = "instance data";
+						break;
+					}
+				}
+			}
+		}
+
+		char Buf[256];
+		std::snprintf(Buf, sizeof(Buf), "[Instancing Bench] case %-22s %s%s\r\n", Name, Failure ? "FAIL: " : "ok", Failure ? Failure : "");
+		UE_LOG(Buf);
+		return Failure == nullptr;
+	}
+
+	bool RunCases()
+	{
+		bool bAllPassed = true;
+
+		// 키가 번갈아 나오면 (A B A B) 연속 구간이 없으므로 하나도 합치지 않음, 정렬로 모으면 둘씩 합침
+		{
+			TArray<FMeshBatchElement> Source;
+			Source.Add(MakeBatch(0, 0, 1));
+			Source.Add(MakeBatch(1, 0, 2));
+			Source.Add(MakeBatch(0, 0, 3));
+			Source.Add(MakeBatch(1, 0, 4));
+			bAllPassed &= RunCase("interleaved", Source, { 0, 1, 2, 3 }, { 0, 1, 2, 3 }, {});
+			bAllPassed &= RunCase("interleaved-sorted", Source, { 0, 2, 1, 3 }, { -2, -2 }, { 1, 3, 2, 4 });
+		}
+
+		// 같은 메시라도 머티리얼이 바뀌는 지점에서 구간이 끊겨야 함
+		{
+			TArray<FMeshBatchElement> Source;
+			Source.Add(MakeBatch(0, 0, 1));
+			Source.Add(MakeBatch(0, 0, 2));
+			Source.Add(MakeBatch(0, 0, 3));
+			Source.Add(MakeBatch(0, 1, 4));
+			Source.Add(MakeBatch(0, 1, 5));
+			bAllPassed &= RunCase("material-break", Source, { 0, 1, 2, 3, 4 }, { -3, -2 }, { 1, 2, 3, 4, 5 });
+		}
+
+		// 길이 1인 구간(앞/뒤)과 인스턴싱 셰이더가 없는 배치는 원래 드로우로 남음
+		{
+			TArray<FMeshBatchElement> Source;
+			Source.Add(MakeBatch(0, 0, 1));
+			Source.Add(MakeBatch(1, 0, 2));
+			Source.Add(MakeBatch(1, 0, 3));
+			Source.Add(MakeBatch(2, 0, 4));
+			bAllPassed &= RunCase("single-element-run", Source, { 0, 1, 2, 3 }, { 0, -2, 3 }, { 2, 3 });
+
+			Source.Add(MakeBatch(1, 0, 5, false));
+			Source.Add(MakeBatch(1, 0, 6));
+			bAllPassed &= RunCase("non-instanceable-break", Source, { 1, 2, 4, 5 }, { -2, 4, 5 }, { 2, 3 });
+		}
+
+		return bAllPassed;
+	}
+}
+
+void FMeshAutoInstancingBenchmark::Run(int32 Iterations)
+{
+	const bool bCasesPassed = RunCases();
+	UE_LOG(bCasesPassed ? "[Instancing Bench] all cases passed\r\n" : "[Instancing Bench] CASE FAILURE (see above)\r\n");
+
+	std::mt19937 Rng(12345);
+	std::uniform_int_distribution<uint32> MeshDist(0, 63);
+	std::uniform_int_distribution<uint32> MaterialDist(0, 15);
+	std::uniform_real_distribution<float> PositionDist(-500.0f, 500.0f);
+	const int32 BatchCounts[] = { 10000, 30000, 100000 };
+	const FVector ViewOrigin(0.0f, 0.0f, 0.0f);
+
+	for (int32 NumBatches : BatchCounts)
+	{
+		TFrameArray<FMeshBatchElement> Batches;
+		Batches.reserve(NumBatches + NumBatches / 2);
+		for (int32 BatchIndex = 0; BatchIndex < NumBatches; ++BatchIndex)
+		{
+			FMeshBatchElement Batch = MakeBatch(MeshDist(Rng), MaterialDist(Rng), static_cast<uint32>(BatchIndex + 1));
+			Batch.WorldMatrix.M[3][0] = PositionDist(Rng);
+			Batch.WorldMatrix.M[3][1] = PositionDist(Rng);
+			Batch.WorldMatrix.M[3][2] = PositionDist(Rng);
+			Batches.Add(Batch);
+		}
+
+		TFrameArray<uint32> SortedOrder;
+		SortedOrder.SetNum(NumBatches);
+		FMeshDrawSort::SortBatches(Batches.data(), NumBatches, ViewOrigin, EMeshDrawDepthOrder::FrontToBack, SortedOrder.data());
+
+		// 프레임 아레나를 반복마다 새로 잡지 않도록 배열은 재사용 (합친 드로우만 잘라냄)
+		TFrameArray<uint32> DrawOrder;
+		TFrameArray<FMeshInstanceData> Instances;
+		int32 NumInstancedDraws = 0;
+		double MergeMs = 0.0;
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			Batches.resize(NumBatches);
+			const uint64 Start = FPlatformTime::Cycles64();
+			NumInstancedDraws = FMeshAutoInstancing::MergeInstancedRuns(Batches, SortedOrder, DrawOrder, Instances);
+			MergeMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+		}
+		MergeMs /= Iterations;
+
+		char Buf[512];
+		std::snprintf(Buf, sizeof(Buf),
+			"[Instancing Bench] %6d batches | merge %7.3f ms | draws %d -> %d (%d instanced draws, %d instances)\r\n",
+			NumBatches, MergeMs, NumBatches, DrawOrder.Num(), NumInstancedDraws, Instances.Num());
+		UE_LOG(Buf);
+	}
+}
@@ -0,0 +1,13 @@
+﻿#pragma once
+
+/**
+ * @brief 자동 인스턴싱 구간 병합(FMeshAutoInstancing::MergeInstancedRuns) 검증 + 비용 측정
+ * - 검증: 키가 번갈아 나오는 순서, 머티리얼 경계, 길이 1인 구간을 손으로 만든 배치로 돌려 드로우 순서/인스턴스 데이터를 확인
+ * - 측정: 10k/30k/100k 합성 배치 (메시 64종 x 머티리얼 16종, 기수 정렬 후)의 병합 시간과 드로우 수 감소
+ * - 콘솔 명령 "BENCH INSTANCING"으로 실행, 결과는 UE_LOG로 출력
+ */
+class FMeshAutoInstancingBenchmark
+{
+public:
+	static void Run(int32 Iterations = 10);
+};
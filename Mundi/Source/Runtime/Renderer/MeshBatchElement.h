@@ -30,6 +30,9 @@ struct FMeshBatchElement
 	// 프리미티브 토폴로지입니다. (TriangleList, LineList 등)
 	D3D11_PRIMITIVE_TOPOLOGY PrimitiveTopology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
 
+	// 위 키들을 압축한 64비트 정렬 키입니다. (FMeshDrawSort::BuildSortKeys가 채움, MeshDrawSortKey.h 참고)
+	uint64 SortKey = 0;
+
 
 	// --- 2. 드로우 데이터 (Draw Data) ---
 	// DrawIndexed() 호출에 직접 사용되는 파라미터입니다.
@@ -96,6 +99,14 @@ struct FMeshBatchElement
 	uint32 InstanceCount = 0;
 	uint32 InstanceStart = 0;
 
+	// 자동 인스턴싱 (FMeshAutoInstancing, MeshAutoInstancing.h 참고)
+	// 같은 메시/머티리얼 배치를 합칠 때 쓸 인스턴싱 셰이더 변형입니다. (없으면 합치지 않음)
+	ID3D11VertexShader* InstancedVertexShader = nullptr;
+	ID3D11PixelShader* InstancedPixelShader = nullptr;
+	ID3D11InputLayout* InstancedInputLayout = nullptr;
+	// 합친 드로우가 읽는 인스턴스 데이터(t14)입니다. InstanceStart부터 InstanceCount개를 읽습니다.
+	ID3D11ShaderResourceView* InstanceDataSRV = nullptr;
+
 	// --- 기본 생성자 ---
 	FMeshBatchElement() = default;
 
@@ -103,6 +114,7 @@ struct FMeshBatchElement
 	 * @brief FMeshBatchElement 정렬을 위한 'less than' 연산자입니다.
 	 * TArray::Sort()가 A < B 를 비교하기 위해 이 함수를 호출합니다.
 	 * GPU 상태 변경을 최소화하는 순서로 정렬 키를 비교합니다.
+	 * 렌더 패스는 SortKey 기수 정렬(FMeshDrawSort)을 쓰며, 이 비교는 벤치마크 기준용으로 남겨 둡니다.
 	 */
 	bool operator<(const FMeshBatchElement& B) const
 	{
@@ -0,0 +1,71 @@
+﻿#include "pch.h"
+#include "MeshDrawCommandCache.h"
+#include "MeshBatchElement.h"
+#include "Material.h"
+#include "Shader.h"
+
+FMeshDrawCommandCache::FMeshDrawCommandCache() = default;
+FMeshDrawCommandCache::~FMeshDrawCommandCache() = default;
+
+FMeshDrawCommandCache::FMeshDrawCommandCache(const FMeshDrawCommandCache&)
+{
+}
+
+FMeshDrawCommandCache& FMeshDrawCommandCache::operator=(const FMeshDrawCommandCache&)
+{
+	Invalidate();
+	return *this;
+}
+
+bool FMeshDrawCommandCache::IsValid(uint64 InViewShaderMacroKey, const TArray<UMaterialInterface*>& MaterialSlots) const
+{
+	if (bDirty || ViewShaderMacroKey != InViewShaderMacroKey || ShaderGeneration != UShader::GetReloadGeneration())
+	{
+		return false;
+	}
+
+	if (SlotMaterials != MaterialSlots)
+	{
+		return false;
+	}
+
+	// 머티리얼 애셋의 셰이더가 바뀐 경우 (에디터에서 교체 등)
+	for (int32 BatchIndex = 0; BatchIndex < Batches.Num(); ++BatchIndex)
+	{
+		if (Batches[BatchIndex].Material->GetShader() != BatchShaders[BatchIndex])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FMeshDrawCommandCache::BeginBuild(uint64 InViewShaderMacroKey, const TArray<UMaterialInterface*>& MaterialSlots)
+{
+	Batches.Empty();
+	BatchShaders.Empty();
+	SlotMaterials = MaterialSlots;
+	ViewShaderMacroKey = InViewShaderMacroKey;
+	ShaderGeneration = UShader::GetReloadGeneration();
+}
+
+void FMeshDrawCommandCache::AddBatch(const FMeshBatchElement& Batch, UShader* Shader)
+{
+	Batches.Add(Batch);
+	BatchShaders.Add(Shader);
+}
+
+void FMeshDrawCommandCache::EndBuild()
+{
+	bDirty = false;
+}
+
+void FMeshDrawCommandCache::AppendTo(TFrameArray<FMeshBatchElement>& OutMeshBatchElements)
+{
+	for (FMeshBatchElement& Batch : Batches)
+	{
+		Batch.bUseWindAnimation = Batch.Material->IsWindAnimationEnabled();
+		Batch.WindMeshHeight = Batch.Material->GetWindMeshHeight();
+	}
+	OutMeshBatchElements.insert(OutMeshBatchElements.end(), Batches.begin(), Batches.end());
+}
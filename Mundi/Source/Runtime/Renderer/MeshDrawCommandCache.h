@@ -0,0 +1,46 @@
+﻿#pragma once
+
+struct FMeshBatchElement;
+class UShader;
+class UMaterialInterface;
+
+/**
+ * @brief 컴포넌트별 드로우 커맨드(FMeshBatchElement) 캐시
+ * - 매 프레임 같은 배치를 만드는 컴포넌트(스태틱 메시)가 한 번 만든 배치를 보관하고, 유효하면 복사만 한다
+ * - 무효화: Invalidate() (메시/머티리얼/트랜스폼 변경), 뷰 셰이더 매크로 변경, 셰이더 핫 리로드,
+ *   머티리얼 슬롯 변경 (에디터 프로퍼티 편집처럼 SetMaterial을 거치지 않는 경우), 머티리얼 셰이더 교체
+ * - 배치는 일반 힙 배열에 보관 (프레임 아레나는 매 프레임 비워지므로 쓰지 않음)
+ * - 복사본은 빈 캐시로 시작 (Duplicate 시 원본의 MID 포인터를 들고 가지 않도록)
+ */
+class FMeshDrawCommandCache
+{
+public:
+	FMeshDrawCommandCache();
+	~FMeshDrawCommandCache();
+	FMeshDrawCommandCache(const FMeshDrawCommandCache&);
+	FMeshDrawCommandCache& operator=(const FMeshDrawCommandCache&);
+
+	void Invalidate() { bDirty = true; }
+
+	/** 같은 뷰 매크로/머티리얼 슬롯으로 만들었고 무효화/핫 리로드/머티리얼 셰이더 교체가 없었으면 true */
+	bool IsValid(uint64 ViewShaderMacroKey, const TArray<UMaterialInterface*>& MaterialSlots) const;
+
+	/** 다시 만들기 시작 (기존 배치 비움, 용량 유지) */
+	void BeginBuild(uint64 ViewShaderMacroKey, const TArray<UMaterialInterface*>& MaterialSlots);
+	/** Shader: 배치를 만들 때 쓴 머티리얼 셰이더 (나중에 머티리얼 셰이더가 바뀌었는지 확인용) */
+	void AddBatch(const FMeshBatchElement& Batch, UShader* Shader);
+	void EndBuild();
+
+	/** 캐시된 배치를 출력 목록 뒤에 복사. 머티리얼 바람 설정은 MID 편집을 반영하도록 매번 다시 읽는다 */
+	void AppendTo(TFrameArray<FMeshBatchElement>& OutMeshBatchElements);
+
+	int32 Num() const { return Batches.Num(); }
+
+private:
+	TArray<FMeshBatchElement> Batches;
+	TArray<UShader*> BatchShaders;
+	TArray<UMaterialInterface*> SlotMaterials;
+	uint64 ViewShaderMacroKey = 0;
+	uint32 ShaderGeneration = 0;
+	bool bDirty = true;
+};
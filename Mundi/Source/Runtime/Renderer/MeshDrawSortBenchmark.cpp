@@ -0,0 +1,107 @@
+﻿#include "pch.h"
+#include "MeshDrawSortBenchmark.h"
+#include "MeshDrawSortKey.h"
+#include "MeshBatchElement.h"
+#include "PlatformTime.h"
+#include <random>
+
+namespace
+{
+	template<typename T>
+	T* FakePointer(uint32 Slot, uint32 Salt)
+	{
+		// 역참조하지 않는 정렬/비교 전용 주소
+		return reinterpret_cast<T*>(static_cast<uintptr_t>(Salt) * 0x100000 + (static_cast<uintptr_t>(Slot) + 1) * 64);
+	}
+
+	void BuildBatches(int32 NumBatches, std::mt19937& Rng, TArray<FMeshBatchElement>& OutBatches)
+	{
+		// 씬 규모에 맞춘 리소스 수: 셰이더 조합 8개, 머티리얼 256개, 메시(VB/IB) 1024개
+		std::uniform_int_distribution<uint32> ProgramDist(0, 7);
+		std::uniform_int_distribution<uint32> MaterialDist(0, 255);
+		std::uniform_int_distribution<uint32> MeshDist(0, 1023);
+		std::uniform_real_distribution<float> PositionDist(-500.0f, 500.0f);
+
+		OutBatches.SetNum(NumBatches);
+		for (int32 BatchIndex = 0; BatchIndex < NumBatches; ++BatchIndex)
+		{
+			FMeshBatchElement& Batch = OutBatches[BatchIndex];
+			Batch = FMeshBatchElement();
+
+			const uint32 Program = ProgramDist(Rng);
+			const uint32 Mesh = MeshDist(Rng);
+			Batch.VertexShader = FakePointer<ID3D11VertexShader>(Program / 2, 1);
+			Batch.PixelShader = FakePointer<ID3D11PixelShader>(Program, 2);
+			Batch.Material = FakePointer<UMaterialInterface>(MaterialDist(Rng), 3);
+			Batch.VertexBuffer = FakePointer<ID3D11Buffer>(Mesh, 4);
+			Batch.IndexBuffer = FakePointer<ID3D11Buffer>(Mesh, 5);
+			Batch.VertexStride = 48;
+			Batch.WorldMatrix = FMatrix::Identity();
+			Batch.WorldMatrix.M[3][0] = PositionDist(Rng);
+			Batch.WorldMatrix.M[3][1] = PositionDist(Rng);
+			Batch.WorldMatrix.M[3][2] = PositionDist(Rng);
+		}
+	}
+
+	/** 주어진 순서로 그릴 때 DrawMeshBatches가 하게 될 상태 변경 수 (셰이더 + 머티리얼 + IA) */
+	uint32 CountStateChanges(const TArray<FMeshBatchElement>& Batches, const uint32* Order)
+	{
+		const FMeshBatchElement* Prev = nullptr;
+		uint32 Changes = 0;
+		for (int32 i = 0; i < Batches.Num(); ++i)
+		{
+			const FMeshBatchElement& Batch = Batches[Order ? Order[i] : i];
+			if (!Prev || Batch.VertexShader != Prev->VertexShader || Batch.PixelShader != Prev->PixelShader) ++Changes;
+			if (!Prev || Batch.Material != Prev->Material) ++Changes;
+			if (!Prev || Batch.VertexBuffer != Prev->VertexBuffer || Batch.IndexBuffer != Prev->IndexBuffer) ++Changes;
+			Prev = &Batch;
+		}
+		return Changes;
+	}
+}
+
+void FMeshDrawSortBenchmark::Run(int32 Iterations)
+{
+	std::mt19937 Rng(12345);
+	const int32 BatchCounts[] = { 10000, 30000, 100000 };
+	const FVector ViewOrigin(0.0f, 0.0f, 0.0f);
+
+	for (int32 NumBatches : BatchCounts)
+	{
+		TArray<FMeshBatchElement> Source;
+		BuildBatches(NumBatches, Rng, Source);
+
+		TArray<FMeshBatchElement> Sorted;
+		TArray<uint32> Order;
+		Order.SetNum(NumBatches);
+
+		// 기존 경로: 구조체 통째로 비교 정렬 (복사 시간은 제외)
+		double CompareMs = 0.0;
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			Sorted = Source;
+			const uint64 Start = FPlatformTime::Cycles64();
+			Sorted.Sort();
+			CompareMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+		}
+
+		// 새 경로: 키 생성 + (키, 인덱스) 기수 정렬
+		double RadixMs = 0.0;
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			const uint64 Start = FPlatformTime::Cycles64();
+			FMeshDrawSort::SortBatches(Source.data(), NumBatches, ViewOrigin, EMeshDrawDepthOrder::FrontToBack, Order.data());
+			RadixMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+		}
+
+		CompareMs /= Iterations;
+		RadixMs /= Iterations;
+
+		char Buf[512];
+		std::snprintf(Buf, sizeof(Buf),
+			"[DrawSort Bench] %6d batches | operator< sort %7.3f ms -> key + radix %7.3f ms x%.1f | state changes unsorted %u, operator< %u, radix %u\r\n",
+			NumBatches, CompareMs, RadixMs, RadixMs > 0.0 ? CompareMs / RadixMs : 0.0,
+			CountStateChanges(Source, nullptr), CountStateChanges(Sorted, nullptr), CountStateChanges(Source, Order.data()));
+		UE_LOG(Buf);
+	}
+}
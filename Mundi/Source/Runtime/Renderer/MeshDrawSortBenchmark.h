@@ -0,0 +1,13 @@
+﻿#pragma once
+
+/**
+ * @brief 드로우 정렬 비용 비교 (FMeshBatchElement::operator< 비교 정렬 vs 64비트 키 생성 + 기수 정렬)
+ * - 10k/30k/100k 합성 배치 (셰이더/머티리얼/버퍼 포인터를 무작위로 조합, 실제 GPU 리소스 없음)
+ * - 정렬 결과를 순서대로 그린다고 보고 셰이더/머티리얼/버퍼 상태 변경 횟수도 같이 출력
+ * - 콘솔 명령 "BENCH DRAWSORT"로 실행, 결과는 UE_LOG로 출력
+ */
+class FMeshDrawSortBenchmark
+{
+public:
+	static void Run(int32 Iterations = 10);
+};
@@ -0,0 +1,203 @@
+﻿#include "pch.h"
+#include "MeshDrawSortKey.h"
+#include "MeshBatchElement.h"
+#include <cstring>
+
+namespace
+{
+	constexpr uint32 PriorityBits = 8;
+	constexpr uint32 ProgramBits = 12;
+	constexpr uint32 MaterialBits = 14;
+	constexpr uint32 BufferBits = 14;
+	constexpr uint32 DepthBits = 16;
+	static_assert(PriorityBits + ProgramBits + MaterialBits + BufferBits + DepthBits == 64, "Draw sort key must be 64 bits");
+
+	constexpr uint32 DepthShift = 0;
+	constexpr uint32 BufferShift = DepthShift + DepthBits;
+	constexpr uint32 MaterialShift = BufferShift + BufferBits;
+	constexpr uint32 ProgramShift = MaterialShift + MaterialBits;
+	constexpr uint32 PriorityShift = ProgramShift + ProgramBits;
+
+	/**
+	 * 키에 처음 나온 순서대로 0부터 연속 번호를 매김. 버킷은 유지하므로 정상 상태에서는 할당 없음
+	 * 같은 컴포넌트/메시의 배치는 연달아 수집되므로 직전 키를 기억해 해시 조회를 건너뛴다
+	 */
+	class FDenseIdMap
+	{
+	public:
+		void Reset()
+		{
+			Ids.clear();
+			bHasLast = false;
+		}
+
+		uint32 Get(uint64 Key, uint32 MaxId)
+		{
+			if (!bHasLast || Key != LastKey)
+			{
+				const uint32 NextId = static_cast<uint32>(Ids.Num());
+				LastId = Ids.try_emplace(Key, NextId).first->second;
+				LastKey = Key;
+				bHasLast = true;
+			}
+			return LastId < MaxId ? LastId : MaxId;
+		}
+
+	private:
+		TMap<uint64, uint32> Ids;
+		uint64 LastKey = 0;
+		uint32 LastId = 0;
+		bool bHasLast = false;
+	};
+
+	/**
+	 * 포인터 두 개를 64비트 키 하나로 합침 (ID 조회를 상태 그룹당 한 번으로 줄이기 위함)
+	 * 64비트 충돌은 사실상 없고, 나더라도 두 상태가 같은 그룹으로 묶여 상태 변경이 조금 늘 뿐 그리기 결과는 같다
+	 */
+	uint64 PairKey(const void* A, const void* B)
+	{
+		uint64 Key = static_cast<uint64>(reinterpret_cast<uintptr_t>(A)) * 0x9E3779B97F4A7C15ull;
+		Key ^= static_cast<uint64>(reinterpret_cast<uintptr_t>(B)) + 0x632BE59BD9B4E019ull + (Key << 6) + (Key >> 2);
+		return Key;
+	}
+
+	/**
+	 * 거리 제곱의 float 비트 상위 16비트 (양수 float은 비트 순서 = 크기 순서)
+	 * 지수 + 가수 상위 7비트라 거리 범위 제한 없이 로그 스케일 버킷이 된다
+	 */
+	uint32 DepthBucket(const FMatrix& WorldMatrix, const FVector& ViewOrigin)
+	{
+		const float Dx = WorldMatrix.M[3][0] - ViewOrigin.X;
+		const float Dy = WorldMatrix.M[3][1] - ViewOrigin.Y;
+		const float Dz = WorldMatrix.M[3][2] - ViewOrigin.Z;
+		const float DistSq = Dx * Dx + Dy * Dy + Dz * Dz;
+
+		uint32 Bits;
+		std::memcpy(&Bits, &DistSq, sizeof(Bits));
+		return Bits >> 16;
+	}
+}
+
+void FMeshDrawSort::BuildSortKeys(FMeshBatchElement* Batches, int32 NumBatches, const FVector& ViewOrigin, EMeshDrawDepthOrder DepthOrder)
+{
+	// 렌더 스레드 한 곳에서만 호출되지만 벤치마크 등과 겹치지 않게 스레드별로 둔다
+	thread_local FDenseIdMap ProgramIds, MaterialIds, BufferIds;
+	ProgramIds.Reset();
+	MaterialIds.Reset();
+	BufferIds.Reset();
+
+	constexpr uint32 MaxProgramId = (1u << ProgramBits) - 1;
+	constexpr uint32 MaxMaterialId = (1u << MaterialBits) - 1;
+	constexpr uint32 MaxBufferId = (1u << BufferBits) - 1;
+	constexpr uint32 MaxDepth = (1u << DepthBits) - 1;
+
+	for (int32 BatchIndex = 0; BatchIndex < NumBatches; ++BatchIndex)
+	{
+		FMeshBatchElement& Batch = Batches[BatchIndex];
+
+		// 0순위: 수동 지정 우선순위 (지정 안 됨 = 0, 지정값은 1부터)
+		const uint64 Priority = static_cast<uint64>(FMath::Clamp(Batch.SortPriority, -1, 254) + 1);
+
+		// 1순위: 셰이더 프로그램 (VS, PS 쌍)
+		const uint64 ProgramId = ProgramIds.Get(PairKey(Batch.VertexShader, Batch.PixelShader), MaxProgramId);
+
+		// 2순위: 픽셀 리소스 (머티리얼 + 인스턴스 텍스처, DrawMeshBatches가 둘 중 하나만 바뀌어도 다시 바인딩함)
+		const uint64 MaterialId = MaterialIds.Get(PairKey(Batch.Material, Batch.InstanceShaderResourceView), MaxMaterialId);
+
+		// 3순위: IA 상태 (VB, IB). 스트라이드/토폴로지는 VB를 따라간다
+		const uint64 BufferId = BufferIds.Get(PairKey(Batch.VertexBuffer, Batch.IndexBuffer), MaxBufferId);
+
+		uint64 Depth = 0;
+		if (DepthOrder != EMeshDrawDepthOrder::None)
+		{
+			Depth = DepthBucket(Batch.WorldMatrix, ViewOrigin);
+			if (DepthOrder == EMeshDrawDepthOrder::BackToFront)
+			{
+				Depth = MaxDepth - Depth;
+			}
+		}
+
+		Batch.SortKey = (Priority << PriorityShift) | (ProgramId << ProgramShift) | (MaterialId << MaterialShift) | (BufferId << BufferShift) | (Depth << DepthShift);
+	}
+}
+
+void FMeshDrawSort::RadixSort(FMeshDrawSortPair* Pairs, FMeshDrawSortPair* Scratch, int32 NumPairs)
+{
+	if (NumPairs <= 1)
+	{
+		return;
+	}
+
+	// 8비트 자리 8개의 히스토그램을 한 번에 만든다
+	uint32 Histograms[8][256] = {};
+	for (int32 i = 0; i < NumPairs; ++i)
+	{
+		const uint64 Key = Pairs[i].Key;
+		for (int32 Digit = 0; Digit < 8; ++Digit)
+		{
+			++Histograms[Digit][(Key >> (Digit * 8)) & 0xFF];
+		}
+	}
+
+	FMeshDrawSortPair* Src = Pairs;
+	FMeshDrawSortPair* Dst = Scratch;
+	for (int32 Digit = 0; Digit < 8; ++Digit)
+	{
+		uint32* Histogram = Histograms[Digit];
+
+		// 모든 키가 이 자리에서 같은 값이면 순서가 바뀌지 않으므로 건너뜀 (ID가 작아 상위 바이트가 비는 경우가 대부분)
+		const uint32 FirstByte = static_cast<uint32>((Src[0].Key >> (Digit * 8)) & 0xFF);
+		if (Histogram[FirstByte] == static_cast<uint32>(NumPairs))
+		{
+			continue;
+		}
+
+		uint32 Offset = 0;
+		for (int32 Bucket = 0; Bucket < 256; ++Bucket)
+		{
+			const uint32 Count = Histogram[Bucket];
+			Histogram[Bucket] = Offset;
+			Offset += Count;
+		}
+
+		const uint32 Shift = Digit * 8;
+		for (int32 i = 0; i < NumPairs; ++i)
+		{
+			const FMeshDrawSortPair& Pair = Src[i];
+			Dst[Histogram[(Pair.Key >> Shift) & 0xFF]++] = Pair;
+		}
+		std::swap(Src, Dst);
+	}
+
+	if (Src != Pairs)
+	{
+		std::memcpy(Pairs, Src, sizeof(FMeshDrawSortPair) * NumPairs);
+	}
+}
+
+void FMeshDrawSort::SortBatches(FMeshBatchElement* Batches, int32 NumBatches, const FVector& ViewOrigin, EMeshDrawDepthOrder DepthOrder, uint32* OutOrder)
+{
+	if (NumBatches <= 0)
+	{
+		return;
+	}
+
+	BuildSortKeys(Batches, NumBatches, ViewOrigin, DepthOrder);
+
+	thread_local TArray<FMeshDrawSortPair> Pairs;
+	thread_local TArray<FMeshDrawSortPair> Scratch;
+	Pairs.SetNum(NumBatches);
+	Scratch.SetNum(NumBatches);
+
+	for (int32 BatchIndex = 0; BatchIndex < NumBatches; ++BatchIndex)
+	{
+		Pairs[BatchIndex] = { Batches[BatchIndex].SortKey, static_cast<uint32>(BatchIndex) };
+	}
+
+	RadixSort(Pairs.data(), Scratch.data(), NumBatches);
+
+	for (int32 i = 0; i < NumBatches; ++i)
+	{
+		OutOrder[i] = Pairs[i].Index;
+	}
+}
@@ -0,0 +1,38 @@
+﻿#pragma once
+
+struct FMeshBatchElement;
+
+/** 같은 상태 안에서 깊이 버킷을 어느 방향으로 정렬할지 */
+enum class EMeshDrawDepthOrder : uint8
+{
+	None,			// 깊이 무시 (수집 순서 유지)
+	FrontToBack,	// 불투명: 가까운 것부터 (Early-Z)
+	BackToFront,	// 반투명: 먼 것부터
+};
+
+/** 기수 정렬 단위: 64비트 키 + 배치 인덱스 */
+struct FMeshDrawSortPair
+{
+	uint64 Key;
+	uint32 Index;
+};
+
+/**
+ * @brief FMeshBatchElement 64비트 정렬 키 생성 + (키, 인덱스) 기수 정렬
+ * - 키 구성 (상위 → 하위): 우선순위 8 | 셰이더 프로그램 ID 12 | 머티리얼 ID 14 | 버퍼 ID 14 | 깊이 버킷 16
+ * - ID는 (VS, PS) / (머티리얼, 인스턴스 텍스처) / (VB, IB) 쌍에 정렬 호출마다 처음 나온 순서대로 매긴 번호
+ *   (필드 범위를 넘으면 최댓값으로 묶임 → 상태 묶음만 덜 될 뿐 그리기 결과는 같다)
+ * - 정렬은 안정 LSD 기수 정렬이라 키가 같으면 수집 순서가 유지되고, 무거운 배치 구조체는 옮기지 않는다
+ */
+class FMeshDrawSort
+{
+public:
+	/** 배치마다 SortKey를 채움 */
+	static void BuildSortKeys(FMeshBatchElement* Batches, int32 NumBatches, const FVector& ViewOrigin, EMeshDrawDepthOrder DepthOrder);
+
+	/** Pairs를 키 오름차순으로 정렬 (Scratch는 NumPairs 이상, 바이트가 모두 같은 자리는 건너뜀) */
+	static void RadixSort(FMeshDrawSortPair* Pairs, FMeshDrawSortPair* Scratch, int32 NumPairs);
+
+	/** 키 생성 + 정렬: OutOrder[0..NumBatches)에 그릴 순서대로 배치 인덱스를 쓴다 */
+	static void SortBatches(FMeshBatchElement* Batches, int32 NumBatches, const FVector& ViewOrigin, EMeshDrawDepthOrder DepthOrder, uint32* OutOrder);
+};
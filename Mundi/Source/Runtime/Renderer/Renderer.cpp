@@ -31,6 +31,7 @@
 #include "DecalStatManager.h"
 #include "SceneRenderer.h"
 #include "SceneView.h"
+#include "MeshAutoInstancing.h"
 
 #include <Windows.h>
 #include "DirectionalLightComponent.h"
@@ -45,6 +46,16 @@ URenderer::~URenderer()
 	{
 		delete LineBatchData;
 	}
+	if (MeshInstanceSRV)
+	{
+		MeshInstanceSRV->Release();
+		MeshInstanceSRV = nullptr;
+	}
+	if (MeshInstanceBuffer)
+	{
+		MeshInstanceBuffer->Release();
+		MeshInstanceBuffer = nullptr;
+	}
 }
 
 void URenderer::BeginFrame()
@@ -55,6 +66,7 @@ void URenderer::BeginFrame()
 
 	// 프레임별 데칼 통계를 추적하기 위해 초기화
 	FDecalStatManager::GetInstance().ResetFrameStats();
+	FMeshAutoInstancing::ResetFrameStats();
 	GPU_PROFILING_START;
 
 	RHIDevice->ClearAllBuffer();
@@ -65,6 +77,47 @@ void URenderer::EndFrame()
 	RHIDevice->Present();
 }
 
+ID3D11ShaderResourceView* URenderer::UploadMeshInstances(const FMeshInstanceData* InInstances, uint32 InNumInstances)
+{
+	if (InNumInstances == 0)
+	{
+		return nullptr;
+	}
+
+	if (InNumInstances > MeshInstanceCapacity)
+	{
+		if (MeshInstanceSRV)
+		{
+			MeshInstanceSRV->Release();
+			MeshInstanceSRV = nullptr;
+		}
+		if (MeshInstanceBuffer)
+		{
+			MeshInstanceBuffer->Release();
+			MeshInstanceBuffer = nullptr;
+		}
+		MeshInstanceCapacity = 0;
+
+		// 매 프레임 조금씩 늘어날 때 재생성을 반복하지 않도록 두 배씩 키움
+		const uint32 NewCapacity = std::max<uint32>(InNumInstances, 256u);
+		if (FAILED(RHIDevice->CreateStructuredBuffer(sizeof(FMeshInstanceData), NewCapacity * 2, nullptr, &MeshInstanceBuffer)) ||
+			FAILED(RHIDevice->CreateStructuredBufferSRV(MeshInstanceBuffer, &MeshInstanceSRV)))
+		{
+			UE_LOG("URenderer: 인스턴스 버퍼 생성 실패 (%u)", NewCapacity * 2);
+			if (MeshInstanceBuffer)
+			{
+				MeshInstanceBuffer->Release();
+				MeshInstanceBuffer = nullptr;
+			}
+			return nullptr;
+		}
+		MeshInstanceCapacity = NewCapacity * 2;
+	}
+
+	RHIDevice->UpdateStructuredBuffer(MeshInstanceBuffer, InInstances, InNumInstances * sizeof(FMeshInstanceData));
+	return MeshInstanceSRV;
+}
+
 void URenderer::RenderSceneForView(UWorld* World, FSceneView* View, FViewport* Viewport)
 {
 	// 씬을 그리는 FSceneRenderer 를 생성합니다.
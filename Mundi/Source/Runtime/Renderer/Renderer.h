@@ -14,6 +14,7 @@ class UCameraComponent;
 class FSceneView;
 
 struct FMaterialSlot;
+struct FMeshInstanceData;
 
 class URenderer
 {
@@ -49,6 +50,9 @@ public:
 	void SetCurrentCamera(ACameraActor* InCamera) { CurrentCamera = InCamera; }
 	ACameraActor* GetCurrentCamera() const { return CurrentCamera; }
 
+	// 자동 인스턴싱 인스턴스 데이터를 GPU에 올리고 SRV(t14) 반환 (모자라면 버퍼를 키움, 실패 시 nullptr)
+	ID3D11ShaderResourceView* UploadMeshInstances(const FMeshInstanceData* InInstances, uint32 InNumInstances);
+
 private:
 	D3D11RHI* RHIDevice;    // NOTE: 개발 편의성을 위해서 DX11를 종속적으로 사용한다 (URHIDevice를 사용하지 않음)
 
@@ -66,6 +70,11 @@ private:
 
 	void InitializeLineBatch();
 
+	// 자동 인스턴싱 인스턴스 버퍼 (뷰마다 WRITE_DISCARD로 덮어씀)
+	ID3D11Buffer* MeshInstanceBuffer = nullptr;
+	ID3D11ShaderResourceView* MeshInstanceSRV = nullptr;
+	uint32 MeshInstanceCapacity = 0;
+
 	// 이전 drawCall에서 이미 썼던 RnderState면, 다시 Set 하지 않기 위해 만든 변수들
 	EViewMode PreViewModeIndex = EViewMode::VMI_Wireframe; // RSSetState, UpdateColorConstantBuffers
 	//UMaterial* PreUMaterial = nullptr; // SRV, UpdatePixelConstantBuffers
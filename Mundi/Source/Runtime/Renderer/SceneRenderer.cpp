@@ -26,6 +26,8 @@
 #include "TextRenderComponent.h"
 #include "OBB.h"
 #include "BoundingSphere.h"
+#include "Collision.h"
+#include "ShadowCasterCache.h"
 #include "HeightFogComponent.h"
 #include "SkySphereComponent.h"
 #include "SkySphereGenerator.h"
@@ -39,6 +41,8 @@
 #include "ParticleSystemComponent.h"
 #include "SwapGuard.h"
 #include "MeshBatchElement.h"
+#include "MeshDrawSortKey.h"
+#include "MeshAutoInstancing.h"
 #include "SceneView.h"
 #include "Shader.h"
 #include "ResourceManager.h"
@@ -49,6 +53,7 @@
 #include "LightStats.h"
 #include "ShadowStats.h"
 #include "PlatformTime.h"
+#include "ParallelFor.h"
 #include "PostProcessing/VignettePass.h"
 #include "Source/Editor/FBX/FbxLoader.h"
 #include "SkinnedMeshComponent.h"
@@ -77,6 +82,44 @@ FSceneRenderer::~FSceneRenderer()
 {
 }
 
+namespace
+{
+	// 병렬 프록시 수집용 청크별 결과. 청크 순서대로 병합해서 순차 수집과 같은 순서를 유지
+	struct FProxyGatherBucket
+	{
+		FVisibleRenderProxySet Proxies;
+		FSceneLocals Locals;
+		FSceneGlobals Globals;
+
+		void MergeInto(FVisibleRenderProxySet& OutProxies, FSceneLocals& OutLocals, FSceneGlobals& OutGlobals) const
+		{
+			OutProxies.Meshes.Append(Proxies.Meshes);
+			OutProxies.Billboards.Append(Proxies.Billboards);
+			OutProxies.Decals.Append(Proxies.Decals);
+			OutProxies.Texts.Append(Proxies.Texts);
+			OutProxies.Particles.Append(Proxies.Particles);
+			OutProxies.EditorLines.Append(Proxies.EditorLines);
+			OutProxies.EditorPrimitives.Append(Proxies.EditorPrimitives);
+			OutProxies.OverlayPrimitives.Append(Proxies.OverlayPrimitives);
+
+			OutLocals.PointLights.Append(Locals.PointLights);
+			OutLocals.SpotLights.Append(Locals.SpotLights);
+
+			OutGlobals.DirectionalLights.Append(Globals.DirectionalLights);
+			OutGlobals.AmbientLights.Append(Globals.AmbientLights);
+			OutGlobals.Fogs.Append(Globals.Fogs);
+			// 마지막으로 발견된 스카이 스피어 사용 (순차 수집과 동일)
+			if (Globals.SkySphere)
+			{
+				OutGlobals.SkySphere = Globals.SkySphere;
+			}
+		}
+	};
+
+	// 병렬 수집 청크 크기 (워커 수와 무관하게 고정해야 병합 결과가 결정적)
+	constexpr int32 GatherActorsPerChunk = 128;
+}
+
 //====================================================================================
 // 메인 렌더 함수
 //====================================================================================
@@ -254,44 +297,6 @@ void FSceneRenderer::RenderShadowMaps()
     FLightManager* LightManager = World->GetLightManager();
 	if (!LightManager) return;
 
-	// 2. 그림자 캐스터(Caster) 메시 수집
-	// 카메라 Frustum 컬링을 적용하여 보이는 오브젝트만 그림자 캐스터로 수집
-	const FFrustum& ViewFrustum = View->ViewFrustum;
-	TArray<FMeshBatchElement> ShadowMeshBatches;
-	for (AActor* Actor : World->GetActors())
-	{
-		if (!Actor || !Actor->IsActorVisible() || !Actor->IsActorActive())
-		{
-			continue;
-		}
-
-		for (USceneComponent* Component : Actor->GetSceneComponents())
-		{
-			if (!Component)
-			{
-				continue;
-			}
-
-			UMeshComponent* MeshComponent = Cast<UMeshComponent>(Component);
-			if (!MeshComponent || !MeshComponent->IsCastShadows() || !MeshComponent->IsVisible())
-			{
-				continue;
-			}
-
-			// 카메라 Frustum 컬링
-			FAABB WorldAABB = MeshComponent->GetWorldAABB();
-			if (!IsAABBVisible(ViewFrustum, WorldAABB))
-			{
-				continue;
-			}
-
-			MeshComponent->CollectMeshBatches(ShadowMeshBatches, View);
-		}
-	}
-
-	// NOTE: 카메라 오버라이드 기능을 항상 활성화 하기 위해서 그림자를 그릴 곳이 없어도 함수 실행
-	//if (ShadowMeshBatches.IsEmpty()) return;
-
 	// 섀도우 맵을 DSV로 사용하기 전에 SRV 슬롯에서 해제
 	ID3D11ShaderResourceView* nullSRVs[2] = { nullptr, nullptr };
 	RHIDevice->GetDeviceContext()->PSSetShaderResources(8, 2, nullSRVs); // 슬롯 8과 9 해제
@@ -370,6 +375,17 @@ void FSceneRenderer::RenderShadowMaps()
 	// 2.2. 큐브맵 슬라이스 할당 (Allocate only)
 	LightManager->AllocateAtlasCubeSlices(RequestsCube); // FLightManager가 RequestsCube의 AssignedSliceIndex와 Size 업데이트
 
+	// 2.3. 그림자 캐스터(Caster) 수집
+	// 할당으로 요청 순서가 바뀌므로 할당 뒤에 수집. 카메라 밖 캐스터도 그림자를 드리우므로 라이트 볼륨 기준으로 컬링
+	TFrameArray<FMeshBatchElement> ShadowMeshBatches;
+	TFrameArray<uint32> ShadowBatchIndices;
+	TFrameArray<FShadowRequestCasters> ShadowRequestCasters;
+	GatherShadowCasters(Requests2D, RequestsCube, ShadowMeshBatches, ShadowBatchIndices, ShadowRequestCasters);
+
+	// 정적 캐스터 깊이 레이어 캐시. 라이트/정적 캐스터가 그대로인 요청은 정적 레이어를 복사하고 동적 캐스터만 그린다
+	FShadowMapCache& ShadowMapCache = LightManager->GetShadowMapCache();
+	ShadowMapCache.BeginFrame();
+
 	// --- 1단계: 2D 아틀라스 렌더링 (Spot + Directional) ---
 	{
 		ID3D11DepthStencilView* AtlasDSV2D = LightManager->GetShadowAtlasDSV2D();
@@ -404,14 +420,36 @@ void FSceneRenderer::RenderShadowMaps()
 			RHIDevice->RSSetState(ERasterizerMode::Shadows);
 			RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
 
-			for (FShadowRenderRequest& Request : Requests2D)
+			// VSM은 모멘트 RTV까지 캐시해야 하므로 PCF(깊이만 사용)일 때만 정적 레이어를 재사용
+			const bool bUseStaticCache2D = ShadowAAType != EShadowAATechnique::VSM
+				&& ShadowMapCache.GetStaticAtlasDSV2D() && ShadowMapCache.GetStaticAtlasSRV2D();
+
+			for (int32 RequestIndex = 0; RequestIndex < Requests2D.Num(); ++RequestIndex)
 			{
+				FShadowRenderRequest& Request = Requests2D[RequestIndex];
+				const FShadowRequestCasters& Casters = ShadowRequestCasters[RequestIndex];
+
 				// 뷰포트 설정
 				D3D11_VIEWPORT ShadowVP = { Request.AtlasViewportOffset.X, Request.AtlasViewportOffset.Y, static_cast<FLOAT>(Request.Size), static_cast<FLOAT>(Request.Size), 0.0f, 1.0f };
 				RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
 
-				// 뎁스 패스 렌더링
-				RenderShadowDepthPass(Request, ShadowMeshBatches);
+				// 뎁스 패스 렌더링: 정적 레이어(캐시 복사 또는 새로 그린 뒤 저장) + 동적 캐스터
+				const bool bCacheable = bUseStaticCache2D && Request.Size > 0;
+				bool bStaticLayerRestored = false;
+				if (bCacheable && ShadowMapCache.AcquireStaticLayer(Request, Casters.StaticSignature, false))
+				{
+					bStaticLayerRestored = CopyShadowDepthRegion(ShadowMapCache.GetStaticAtlasSRV2D(), AtlasDSV2D, ShadowVP);
+				}
+				if (!bStaticLayerRestored)
+				{
+					RenderShadowDepthPass(Request, ShadowMeshBatches, ShadowBatchIndices, Casters.StaticCasters);
+					if (bCacheable)
+					{
+						CopyShadowDepthRegion(LightManager->GetShadowAtlasSRV2D(), ShadowMapCache.GetStaticAtlasDSV2D(), ShadowVP);
+						RHIDevice->OMSetCustomRenderTargets(0, nullptr, AtlasDSV2D);
+					}
+				}
+				RenderShadowDepthPass(Request, ShadowMeshBatches, ShadowBatchIndices, Casters.DynamicCasters);
 
 				FShadowMapData Data;
 				if (Request.Size > 0) // 렌더링 성공
@@ -445,9 +483,15 @@ void FSceneRenderer::RenderShadowMaps()
 			D3D11_VIEWPORT ShadowVP = { 0.0f, 0.0f, (float)AtlasSizeCube, (float)AtlasSizeCube, 0.0f, 1.0f };
 			RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
 
-			// 이제 RequestsCube 배열을 직접 순회
-			for (FShadowRenderRequest& Request : RequestsCube) // 레퍼런스 유지
+			// 큐브 면은 VSM 여부와 관계없이 깊이만 사용하므로 항상 정적 레이어 캐시 대상
+			ID3D11Texture2D* LiveAtlasCube = LightManager->GetShadowAtlasTextureCube();
+			ID3D11Texture2D* StaticAtlasCube = LiveAtlasCube ? ShadowMapCache.GetStaticAtlasTextureCube() : nullptr;
+
+			// 이제 RequestsCube 배열을 직접 순회 (캐스터 구간은 2D 요청 뒤에 이어짐)
+			for (int32 RequestIndex = 0; RequestIndex < RequestsCube.Num(); ++RequestIndex)
 			{
+				FShadowRenderRequest& Request = RequestsCube[RequestIndex];
+
 				// 슬라이스 할당 실패는 FLightManager::Allocate... 함수가 처리 (Size=0 설정)
 				if (Request.Size == 0) // 할당 실패한 요청 건너뛰기
 				{
@@ -465,18 +509,39 @@ void FSceneRenderer::RenderShadowMaps()
 				int32 SliceIndex = Request.AssignedSliceIndex;   // FLightManager가 할당한 값
 				int32 FaceIndex = Request.SubViewIndex; // 원본 면 인덱스
 
-				// 2.3. 면 렌더링 (기존 로직 유지)
+				// 2.3. 면 렌더링: 정적 레이어(캐시 복사 또는 새로 그린 뒤 저장) + 동적 캐스터
+				// 큐브 면은 통째로 하나의 서브리소스이므로 깊이 텍스처끼리도 CopySubresourceRegion으로 복사 가능
+				const FShadowRequestCasters& Casters = ShadowRequestCasters[Requests2D.Num() + RequestIndex];
 				ID3D11DepthStencilView* FaceDSV = LightManager->GetShadowCubeFaceDSV(SliceIndex, FaceIndex);
 				if (FaceDSV)
 				{
-					RHIDevice->OMSetCustomRenderTargets(0, nullptr, FaceDSV);
-					RHIDevice->GetDeviceContext()->ClearDepthStencilView(FaceDSV, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
-					RenderShadowDepthPass(Request, ShadowMeshBatches);
+					const UINT FaceSubresource = D3D11CalcSubresource(0, SliceIndex * 6 + FaceIndex, 1);
+					if (StaticAtlasCube && ShadowMapCache.AcquireStaticLayer(Request, Casters.StaticSignature, true))
+					{
+						RHIDevice->GetDeviceContext()->CopySubresourceRegion(LiveAtlasCube, FaceSubresource, 0, 0, 0, StaticAtlasCube, FaceSubresource, nullptr);
+						RHIDevice->OMSetCustomRenderTargets(0, nullptr, FaceDSV);
+					}
+					else
+					{
+						RHIDevice->OMSetCustomRenderTargets(0, nullptr, FaceDSV);
+						RHIDevice->GetDeviceContext()->ClearDepthStencilView(FaceDSV, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
+						RenderShadowDepthPass(Request, ShadowMeshBatches, ShadowBatchIndices, Casters.StaticCasters);
+						if (StaticAtlasCube)
+						{
+							// 복사 원본이 DSV로 바인딩된 상태면 안 되므로 잠시 해제
+							RHIDevice->OMSetCustomRenderTargets(0, nullptr, nullptr);
+							RHIDevice->GetDeviceContext()->CopySubresourceRegion(StaticAtlasCube, FaceSubresource, 0, 0, 0, LiveAtlasCube, FaceSubresource, nullptr);
+							RHIDevice->OMSetCustomRenderTargets(0, nullptr, FaceDSV);
+						}
+					}
+					RenderShadowDepthPass(Request, ShadowMeshBatches, ShadowBatchIndices, Casters.DynamicCasters);
 				}
 			}
 		}
 	}
 
+	FShadowStatManager::GetInstance().UpdateShadowMapCacheStats(ShadowMapCache.GetLightHitCount(), ShadowMapCache.GetLightMissCount());
+
 	// --- 3. RHI 상태 복구 ---
 	RHIDevice->RSSetState(ERasterizerMode::Solid);
 	ID3D11RenderTargetView* nullRTV = nullptr;
@@ -489,7 +554,172 @@ void FSceneRenderer::RenderShadowMaps()
 	RHIDevice->SetAndUpdateConstantBuffer(ViewProjBufferType(SavedCameraViewProj));
 }
 
-void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches)
+void FSceneRenderer::GatherShadowCasters(const TArray<FShadowRenderRequest>& Requests2D, const TArray<FShadowRenderRequest>& RequestsCube,
+	TFrameArray<FMeshBatchElement>& OutBatches, TFrameArray<uint32>& OutBatchIndices, TFrameArray<FShadowRequestCasters>& OutCasters)
+{
+	const int32 NumRequests = Requests2D.Num() + RequestsCube.Num();
+	OutCasters.SetNum(NumRequests);
+
+	// 할당에 실패한 요청(Size == 0)은 그리지 않으므로 쿼리하지 않음
+	TFrameArray<const FShadowRenderRequest*> QueryRequests;
+	TFrameArray<int32> QueryRangeIndices;
+	for (int32 RequestIndex = 0; RequestIndex < NumRequests; ++RequestIndex)
+	{
+		const FShadowRenderRequest& Request = RequestIndex < Requests2D.Num()
+			? Requests2D[RequestIndex]
+			: RequestsCube[RequestIndex - Requests2D.Num()];
+		if (Request.Size > 0)
+		{
+			QueryRequests.Add(&Request);
+			QueryRangeIndices.Add(RequestIndex);
+		}
+	}
+
+	FLightManager* LightManager = World->GetLightManager();
+	FShadowCasterCache& CasterCache = LightManager->GetShadowCasterCache();
+	UWorldPartitionManager* Partition = World->GetPartitionManager();
+	FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+
+	// 1. 요청별 라이트 볼륨 + BVH 스태틱 캐스터 후보 (캐시 미스만 병렬 쿼리)
+	TFrameArray<FOBB> Volumes;
+	TFrameArray<const TArray<UPrimitiveComponent*>*> StaticCasters;
+	CasterCache.QueryCasters(Partition, QueryRequests, Volumes, StaticCasters);
+
+	auto IsShadowCaster = [](UMeshComponent* MeshComponent)
+		{
+			if (!MeshComponent || !MeshComponent->IsCastShadows() || !MeshComponent->IsVisible())
+			{
+				return false;
+			}
+			AActor* Owner = MeshComponent->GetOwner();
+			return Owner && Owner->IsActorVisible() && Owner->IsActorActive();
+		};
+
+	// 2. BVH 결과를 쓸 수 없는 캐스터 (스켈레탈 메시, BVH에 없거나 바운드 반영 대기 중인 스태틱 메시)
+	// GatherVisibleProxies의 IsCulledByBVH와 같은 기준. 현재 바운드로 요청마다 직접 판정
+	TFrameArray<UMeshComponent*> DynamicCasters;
+	TFrameArray<FAABB> DynamicCasterBounds;
+	for (AActor* Actor : World->GetActors())
+	{
+		if (!Actor || !Actor->IsActorVisible() || !Actor->IsActorActive())
+		{
+			continue;
+		}
+
+		for (USceneComponent* Component : Actor->GetSceneComponents())
+		{
+			UMeshComponent* MeshComponent = Cast<UMeshComponent>(Component);
+			if (!IsShadowCaster(MeshComponent))
+			{
+				continue;
+			}
+
+			const bool bServedByBVH = BVH
+				&& MeshComponent->IsA(UStaticMeshComponent::StaticClass())
+				&& BVH->Contains(MeshComponent)
+				&& !Partition->IsPendingUpdate(MeshComponent);
+			if (bServedByBVH)
+			{
+				continue;
+			}
+
+			DynamicCasters.Add(MeshComponent);
+			DynamicCasterBounds.Add(MeshComponent->GetWorldAABB());
+		}
+	}
+
+	// 3. 캐스터별 배치는 한 번만 수집하고 (여러 캐스케이드/큐브 면/라이트에 걸쳐도) 요청마다 인덱스만 붙인다
+	TMap<UMeshComponent*, FShadowCasterRange> CollectedCasters;
+	auto AppendCaster = [&](UMeshComponent* MeshComponent)
+		{
+			FShadowCasterRange BatchRange;
+			if (const FShadowCasterRange* Found = CollectedCasters.Find(MeshComponent))
+			{
+				BatchRange = *Found;
+			}
+			else
+			{
+				BatchRange.Start = OutBatches.Num();
+				MeshComponent->CollectMeshBatches(OutBatches, View);
+				BatchRange.Num = OutBatches.Num() - BatchRange.Start;
+				CollectedCasters.Add(MeshComponent, BatchRange);
+			}
+
+			for (uint32 BatchOffset = 0; BatchOffset < BatchRange.Num; ++BatchOffset)
+			{
+				OutBatchIndices.Add(BatchRange.Start + BatchOffset);
+			}
+		};
+
+	// 4. 요청마다 정적 구간 다음에 동적 구간을 이어 붙인다
+	// 정적: 최근 StaticSettleFrames 동안 움직이지 않은 BVH 스태틱 메시 (섀도우 맵 캐시의 정적 레이어)
+	// 동적: 막 움직였거나 계속 움직이는 스태틱 메시 + DynamicCasters (매 프레임 그림)
+	const uint64 FrameNumber = FFrameAllocator::Get().GetFrameNumber();
+	TFrameArray<UMeshComponent*> RecentlyMovedCasters;
+	for (int32 QueryIndex = 0; QueryIndex < QueryRequests.Num(); ++QueryIndex)
+	{
+		FShadowRequestCasters& Casters = OutCasters[QueryRangeIndices[QueryIndex]];
+		Casters.StaticCasters.Start = OutBatchIndices.Num();
+		RecentlyMovedCasters.Empty();
+
+		uint64 SignatureSum = 0;
+		uint64 SignatureXor = 0;
+		uint32 NumStaticCasters = 0;
+		for (UPrimitiveComponent* Component : *StaticCasters[QueryIndex])
+		{
+			// 대기 중인 컴포넌트는 BVH 바운드가 낡았으므로 DynamicCasters 쪽에서 처리됨
+			if (Partition->IsPendingUpdate(Component))
+			{
+				continue;
+			}
+
+			UMeshComponent* MeshComponent = static_cast<UMeshComponent*>(Component);
+			if (!IsShadowCaster(MeshComponent))
+			{
+				continue;
+			}
+
+			const uint64 LastDirtyFrame = MeshComponent->GetLastShadowDirtyFrame();
+			if (FrameNumber < LastDirtyFrame + FShadowMapCache::StaticSettleFrames)
+			{
+				RecentlyMovedCasters.Add(MeshComponent);
+				continue;
+			}
+
+			// BVH 쿼리 결과 순서에 의존하지 않도록 순서 무관한 조합으로 누적
+			const uint64 CasterHash = FShadowMapCache::MixSignature(reinterpret_cast<uint64>(MeshComponent), LastDirtyFrame);
+			SignatureSum += CasterHash;
+			SignatureXor ^= CasterHash * 0x9E3779B97F4A7C15ull;
+			++NumStaticCasters;
+			AppendCaster(MeshComponent);
+		}
+
+		Casters.StaticCasters.Num = OutBatchIndices.Num() - Casters.StaticCasters.Start;
+		Casters.StaticSignature = FShadowMapCache::MixSignature(SignatureSum + NumStaticCasters, SignatureXor);
+		Casters.DynamicCasters.Start = OutBatchIndices.Num();
+
+		for (UMeshComponent* MeshComponent : RecentlyMovedCasters)
+		{
+			AppendCaster(MeshComponent);
+		}
+
+		const FOBB& Volume = Volumes[QueryIndex];
+		for (int32 CasterIndex = 0; CasterIndex < DynamicCasters.Num(); ++CasterIndex)
+		{
+			if (Collision::Intersects(DynamicCasterBounds[CasterIndex], Volume))
+			{
+				AppendCaster(DynamicCasters[CasterIndex]);
+			}
+		}
+
+		Casters.DynamicCasters.Num = OutBatchIndices.Num() - Casters.DynamicCasters.Start;
+	}
+
+	FShadowStatManager::GetInstance().UpdateCasterStats(CasterCache.GetLastHitCount(), CasterCache.GetLastMissCount(), OutBatchIndices.Num());
+}
+
+void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TFrameArray<FMeshBatchElement>& InShadowBatches,
+	const TFrameArray<uint32>& InBatchIndices, const FShadowCasterRange& InRange)
 {
 	// 1. 뎁스 전용 셰이더 로드
 	UShader* DepthVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Shadows/DepthOnly_VS.hlsl");
@@ -550,8 +780,10 @@ void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest,
 	// 현재 사용 중인 셰이더 variant 추적
 	FShaderVariant* CurrentShaderVariant = nullptr;
 
-	for (const FMeshBatchElement& Batch : InShadowBatches)
+	for (uint32 BatchOffset = 0; BatchOffset < InRange.Num; ++BatchOffset)
 	{
+		const FMeshBatchElement& Batch = InShadowBatches[InBatchIndices[InRange.Start + BatchOffset]];
+
 		// 배치별로 GPU 스키닝 여부 판단: GPUSkinMatrixSRV가 있으면 스켈레탈 메쉬
 		bool bBatchUsesGPUSkinning = bGPUSkinningEnabled && Batch.GPUSkinMatrixSRV != nullptr;
 		FShaderVariant* RequiredVariant = bBatchUsesGPUSkinning ? ShaderVariantSkinned : ShaderVariantStatic;
@@ -608,6 +840,35 @@ void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest,
 	}
 }
 
+bool FSceneRenderer::CopyShadowDepthRegion(ID3D11ShaderResourceView* SourceSRV, ID3D11DepthStencilView* DestDSV, const D3D11_VIEWPORT& Region)
+{
+	UShader* FullScreenTriangleVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Utility/FullScreenTriangle_VS.hlsl");
+	UShader* ShadowDepthCopyPS = UResourceManager::GetInstance().Load<UShader>("Shaders/Shadows/ShadowDepthCopy_PS.hlsl");
+	if (!FullScreenTriangleVS || !FullScreenTriangleVS->GetVertexShader() || !ShadowDepthCopyPS || !ShadowDepthCopyPS->GetPixelShader())
+	{
+		UE_LOG("ShadowDepthCopy용 셰이더 없음!\n");
+		return false;
+	}
+
+	// 원본과 대상 아틀라스의 배치가 같으므로 Region 뷰포트의 픽셀 좌표로 그대로 읽어 SV_Depth로 쓴다
+	ID3D11DeviceContext* DeviceContext = RHIDevice->GetDeviceContext();
+	RHIDevice->OMSetCustomRenderTargets(0, nullptr, DestDSV);
+	DeviceContext->RSSetViewports(1, &Region);
+	RHIDevice->RSSetState(ERasterizerMode::Solid_NoCull);
+	RHIDevice->OMSetDepthStencilState(EComparisonFunc::AlwaysWrite);
+	RHIDevice->PrepareShader(FullScreenTriangleVS, ShadowDepthCopyPS);
+	DeviceContext->PSSetShaderResources(0, 1, &SourceSRV);
+
+	RHIDevice->DrawFullScreenQuad();
+
+	// 원본이 다음 패스에서 DSV로 바인딩될 수 있으므로 해제하고 섀도우 패스 상태로 복구
+	ID3D11ShaderResourceView* NullSRV = nullptr;
+	DeviceContext->PSSetShaderResources(0, 1, &NullSRV);
+	RHIDevice->RSSetState(ERasterizerMode::Shadows);
+	RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
+	return true;
+}
+
 
 //====================================================================================
 // Private 헬퍼 함수 구현
@@ -705,8 +966,20 @@ void FSceneRenderer::GatherVisibleProxies()
 	const bool bUseIcon = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_EditorIcon);	
 	const bool bDrawParticle = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Particle);
 
+	// BVH에 최신 바운드로 들어있는 스태틱 메시는 병렬 BVH 컬링 결과를 사용
+	UWorldPartitionManager* Partition = World->GetPartitionManager();
+	FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+	auto IsCulledByBVH = [Partition, BVH](UMeshComponent* MeshComponent)
+		{
+			return BVH
+				&& MeshComponent->IsA(UStaticMeshComponent::StaticClass())
+				&& BVH->Contains(MeshComponent)
+				&& !Partition->IsPendingUpdate(MeshComponent);
+		};
+	PerformFrustumCulling();
+
 	// Helper lambda to collect components from an actor
-	auto CollectComponentsFromActor = [&](AActor* Actor, bool bIsEditorActor)
+	auto CollectComponentsFromActor = [&](AActor* Actor, bool bIsEditorActor, FProxyGatherBucket& Out)
 		{
 			if (!Actor || !Actor->IsActorVisible() || !Actor->IsActorActive())
 			{
@@ -740,11 +1013,11 @@ void FSceneRenderer::GatherVisibleProxies()
 				{
 					if (UGizmoArrowComponent* GizmoComponent = Cast<UGizmoArrowComponent>(Component))
 					{
-						Proxies.OverlayPrimitives.Add(GizmoComponent);
+						Out.Proxies.OverlayPrimitives.Add(GizmoComponent);
 					}
 					else if (ULineComponent* LineComponent = Cast<ULineComponent>(Component))
 					{
-						Proxies.EditorLines.Add(LineComponent);
+						Out.Proxies.EditorLines.Add(LineComponent);
 					}
 
 					continue;
@@ -757,7 +1030,7 @@ void FSceneRenderer::GatherVisibleProxies()
 					{
 						if (bUseIcon)
 						{
-							Proxies.EditorPrimitives.Add(PrimitiveComponent);
+							Out.Proxies.EditorPrimitives.Add(PrimitiveComponent);
 						}
 						continue;
 					}
@@ -777,36 +1050,36 @@ void FSceneRenderer::GatherVisibleProxies()
 						    bShouldAdd = bDrawSkeletalMeshes;
 						}
 
-						// Frustum Culling 적용
-						if (bShouldAdd)
+						// Frustum Culling 적용 (BVH가 관리하는 스태틱 메시는 PerformFrustumCulling 결과로 수집)
+						if (bShouldAdd && !IsCulledByBVH(MeshComponent))
 						{
 							FAABB WorldAABB = MeshComponent->GetWorldAABB();
 							if (IsAABBVisible(ViewFrustum, WorldAABB))
 							{
-								Proxies.Meshes.Add(MeshComponent);
+								Out.Proxies.Meshes.Add(MeshComponent);
 							}
 						}
 					}
 					else if (UBillboardComponent* BillboardComponent = Cast<UBillboardComponent>(PrimitiveComponent); BillboardComponent && bUseBillboard)
 					{
 						// 빌보드는 프러스텀 컬링 제외 (항상 렌더링)
-						Proxies.Billboards.Add(BillboardComponent);
+						Out.Proxies.Billboards.Add(BillboardComponent);
 					}
 					else if (UDecalComponent* DecalComponent = Cast<UDecalComponent>(PrimitiveComponent); DecalComponent && bDrawDecals)
 					{
 						// Decal은 투영 기반이므로 일단 컬링 제외 (추후 OBB 기반 컬링 추가 필요)
-						Proxies.Decals.Add(DecalComponent);
+						Out.Proxies.Decals.Add(DecalComponent);
 					}
 					else if (ULineComponent* LineComponent = Cast<ULineComponent>(PrimitiveComponent))
 					{
-						Proxies.EditorLines.Add(LineComponent);
+						Out.Proxies.EditorLines.Add(LineComponent);
 					}
 					else if (UParticleSystemComponent* ParticleComponent = Cast<UParticleSystemComponent>(PrimitiveComponent))
 					{
 						if (bDrawParticle)
 						{
 							// 파티클은 프러스텀 컬링 제외 (항상 렌더링)
-							Proxies.Particles.Add(ParticleComponent);
+							Out.Proxies.Particles.Add(ParticleComponent);
 						}
 					}
 				}
@@ -814,35 +1087,35 @@ void FSceneRenderer::GatherVisibleProxies()
 				{
 					if (UHeightFogComponent* FogComponent = Cast<UHeightFogComponent>(Component); FogComponent && bDrawFog)
 					{
-						SceneGlobals.Fogs.Add(FogComponent);
+						Out.Globals.Fogs.Add(FogComponent);
 					}
                 else if (USkySphereComponent* SkyComponent = Cast<USkySphereComponent>(Component))
                 {
                     // Prefer the most recently encountered active/visible sky sphere
                     if (SkyComponent->IsActive() && SkyComponent->IsVisible())
                     {
-                        SceneGlobals.SkySphere = SkyComponent;
+                        Out.Globals.SkySphere = SkyComponent;
                     }
                 }
 					else if (UDirectionalLightComponent* LightComponent = Cast<UDirectionalLightComponent>(Component); LightComponent && bDrawLight)
 					{
-						SceneGlobals.DirectionalLights.Add(LightComponent);
+						Out.Globals.DirectionalLights.Add(LightComponent);
 					}
 
 					else if (UAmbientLightComponent* LightComponent = Cast<UAmbientLightComponent>(Component); LightComponent && bDrawLight)
 					{
-						SceneGlobals.AmbientLights.Add(LightComponent);
+						Out.Globals.AmbientLights.Add(LightComponent);
 					}
 
 					else if (UPointLightComponent* LightComponent = Cast<UPointLightComponent>(Component); LightComponent && bDrawLight)
 					{
 						if (USpotLightComponent* SpotLightComponent = Cast<USpotLightComponent>(LightComponent); SpotLightComponent)
 						{
-							SceneLocals.SpotLights.Add(SpotLightComponent);
+							Out.Locals.SpotLights.Add(SpotLightComponent);
 						}
 						else
 						{
-							SceneLocals.PointLights.Add(LightComponent);
+							Out.Locals.PointLights.Add(LightComponent);
 						}
 					}
 				}
@@ -850,16 +1123,37 @@ void FSceneRenderer::GatherVisibleProxies()
 		};
 
 	// Collect from Editor Actors (Gizmo, Grid, etc.)
+	FProxyGatherBucket EditorBucket;
 	for (AActor* EditorActor : World->GetEditorActors())
 	{
-		CollectComponentsFromActor(EditorActor, true);
+		CollectComponentsFromActor(EditorActor, true, EditorBucket);
 	}
+	EditorBucket.MergeInto(Proxies, SceneLocals, SceneGlobals);
 
-	
 	// Collect from Level Actors (including their Gizmo components)
-	for (AActor* Actor : World->GetActors())
+	// 액터 배열을 고정 크기 청크로 나눠 병렬 수집 후 청크 순서대로 병합 (워커 수와 무관하게 같은 결과)
+	const TArray<AActor*>& LevelActors = World->GetActors();
+	const int32 NumChunks = (LevelActors.Num() + GatherActorsPerChunk - 1) / GatherActorsPerChunk;
+	TArray<FProxyGatherBucket> Buckets;
+	Buckets.resize(NumChunks);
+	ParallelFor(NumChunks, [&](int32 ChunkIdx)
+		{
+			const int32 Begin = ChunkIdx * GatherActorsPerChunk;
+			const int32 End = std::min(Begin + GatherActorsPerChunk, LevelActors.Num());
+			for (int32 i = Begin; i < End; ++i)
+			{
+				CollectComponentsFromActor(LevelActors[i], false, Buckets[ChunkIdx]);
+			}
+		});
+	for (FProxyGatherBucket& Bucket : Buckets)
 	{
-		CollectComponentsFromActor(Actor, false);
+		Bucket.MergeInto(Proxies, SceneLocals, SceneGlobals);
+	}
+
+	// BVH 병렬 컬링을 통과한 스태틱 메시 (필터는 워커에서 이미 적용됨)
+	for (UPrimitiveComponent* Component : PotentiallyVisibleComponents)
+	{
+		Proxies.Meshes.Add(static_cast<UStaticMeshComponent*>(Component));
 	}
 
 	// 라이트 통계 업데이트
@@ -976,23 +1270,36 @@ void FSceneRenderer::PerformTileLightCulling()
 
 void FSceneRenderer::PerformFrustumCulling()
 {
-	PotentiallyVisibleComponents.clear();	// 할 필요 없는데 명목적으로 초기화
-
-	// Todo: 프로스텀 컬링 수행, 추후 프로스텀 컬링이 컴포넌트 단위로 변경되면 적용
-	// NOTE: 현재는 GatherVisibleProxies에서 직접 컬링 수행 중
-
-	//World->GetPartitionManager()->FrustumQuery(ViewFrustum)
-
-	//for (AActor* Actor : World->GetActors())
-	//{
-	//	if (!Actor || Actor->GetActorHiddenInEditor()) continue;
-	//
-	//	// 절두체 컬링을 통과한 액터만 목록에 추가
-	//	if (ViewFrustum.Intersects(Actor->GetBounds()))
-	//	{
-	//		PotentiallyVisibleActors.Add(Actor);
-	//	}
-	//}
+	PotentiallyVisibleComponents.clear();
+
+	if (!World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_StaticMeshes))
+	{
+		return;
+	}
+
+	UWorldPartitionManager* Partition = World->GetPartitionManager();
+	FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+	if (!BVH)
+	{
+		return;
+	}
+
+	// BVH 서브트리 단위 병렬 컬링. 필터는 GatherVisibleProxies의 스태틱 메시 수집 조건과 동일
+	// (워커에서 호출되므로 읽기 전용 검사만 수행)
+	const FFrustum& ViewFrustum = View->ViewFrustum;
+	BVH->QueryFrustumParallel(ViewFrustum, [Partition](UPrimitiveComponent* Component)
+		{
+			if (!Component->IsA(UStaticMeshComponent::StaticClass()) || Partition->IsPendingUpdate(Component))
+			{
+				return false;
+			}
+			AActor* Owner = Component->GetOwner();
+			if (!Owner || !Owner->IsActorVisible() || !Owner->IsActorActive())
+			{
+				return false;
+			}
+			return Component->IsVisible() && Component->IsEditable();
+		}, PotentiallyVisibleComponents);
 }
 
 void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
@@ -1005,7 +1312,7 @@ void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
 	}
 
 	// Collect normal billboards (not always-on-top, not LockOnIndicator)
-	TArray<FMeshBatchElement> LockOnBillboardBatches;
+	TFrameArray<FMeshBatchElement> LockOnBillboardBatches;
 	for (UBillboardComponent* BillboardComponent : Proxies.Billboards)
 	{
 		FString Name = BillboardComponent->GetName();
@@ -1034,12 +1341,17 @@ void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
 	}
 
 	// --- 2. 정렬 (Sort) ---
-	MeshBatchElements.Sort();
+	TFrameArray<uint32> SortedOrder;
+	SortMeshBatches(MeshBatchElements, EMeshDrawDepthOrder::FrontToBack, SortedOrder);
+
+	// --- 2.5 자동 인스턴싱 (정렬 후 연속된 같은 메시/머티리얼 배치를 합침) ---
+	TFrameArray<uint32> DrawOrder;
+	InstanceMeshBatches(MeshBatchElements, SortedOrder, DrawOrder);
 
 	// --- 3. 그리기 (Draw) ---
 	{
 		GPU_TIME_PROFILE("GPUSkinning")
-		DrawMeshBatches(MeshBatchElements, true);
+		DrawMeshBatches(MeshBatchElements, true, &DrawOrder);
 	}
 
 	// --- 3.5 LockOnIndicator 빌보드 (Translucent) ---
@@ -1052,7 +1364,7 @@ void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
 
 	// --- 4. Always-on-top billboards (depth test disabled) ---
 	MeshBatchElements.Empty();
-	TArray<FMeshBatchElement> AlwaysOnTopLockOnBatches;
+	TFrameArray<FMeshBatchElement> AlwaysOnTopLockOnBatches;
 	for (UBillboardComponent* BillboardComponent : Proxies.Billboards)
 	{
 		if (BillboardComponent->IsAlwaysOnTop())
@@ -1260,9 +1572,9 @@ void FSceneRenderer::RenderParticlePass()
 		ParticleComp->CollectMeshBatches(MeshBatchElements, View);
 	}
 
-	TArray<FMeshBatchElement> OpaqueParticleBatches;
-	TArray<FMeshBatchElement> TranslucentParticleBatches;
-	TArray<FMeshBatchElement> AdditiveParticleBatches;
+	TFrameArray<FMeshBatchElement> OpaqueParticleBatches;
+	TFrameArray<FMeshBatchElement> TranslucentParticleBatches;
+	TFrameArray<FMeshBatchElement> AdditiveParticleBatches;
 
 	for (const FMeshBatchElement& Batch : MeshBatchElements)
 	{
@@ -1287,28 +1599,32 @@ void FSceneRenderer::RenderParticlePass()
 	FParticleStatManager::GetInstance().AddDrawCalls(OpaqueParticleBatches.Num());
 	FParticleStatManager::GetInstance().AddDrawCalls(AdditiveParticleBatches.Num());
 
-	OpaqueParticleBatches.Sort();
+	// 불투명은 앞에서부터, 반투명은 뒤에서부터 (같은 렌더 상태 안에서)
+	TFrameArray<uint32> SortedOrder;
+
+	SortMeshBatches(OpaqueParticleBatches, EMeshDrawDepthOrder::FrontToBack, SortedOrder);
 	if (!OpaqueParticleBatches.IsEmpty())
 	{
 		RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
 		RHIDevice->OMSetBlendState(EMaterialBlendMode::Opaque);
-		DrawMeshBatches(OpaqueParticleBatches, true);
+		DrawMeshBatches(OpaqueParticleBatches, true, &SortedOrder);
 	}
 
-	TranslucentParticleBatches.Sort();
+	SortMeshBatches(TranslucentParticleBatches, EMeshDrawDepthOrder::BackToFront, SortedOrder);
 	if (!TranslucentParticleBatches.IsEmpty())
 	{
 		RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqualReadOnly);
 		RHIDevice->OMSetBlendState(EMaterialBlendMode::Translucent);
-		DrawMeshBatches(TranslucentParticleBatches, true);
+		DrawMeshBatches(TranslucentParticleBatches, true, &SortedOrder);
 	}
 
-	AdditiveParticleBatches.Sort();
+	// 가산 블렌딩은 순서와 무관하므로 깊이 정렬 없이 상태만 묶는다
+	SortMeshBatches(AdditiveParticleBatches, EMeshDrawDepthOrder::None, SortedOrder);
 	if (!AdditiveParticleBatches.IsEmpty())
 	{
 		RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqualReadOnly);
 		RHIDevice->OMSetBlendState(EMaterialBlendMode::Additive);
-		DrawMeshBatches(AdditiveParticleBatches, true);
+		DrawMeshBatches(AdditiveParticleBatches, true, &SortedOrder);
 	}
 
 	// Renderer 복구
@@ -1359,6 +1675,9 @@ void FSceneRenderer::RenderDecalPass()
 	RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqualReadOnly); // 깊이 쓰기 OFF
 	RHIDevice->OMSetBlendState(EMaterialBlendMode::Translucent);
 
+	// Decal이 그려질 Primitives (데칼마다 비우고 재사용)
+	TArray<UPrimitiveComponent*> TargetPrimitives;
+
 	for (UDecalComponent* Decal : Proxies.Decals)
 	{
 		if (!Decal || !Decal->GetDecalTexture())
@@ -1366,33 +1685,30 @@ void FSceneRenderer::RenderDecalPass()
 			continue;
 		}
 
-		// Decal이 그려질 Primitives
-		TArray<UPrimitiveComponent*> TargetPrimitives;
-
-		// 1. Decal의 World AABB와 충돌한 모든 StaticMeshComponent 쿼리
-		const FOBB DecalOBB = Decal->GetWorldOBB();
-		TArray<UPrimitiveComponent*> IntersectedStaticMeshComponents = BVH->QueryIntersectedComponents(DecalOBB);
+		TargetPrimitives.clear();
 
+		// 1. Decal의 World OBB와 충돌한 모든 StaticMeshComponent 쿼리
 		// 2. 충돌한 모든 visible Actor의 PrimitiveComponent를 TargetPrimitives에 추가
 		// Actor에 기본으로 붙어있는 TextRenderComponent, BoundingBoxComponent는 decal 적용 안되게 하기 위해,
 		// 임시로 PrimitiveComponent가 아닌 UStaticMeshComponent를 받도록 함
-		for (UPrimitiveComponent* SMC : IntersectedStaticMeshComponents)
+		const FOBB DecalOBB = Decal->GetWorldOBB();
+		BVH->ForEachIntersectedComponent(DecalOBB, [&TargetPrimitives](UPrimitiveComponent* SMC)
 		{
 			// 기즈모에 데칼 입히면 안되므로 에디팅이 안되는 Component는 데칼 그리지 않음
 			if (!SMC || !SMC->IsEditable())
-				continue;
+				return;
 
 			// 스켈레탈 메시는 데칼 렌더링에서 제외 (성능 최적화)
 			if (Cast<USkeletalMeshComponent>(SMC))
-				continue;
+				return;
 
 			AActor* Owner = SMC->GetOwner();
 			if (!Owner || !Owner->IsActorVisible())
-				continue;
+				return;
 
 			FDecalStatManager::GetInstance().IncrementAffectedMeshCount();
 			TargetPrimitives.push_back(SMC);
-		}
+		});
 
 		// --- 데칼 렌더 시간 측정 시작 ---
 		auto CpuTimeStart = std::chrono::high_resolution_clock::now();
@@ -1730,11 +2046,44 @@ void FSceneRenderer::RenderFinalOverlayLines()
     OwnerRenderer->EndLineBatchAlwaysOnTop(FMatrix::Identity());
 }
 
+// 수집한 Batch 정렬 (키 생성 + 기수 정렬)
+void FSceneRenderer::SortMeshBatches(TFrameArray<FMeshBatchElement>& InMeshBatches, EMeshDrawDepthOrder DepthOrder, TFrameArray<uint32>& OutSortedOrder)
+{
+	OutSortedOrder.SetNum(InMeshBatches.Num());
+	FMeshDrawSort::SortBatches(InMeshBatches.data(), InMeshBatches.Num(), View->ViewLocation, DepthOrder, OutSortedOrder.data());
+}
+
+// 정렬된 Batch 중 합칠 수 있는 구간을 인스턴스 드로우로 바꾸고 인스턴스 데이터 업로드
+void FSceneRenderer::InstanceMeshBatches(TFrameArray<FMeshBatchElement>& InOutMeshBatches, const TFrameArray<uint32>& InSortedOrder, TFrameArray<uint32>& OutDrawOrder)
+{
+	const int32 NumBatches = InOutMeshBatches.Num();
+	TFrameArray<FMeshInstanceData> Instances;
+	const int32 NumInstancedDraws = FMeshAutoInstancing::MergeInstancedRuns(InOutMeshBatches, InSortedOrder, OutDrawOrder, Instances);
+
+	if (0 < NumInstancedDraws)
+	{
+		ID3D11ShaderResourceView* InstanceSRV = OwnerRenderer->UploadMeshInstances(Instances.data(), static_cast<uint32>(Instances.Num()));
+		if (!InstanceSRV)
+		{
+			// 업로드 실패 시 합치기 전 순서로 그린다 (추가된 인스턴스 드로우는 순서에 없으므로 그려지지 않음)
+			OutDrawOrder = InSortedOrder;
+			FMeshAutoInstancing::AddFrameStats(NumBatches, NumBatches, 0, 0);
+			return;
+		}
+		for (int32 BatchIndex = NumBatches; BatchIndex < InOutMeshBatches.Num(); ++BatchIndex)
+		{
+			InOutMeshBatches[BatchIndex].InstanceDataSRV = InstanceSRV;
+		}
+	}
+
+	FMeshAutoInstancing::AddFrameStats(NumBatches, OutDrawOrder.Num(), NumInstancedDraws, Instances.Num());
+}
+
 // 수집한 Batch 그리기
-void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw)
+void FSceneRenderer::DrawMeshBatches(TFrameArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw, const TFrameArray<uint32>* InSortedOrder)
 {
 	if (InMeshBatches.IsEmpty()) return;
-	constexpr UINT ParticleInstanceDataSlot = 14;
+	constexpr UINT InstanceDataSlot = 14; // 인스턴스 데이터 StructuredBuffer (t14)
 
 	// RHI 상태 초기 설정 (Opaque Pass 기본값)
 	// RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual); // 깊이 쓰기 ON
@@ -1770,12 +2119,15 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 	ID3D11SamplerState* VSMSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::VSM);
 
 	// 정렬된 리스트 순회
-	for (const FMeshBatchElement& Batch : InMeshBatches)
+	const int32 NumBatches = InMeshBatches.Num();
+	assert(!InSortedOrder || InSortedOrder->Num() == NumBatches);
+	for (int32 DrawIndex = 0; DrawIndex < NumBatches; ++DrawIndex)
 	{
+		const FMeshBatchElement& Batch = InMeshBatches[InSortedOrder ? (*InSortedOrder)[DrawIndex] : DrawIndex];
 		// --- 필수 요소 유효성 검사 ---
 		const bool bMissingShaders = (!Batch.VertexShader || !Batch.PixelShader);
 		const bool bNeedsGeometryBuffers = (!Batch.VertexBuffer || !Batch.IndexBuffer || Batch.VertexStride == 0) ||
-			(Batch.bInstancedDraw && (!Batch.InstanceVertexBuffer || Batch.InstanceStride == 0));
+			(Batch.bInstancedDraw && !Batch.InstanceDataSRV && (!Batch.InstanceVertexBuffer || Batch.InstanceStride == 0));
 		const bool bMissingGeometry = bNeedsGeometryBuffers && (!Batch.VertexBuffer || !Batch.IndexBuffer || Batch.VertexStride == 0);
 		const bool bInvalidInstancing = Batch.bInstancedDraw && Batch.InstanceCount == 0;
 		if (bMissingShaders || bMissingGeometry || bInvalidInstancing)
@@ -1917,11 +2269,12 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 			CurrentSkinNormalMatrixSRV = Batch.GPUSkinNormalMatrixSRV;
 		}
 
-		if (CurrentInstancingSRV)
+		// 자동 인스턴싱 드로우의 인스턴스 데이터 (t14), 다른 배치에서는 해제
+		if (Batch.InstanceDataSRV != CurrentInstancingSRV)
 		{
-			ID3D11ShaderResourceView* SRV = nullptr;
-			RHIDevice->GetDeviceContext()->VSSetShaderResources(ParticleInstanceDataSlot, 1, &SRV);
-			CurrentInstancingSRV = nullptr;
+			ID3D11ShaderResourceView* SRV = Batch.InstanceDataSRV;
+			RHIDevice->GetDeviceContext()->VSSetShaderResources(InstanceDataSlot, 1, &SRV);
+			CurrentInstancingSRV = Batch.InstanceDataSRV;
 		}
 
 		// 3. IA (Input Assembler) 상태 변경
@@ -1937,7 +2290,7 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 				continue;
 			}
 
-			if (Batch.bInstancedDraw)
+			if (Batch.bInstancedDraw && Batch.InstanceVertexBuffer)
 			{
 				// 두 개의 VB: 0 = mesh, 1 = instance
 				ID3D11Buffer* vbs[2] = { Batch.VertexBuffer, Batch.InstanceVertexBuffer };
@@ -1970,7 +2323,9 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 
 		// 4. 오브젝트별 상수 버퍼 설정 (매번 변경)
 		RHIDevice->SetAndUpdateConstantBuffer(ModelBufferType(Batch.WorldMatrix, Batch.WorldMatrix.InverseAffine().Transpose()));
-		RHIDevice->SetAndUpdateConstantBuffer(ColorBufferType(Batch.InstanceColor, Batch.ObjectID));
+		// 자동 인스턴싱 드로우는 SV_InstanceID가 StartInstanceLocation을 포함하지 않으므로 시작 위치를 상수 버퍼로 넘김
+		const uint32 InstanceOffset = Batch.InstanceDataSRV ? Batch.InstanceStart : 0;
+		RHIDevice->SetAndUpdateConstantBuffer(ColorBufferType(Batch.InstanceColor, Batch.ObjectID, InstanceOffset));
 
 		// Wind animation constant buffer (per-batch enable flag)
 		{
@@ -2030,7 +2385,8 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 		{
 			if (Batch.IndexBuffer && Batch.VertexBuffer && Batch.VertexStride > 0)
 			{
-				RHIDevice->GetDeviceContext()->DrawIndexedInstanced(Batch.IndexCount, Batch.InstanceCount, Batch.StartIndex, Batch.BaseVertexIndex, Batch.InstanceStart);
+				const UINT StartInstance = Batch.InstanceDataSRV ? 0 : Batch.InstanceStart;
+				RHIDevice->GetDeviceContext()->DrawIndexedInstanced(Batch.IndexCount, Batch.InstanceCount, Batch.StartIndex, Batch.BaseVertexIndex, StartInstance);
 			}
 			else
 			{
@@ -2050,7 +2406,7 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 		if (CurrentInstancingSRV)
 		{
 			ID3D11ShaderResourceView* SRV = nullptr;
-			RHIDevice->GetDeviceContext()->VSSetShaderResources(ParticleInstanceDataSlot, 1, &SRV);
+			RHIDevice->GetDeviceContext()->VSSetShaderResources(InstanceDataSlot, 1, &SRV);
 			CurrentInstancingSRV = nullptr;
 		}
 	}
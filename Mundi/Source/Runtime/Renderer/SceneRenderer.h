@@ -35,6 +35,7 @@ class ULineComponent;
 class UParticleSystemComponent;
 
 struct FCandidateDrawable;
+enum class EMeshDrawDepthOrder : uint8;
 
 // 렌더링할 대상들의 집합을 담는 구조체
 struct FVisibleRenderProxySet
@@ -54,6 +55,21 @@ struct FVisibleRenderProxySet
 	TArray<UPrimitiveComponent*> OverlayPrimitives; // 트랜스폼 기즈모
 };
 
+// 섀도우 요청 하나가 그릴 캐스터 배치 구간 (GatherShadowCasters의 OutBatchIndices 기준)
+struct FShadowCasterRange
+{
+	uint32 Start = 0;
+	uint32 Num = 0;
+};
+
+// 섀도우 요청 하나의 캐스터 (정적 레이어는 FShadowMapCache로 재사용, 동적 레이어는 매 프레임 그림)
+struct FShadowRequestCasters
+{
+	FShadowCasterRange StaticCasters;
+	FShadowCasterRange DynamicCasters;
+	uint64 StaticSignature = 0; // 정적 캐스터 집합 + 각 캐스터의 마지막 변경 프레임
+};
+
 struct FSceneLocals
 {
 	TArray<UPointLightComponent*> PointLights;
@@ -90,7 +106,18 @@ private:
 	void RenderSceneDepthPath();
 
 	void RenderShadowMaps();
-	void RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches);
+	/**
+	 * @brief 섀도우 요청마다 라이트 볼륨과 겹치는 캐스터를 모아 배치 인덱스 구간을 만듭니다.
+	 * 스태틱 메시는 BVH 쿼리 결과(FShadowCasterCache), 나머지는 현재 바운드로 직접 판정합니다.
+	 * BVH에 반영된 채 StaticSettleFrames 이상 움직이지 않은 스태틱 메시는 정적, 나머지는 동적 구간으로 나눕니다.
+	 * @param OutCasters Requests2D 다음 RequestsCube 순서
+	 */
+	void GatherShadowCasters(const TArray<FShadowRenderRequest>& Requests2D, const TArray<FShadowRenderRequest>& RequestsCube,
+		TFrameArray<FMeshBatchElement>& OutBatches, TFrameArray<uint32>& OutBatchIndices, TFrameArray<FShadowRequestCasters>& OutCasters);
+	void RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TFrameArray<FMeshBatchElement>& InShadowBatches,
+		const TFrameArray<uint32>& InBatchIndices, const FShadowCasterRange& InRange);
+	/** @brief 같은 배치의 2D 섀도우 아틀라스 사이에서 Region 영역의 깊이를 복사합니다. (DestDSV는 바인딩된 채로 남음) */
+	bool CopyShadowDepthRegion(ID3D11ShaderResourceView* SourceSRV, ID3D11DepthStencilView* DestDSV, const D3D11_VIEWPORT& Region);
 
 	/** @brief 렌더링에 필요한 포인터들이 유효한지 확인합니다. */
 	bool IsValid() const;
@@ -98,7 +125,7 @@ private:
 	/** @brief 렌더링에 필요한 뷰 행렬, 절두체 등 프레임 데이터를 준비합니다. */
 	void PrepareView();
 
-	/** @brief 월드의 모든 액터를 대상으로 절두체 컬링을 수행합니다. */
+	/** @brief BVH에 등록된 스태틱 메시를 대상으로 병렬 절두체 컬링을 수행합니다. (결과: PotentiallyVisibleComponents) */
 	void PerformFrustumCulling();
 
 	/** @brief 씬을 순회하며 컬링을 통과한 모든 렌더링 대상을 수집합니다. */
@@ -110,7 +137,14 @@ private:
 	/** @brief 불투명(Opaque) 객체들을 렌더링하는 패스입니다. */
 	void RenderOpaquePass(EViewMode InRenderViewMode);
 
-	void DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw);
+	/** @brief 배치별 64비트 정렬 키를 만들고 (키, 인덱스) 기수 정렬로 그릴 순서를 구합니다. 배치 자체는 옮기지 않습니다. */
+	void SortMeshBatches(TFrameArray<FMeshBatchElement>& InMeshBatches, EMeshDrawDepthOrder DepthOrder, TFrameArray<uint32>& OutSortedOrder);
+
+	/** @brief 정렬 순서에서 연속된 같은 메시/머티리얼 배치를 인스턴스 드로우로 합치고 인스턴스 버퍼를 올립니다. (FMeshAutoInstancing) */
+	void InstanceMeshBatches(TFrameArray<FMeshBatchElement>& InOutMeshBatches, const TFrameArray<uint32>& InSortedOrder, TFrameArray<uint32>& OutDrawOrder);
+
+	/** @param InSortedOrder 있으면 이 인덱스 순서대로 그림 (SortMeshBatches 결과), 없으면 배열 순서 */
+	void DrawMeshBatches(TFrameArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw, const TFrameArray<uint32>* InSortedOrder = nullptr);
 
 	void RenderSkyPass();
 	void RenderParticlePass();
@@ -149,11 +183,11 @@ private:
 	// 씬 전역 설정
 	FSceneGlobals SceneGlobals;
 
-	// 컬링을 거친 가시성 목록, NOTE: 추후 컴포넌트 단위로 수정
+	// BVH 병렬 컬링을 통과한 스태틱 메시 목록 (BVH 전위 순서)
 	TArray<UPrimitiveComponent*> PotentiallyVisibleComponents;
 
 	// 각 패스에서 수집된 드로우 콜 정보 리스트
-	TArray<FMeshBatchElement> MeshBatchElements;
+	TFrameArray<FMeshBatchElement> MeshBatchElements;
 
 	// 타일 기반 라이트 컬링 시스템 (매 프레임 생성되고 소멸되어서 스마트 포인터로 설정)
 	std::unique_ptr<FTileLightCuller> TileLightCuller;
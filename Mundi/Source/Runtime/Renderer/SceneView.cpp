@@ -3,6 +3,7 @@
 #include "CameraActor.h"
 #include "FViewport.h"
 #include "Frustum.h"
+#include "Shader.h"
 
 FSceneView::FSceneView(FMinimalViewInfo* InMinimalViewInfo, URenderSettings* InRenderSettings)
 	: RenderSettings(InRenderSettings)
@@ -51,6 +52,7 @@ FSceneView::FSceneView(FMinimalViewInfo* InMinimalViewInfo, URenderSettings* InR
 	);
 
 	ViewShaderMacros = CreateViewShaderMacros();
+	ViewShaderMacroKey = UShader::GenerateShaderKey(ViewShaderMacros);
 }
 
 FSceneView::FSceneView(UCameraComponent* InCamera, FViewport* InViewport, URenderSettings* InRenderSettings)
@@ -88,6 +90,7 @@ FSceneView::FSceneView(UCameraComponent* InCamera, FViewport* InViewport, URende
 	ProjectionMode = InCamera->GetProjectionMode();
 
 	ViewShaderMacros = CreateViewShaderMacros();
+	ViewShaderMacroKey = UShader::GenerateShaderKey(ViewShaderMacros);
 }
 
 TArray<FShaderMacro> FSceneView::CreateViewShaderMacros()
@@ -68,6 +68,8 @@ public:
     // 렌더링 설정
     ECameraProjectionMode ProjectionMode = ECameraProjectionMode::Perspective;
     TArray<FShaderMacro> ViewShaderMacros;
+    // ViewShaderMacros의 셰이더 키 (UShader::GenerateShaderKey), 캐시된 드로우 커맨드가 같은 뷰 매크로로 만들어졌는지 비교용
+    uint64 ViewShaderMacroKey = 0;
     float NearClip = 0.0f;
     float FarClip = 0.0f;
     float FieldOfView = 0.0f;
@@ -52,6 +52,8 @@ UShader::~UShader()
 	ReleaseResources();
 }
 
+uint32 UShader::ReloadGeneration = 0;
+
 uint64 UShader::GenerateShaderKey(const TArray<FShaderMacro>& InMacros)
 {
 	// 1. TMap을 사용해 중복 제거
@@ -443,9 +445,12 @@ bool UShader::Reload(ID3D11Device* InDevice)
 
 	UE_LOG("Hot Reloading Shader File: %s (%d variants)", FilePath.c_str(), ShaderVariantMap.Num());
 
+	// 성공/실패와 관계없이 변형 포인터가 바뀔 수 있으므로 캐시된 드로우 커맨드를 모두 다시 만들게 한다
+	++ReloadGeneration;
+
 	// 2. [백업] 현재 맵을 Old 맵으로 이동시킵니다.
 	// (ShaderVariantMap은 이제 비어있습니다)
-	TMap<uint64, FShaderVariant> OldShaderVariantMap = std::move(ShaderVariantMap);
+	TStableMap<uint64, FShaderVariant> OldShaderVariantMap = std::move(ShaderVariantMap);
 
 	bool bAllReloadsSuccessful = true;
 
@@ -543,6 +548,7 @@ void UShader::ParseIncludeFiles(const FString& ShaderPath)
 {
 	// 이미 파싱된 파일 목록 초기화
 	IncludedFiles.clear();
+	bSupportsInstancing = false;
 
 	// 파싱할 파일 큐
 	TArray<FString> FilesToParse;
@@ -591,6 +597,11 @@ void UShader::ParseIncludeFiles(const FString& ShaderPath)
 			}
 			Line = Line.substr(FirstNonSpace);
 
+			if (!bSupportsInstancing && Line.find("USE_INSTANCING") != FString::npos)
+			{
+				bSupportsInstancing = true;
+			}
+
 			// #include 지시문 찾기
 			if (Line.compare(0, 8, "#include") == 0)
 			{
@@ -62,21 +62,31 @@ public:
 	// Hot Reload Support
 	bool IsOutdated() const;
 	bool Reload(ID3D11Device* InDevice);
+	/** 핫 리로드가 일어날 때마다 증가 (변형의 셰이더 포인터를 보관하는 캐시 무효화용) */
+	static uint32 GetReloadGeneration() { return ReloadGeneration; }
 	//const TArray<FShaderMacro>& GetMacros() const { return Macros; }
 
 	static bool HasMacro(const TArray<FShaderMacro>& InMacros, const FString& InMacroName);
+
+	/** 소스(또는 include)가 USE_INSTANCING 변형을 제공하는지 (자동 인스턴싱 대상 판단용, Load 시 파싱) */
+	bool SupportsInstancing() const { return bSupportsInstancing; }
 	
 protected:
 	virtual ~UShader();
 
 private:
-	TMap<uint64, FShaderVariant> ShaderVariantMap;
+	static uint32 ReloadGeneration;
+
+	// GetOrCompileShaderVariant가 값 포인터를 돌려주고 호출 측이 다른 변형을 컴파일한 뒤에도 쓰므로 주소가 유지되는 맵 사용
+	TStableMap<uint64, FShaderVariant> ShaderVariantMap;
 
 	// Store included files (e.g., "Shaders/Common/LightingCommon.hlsl")
 	// Used for hot reload - if any included file changes, reload this shader
 	TArray<FString> IncludedFiles;
 	TMap<FString, std::filesystem::file_time_type> IncludedFileTimestamps;
 
+	bool bSupportsInstancing = false;
+
 	void CreateInputLayout(ID3D11Device* Device, const FString& InShaderPath, FShaderVariant& InOutVariant);
 	void ReleaseResources();
 
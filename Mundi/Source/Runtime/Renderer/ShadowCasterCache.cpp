@@ -0,0 +1,111 @@
+﻿#include "pch.h"
+#include "ShadowCasterCache.h"
+#include "LightManager.h"
+#include "WorldPartitionManager.h"
+#include "BVHierarchy.h"
+#include "StaticMeshComponent.h"
+#include "OBB.h"
+#include "AABB.h"
+#include "ParallelFor.h"
+#include <cfloat>
+
+FOBB FShadowCasterCache::BuildShadowVolume(const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix)
+{
+	// 클립 공간 꼭짓점(D3D: z 0~1)을 라이트 뷰 공간으로 되돌려 AABB를 만들고, 뷰 역행렬로 월드에 놓는다
+	// 직교 투영이면 절두체와 정확히 같고, 원근 투영이면 원뿔/피라미드를 감싸는 상자가 된다
+	const FMatrix InvProjection = ProjectionMatrix.Inverse();
+	FVector Min(FLT_MAX, FLT_MAX, FLT_MAX);
+	FVector Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	for (int32 CornerIndex = 0; CornerIndex < 8; ++CornerIndex)
+	{
+		const FVector4 ClipCorner(
+			(CornerIndex & 1) ? 1.0f : -1.0f,
+			(CornerIndex & 2) ? 1.0f : -1.0f,
+			(CornerIndex & 4) ? 1.0f : 0.0f,
+			1.0f);
+		const FVector4 ViewCorner4 = ClipCorner * InvProjection;
+		const float InvW = 1.0f / ViewCorner4.W;
+		const FVector ViewCorner(ViewCorner4.X * InvW, ViewCorner4.Y * InvW, ViewCorner4.Z * InvW);
+
+		Min.X = FMath::Min(Min.X, ViewCorner.X);
+		Min.Y = FMath::Min(Min.Y, ViewCorner.Y);
+		Min.Z = FMath::Min(Min.Z, ViewCorner.Z);
+		Max.X = FMath::Max(Max.X, ViewCorner.X);
+		Max.Y = FMath::Max(Max.Y, ViewCorner.Y);
+		Max.Z = FMath::Max(Max.Z, ViewCorner.Z);
+	}
+
+	return FOBB(FAABB(Min, Max), ViewMatrix.InverseAffine());
+}
+
+void FShadowCasterCache::QueryCasters(const UWorldPartitionManager* Partition, const TFrameArray<const FShadowRenderRequest*>& Requests,
+	TFrameArray<FOBB>& OutVolumes, TFrameArray<const TArray<UPrimitiveComponent*>*>& OutStaticCasters)
+{
+	LastHitCount = 0;
+	LastMissCount = 0;
+
+	const int32 NumRequests = Requests.Num();
+	OutVolumes.SetNum(NumRequests);
+	OutStaticCasters.SetNum(NumRequests);
+
+	const FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+	const uint64 Revision = Partition ? Partition->GetStaticBoundsRevision() : 0;
+
+	// 1. 엔트리 확보 (삽입하면 TMap 값 주소가 바뀔 수 있으므로 포인터를 잡기 전에 모두 끝낸다)
+	for (const FShadowRenderRequest* Request : Requests)
+	{
+		TArray<FEntry>& LightEntries = Entries[Request->LightOwner];
+		if (LightEntries.Num() <= Request->SubViewIndex)
+		{
+			LightEntries.SetNum(Request->SubViewIndex + 1);
+		}
+	}
+
+	// 2. 적중 판정. 미스는 키를 먼저 갱신해 두므로 같은 (라이트, 서브뷰)가 두 번 나와도 쿼리는 한 번만 한다
+	TFrameArray<int32> MissRequests;
+	TFrameArray<FEntry*> MissEntries;
+	for (int32 RequestIndex = 0; RequestIndex < NumRequests; ++RequestIndex)
+	{
+		const FShadowRenderRequest& Request = *Requests[RequestIndex];
+		FEntry& Entry = (*Entries.Find(Request.LightOwner))[Request.SubViewIndex];
+
+		OutVolumes[RequestIndex] = BuildShadowVolume(Request.ViewMatrix, Request.ProjectionMatrix);
+		OutStaticCasters[RequestIndex] = &Entry.StaticCasters;
+
+		const bool bHit = Entry.bValid
+			&& Entry.StaticBoundsRevision == Revision
+			&& Entry.ViewMatrix == Request.ViewMatrix
+			&& Entry.ProjectionMatrix == Request.ProjectionMatrix;
+		if (bHit)
+		{
+			++LastHitCount;
+			continue;
+		}
+
+		++LastMissCount;
+		Entry.ViewMatrix = Request.ViewMatrix;
+		Entry.ProjectionMatrix = Request.ProjectionMatrix;
+		Entry.StaticBoundsRevision = Revision;
+		Entry.bValid = BVH != nullptr;
+		Entry.StaticCasters.clear();
+		if (BVH)
+		{
+			MissRequests.Add(RequestIndex);
+			MissEntries.Add(&Entry);
+		}
+	}
+
+	// 3. 미스 요청만 BVH 쿼리 (엔트리마다 자기 배열만 쓰고 BVH는 읽기 전용이므로 락 없이 병렬)
+	ParallelFor(MissRequests.Num(), [&](int32 MissIndex)
+		{
+			const FOBB& Volume = OutVolumes[MissRequests[MissIndex]];
+			TArray<UPrimitiveComponent*>& StaticCasters = MissEntries[MissIndex]->StaticCasters;
+			BVH->ForEachIntersectedComponent(Volume, [&StaticCasters](UPrimitiveComponent* Component)
+				{
+					if (Component->IsA(UStaticMeshComponent::StaticClass()))
+					{
+						StaticCasters.Add(Component);
+					}
+				});
+		});
+}
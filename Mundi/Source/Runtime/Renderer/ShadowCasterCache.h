@@ -0,0 +1,50 @@
+﻿#pragma once
+
+class ULightComponent;
+class UPrimitiveComponent;
+class UWorldPartitionManager;
+struct FShadowRenderRequest;
+struct FOBB;
+
+/**
+ * @brief 섀도우 요청(라이트 + 서브뷰)별 스태틱 캐스터 후보 캐시
+ * - 요청의 뷰/프로젝션 절두체(CSM 캐스케이드, 스포트 원뿔, 포인트 큐브 면)를 감싸는 OBB로 월드 BVH를 쿼리
+ * - 라이트 행렬과 파티션의 StaticBoundsRevision이 그대로면 이전 쿼리 결과를 재사용
+ * - 캐시 미스가 난 요청들의 BVH 쿼리는 워커 풀에서 요청 단위로 병렬 수행
+ * - 결과는 BVH에 들어있는 스태틱 메시 전부(가시성/그림자 플래그 확인 전)이므로 호출자가 걸러서 사용
+ */
+class FShadowCasterCache
+{
+public:
+	/** 라이트 뷰/프로젝션 절두체를 라이트 뷰 공간 AABB로 감싼 월드 OBB (직교/원근 공용) */
+	static FOBB BuildShadowVolume(const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix);
+
+	/**
+	 * Requests 순서대로 OutVolumes / OutStaticCasters를 채운다
+	 * OutStaticCasters의 포인터는 다음 QueryCasters / RemoveLight / Clear 호출 전까지만 유효
+	 */
+	void QueryCasters(const UWorldPartitionManager* Partition, const TFrameArray<const FShadowRenderRequest*>& Requests,
+		TFrameArray<FOBB>& OutVolumes, TFrameArray<const TArray<UPrimitiveComponent*>*>& OutStaticCasters);
+
+	void RemoveLight(ULightComponent* Light) { Entries.Remove(Light); }
+	void Clear() { Entries.clear(); }
+
+	uint32 GetLastHitCount() const { return LastHitCount; }
+	uint32 GetLastMissCount() const { return LastMissCount; }
+
+private:
+	struct FEntry
+	{
+		FMatrix ViewMatrix;
+		FMatrix ProjectionMatrix;
+		uint64 StaticBoundsRevision = 0;
+		bool bValid = false;
+		TArray<UPrimitiveComponent*> StaticCasters;
+	};
+
+	// Key: 라이트, Value: SubViewIndex별 엔트리 (CSM 캐스케이드 / 큐브 면)
+	TMap<ULightComponent*, TArray<FEntry>> Entries;
+
+	uint32 LastHitCount = 0;
+	uint32 LastMissCount = 0;
+};
@@ -0,0 +1,194 @@
+﻿#include "pch.h"
+#include "ShadowMapCache.h"
+#include "LightManager.h"
+#include "Shader.h"
+
+FShadowMapCache::~FShadowMapCache()
+{
+	Release();
+}
+
+uint64 FShadowMapCache::MixSignature(uint64 A, uint64 B)
+{
+	// splitmix64 finalizer. 합산해도 캐스터가 바뀌거나 빠지면 값이 달라지도록 비트를 충분히 섞는다
+	uint64 Hash = A ^ (B * 0x9E3779B97F4A7C15ull);
+	Hash = (Hash ^ (Hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+	Hash = (Hash ^ (Hash >> 27)) * 0x94D049BB133111EBull;
+	return Hash ^ (Hash >> 31);
+}
+
+void FShadowMapCache::Initialize(ID3D11Device* Device, ID3D11Texture2D* LiveAtlas2D, ID3D11Texture2D* LiveAtlasCube)
+{
+	if (!Device)
+	{
+		return;
+	}
+
+	// 2D: 라이브 아틀라스와 같은 desc (R24G8_TYPELESS, DSV + SRV). 렌더 영역 간 깊이 복사는 풀스크린 패스로 수행
+	if (LiveAtlas2D && !StaticAtlasTexture2D)
+	{
+		D3D11_TEXTURE2D_DESC TexDesc = {};
+		LiveAtlas2D->GetDesc(&TexDesc);
+
+		HRESULT hr = Device->CreateTexture2D(&TexDesc, nullptr, &StaticAtlasTexture2D);
+		if (FAILED(hr))
+		{
+			UE_LOG("FShadowMapCache::Initialize: CreateTexture2D for StaticAtlas2D failed!");
+			StaticAtlasTexture2D = nullptr;
+		}
+		else
+		{
+			D3D11_DEPTH_STENCIL_VIEW_DESC dsvDesc = {};
+			dsvDesc.Format = DXGI_FORMAT_D24_UNORM_S8_UINT;
+			dsvDesc.ViewDimension = D3D11_DSV_DIMENSION_TEXTURE2D;
+			dsvDesc.Texture2D.MipSlice = 0;
+			if (FAILED(Device->CreateDepthStencilView(StaticAtlasTexture2D, &dsvDesc, &StaticAtlasDSV2D)))
+			{
+				UE_LOG("FShadowMapCache::Initialize: CreateDepthStencilView for StaticAtlas2D failed!");
+			}
+
+			D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+			srvDesc.Format = DXGI_FORMAT_R24_UNORM_X8_TYPELESS;
+			srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+			srvDesc.Texture2D.MostDetailedMip = 0;
+			srvDesc.Texture2D.MipLevels = 1;
+			if (FAILED(Device->CreateShaderResourceView(StaticAtlasTexture2D, &srvDesc, &StaticAtlasSRV2D)))
+			{
+				UE_LOG("FShadowMapCache::Initialize: CreateShaderResourceView for StaticAtlas2D failed!");
+			}
+		}
+	}
+
+	// 큐브: 면이 통째로 하나의 서브리소스이므로 같은 desc로 만들어 CopySubresourceRegion으로 주고받는다
+	if (LiveAtlasCube && !StaticAtlasTextureCube)
+	{
+		D3D11_TEXTURE2D_DESC CubeDesc = {};
+		LiveAtlasCube->GetDesc(&CubeDesc);
+
+		if (FAILED(Device->CreateTexture2D(&CubeDesc, nullptr, &StaticAtlasTextureCube)))
+		{
+			UE_LOG("FShadowMapCache::Initialize: CreateTexture2D for StaticAtlasCube failed!");
+			StaticAtlasTextureCube = nullptr;
+		}
+	}
+}
+
+void FShadowMapCache::Release()
+{
+	if (StaticAtlasSRV2D) { StaticAtlasSRV2D->Release(); StaticAtlasSRV2D = nullptr; }
+	if (StaticAtlasDSV2D) { StaticAtlasDSV2D->Release(); StaticAtlasDSV2D = nullptr; }
+	if (StaticAtlasTexture2D) { StaticAtlasTexture2D->Release(); StaticAtlasTexture2D = nullptr; }
+	if (StaticAtlasTextureCube) { StaticAtlasTextureCube->Release(); StaticAtlasTextureCube = nullptr; }
+
+	Entries.clear();
+	FrameLightHits.clear();
+}
+
+bool FShadowMapCache::AcquireStaticLayer(const FShadowRenderRequest& Request, uint64 StaticSignature, bool bCube)
+{
+	TArray<FEntry>& LightEntries = Entries[Request.LightOwner];
+	if (LightEntries.Num() <= Request.SubViewIndex)
+	{
+		LightEntries.SetNum(Request.SubViewIndex + 1);
+	}
+	FEntry& Entry = LightEntries[Request.SubViewIndex];
+
+	const uint32 ShaderGeneration = UShader::GetReloadGeneration();
+	const bool bHit = Entry.bValid
+		&& Entry.bCube == bCube
+		&& Entry.Size == Request.Size
+		&& (bCube
+			? Entry.SliceIndex == Request.AssignedSliceIndex
+			: (Entry.AtlasViewportOffset.X == Request.AtlasViewportOffset.X && Entry.AtlasViewportOffset.Y == Request.AtlasViewportOffset.Y))
+		&& Entry.StaticSignature == StaticSignature
+		&& Entry.ShaderGeneration == ShaderGeneration
+		&& Entry.ViewMatrix == Request.ViewMatrix
+		&& Entry.ProjectionMatrix == Request.ProjectionMatrix;
+
+	bool& bLightHit = FrameLightHits.try_emplace(Request.LightOwner, true).first->second;
+	bLightHit = bLightHit && bHit;
+
+	if (bHit)
+	{
+		return true;
+	}
+
+	Entry.ViewMatrix = Request.ViewMatrix;
+	Entry.ProjectionMatrix = Request.ProjectionMatrix;
+	Entry.AtlasViewportOffset = Request.AtlasViewportOffset;
+	Entry.Size = Request.Size;
+	Entry.SliceIndex = Request.AssignedSliceIndex;
+	Entry.bCube = bCube;
+	Entry.StaticSignature = StaticSignature;
+	Entry.ShaderGeneration = ShaderGeneration;
+	Entry.bValid = true;
+
+	InvalidateOverlapping(Entry, Request.SubViewIndex, &Entry);
+	return false;
+}
+
+void FShadowMapCache::InvalidateOverlapping(const FEntry& Written, int32 WrittenSubViewIndex, const FEntry* Self)
+{
+	const float WrittenMinX = Written.AtlasViewportOffset.X;
+	const float WrittenMinY = Written.AtlasViewportOffset.Y;
+	const float WrittenMaxX = WrittenMinX + static_cast<float>(Written.Size);
+	const float WrittenMaxY = WrittenMinY + static_cast<float>(Written.Size);
+
+	for (auto& Pair : Entries)
+	{
+		TArray<FEntry>& LightEntries = Pair.second;
+		for (int32 SubViewIndex = 0; SubViewIndex < LightEntries.Num(); ++SubViewIndex)
+		{
+			FEntry& Other = LightEntries[SubViewIndex];
+			if (&Other == Self || !Other.bValid || Other.bCube != Written.bCube)
+			{
+				continue;
+			}
+
+			bool bOverlaps = false;
+			if (Written.bCube)
+			{
+				// 큐브 엔트리는 SubViewIndex가 곧 면 인덱스
+				bOverlaps = Other.SliceIndex == Written.SliceIndex && SubViewIndex == WrittenSubViewIndex;
+			}
+			else
+			{
+				const float OtherMinX = Other.AtlasViewportOffset.X;
+				const float OtherMinY = Other.AtlasViewportOffset.Y;
+				bOverlaps = OtherMinX < WrittenMaxX && WrittenMinX < OtherMinX + static_cast<float>(Other.Size)
+					&& OtherMinY < WrittenMaxY && WrittenMinY < OtherMinY + static_cast<float>(Other.Size);
+			}
+
+			if (bOverlaps)
+			{
+				Other.bValid = false;
+			}
+		}
+	}
+}
+
+void FShadowMapCache::InvalidateLight(ULightComponent* Light)
+{
+	if (TArray<FEntry>* LightEntries = Entries.Find(Light))
+	{
+		for (FEntry& Entry : *LightEntries)
+		{
+			Entry.bValid = false;
+		}
+	}
+}
+
+uint32 FShadowMapCache::GetLightHitCount() const
+{
+	uint32 Count = 0;
+	for (const auto& Pair : FrameLightHits)
+	{
+		Count += Pair.second ? 1 : 0;
+	}
+	return Count;
+}
+
+uint32 FShadowMapCache::GetLightMissCount() const
+{
+	return static_cast<uint32>(FrameLightHits.Num()) - GetLightHitCount();
+}
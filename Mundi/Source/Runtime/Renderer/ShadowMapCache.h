@@ -0,0 +1,81 @@
+﻿#pragma once
+
+class ULightComponent;
+struct FShadowRenderRequest;
+
+/**
+ * @brief 섀도우 요청(라이트 + 서브뷰)별 정적 캐스터 깊이 레이어 캐시
+ * - 정적 캐스터만 그린 깊이를 라이브 아틀라스와 같은 크기/배치의 정적 텍스처에 보관 (2D 아틀라스 영역 / 큐브 슬라이스 면)
+ * - 라이트 행렬, 아틀라스 위치, 정적 캐스터 시그니처가 그대로면 정적 레이어를 복사해 오고 동적 캐스터만 그 위에 그린다
+ * - 시그니처는 캐스터별 마지막 변경 프레임(UMeshComponent::GetLastShadowDirtyFrame)을 포함하므로 컴포넌트 더티 통지로 무효화된다
+ * - 라이트 속성 변경(UpdateLight), 해제, 셰이더 핫 리로드, 다른 요청이 같은 영역을 차지한 경우에도 무효화
+ */
+class FShadowMapCache
+{
+public:
+	// 마지막 변경 후 이 프레임 수가 지나야 정적 캐스터로 취급 (움직이는 스태틱 메시는 그동안 동적 레이어로 그림)
+	static constexpr uint64 StaticSettleFrames = 30;
+
+	/** 정적 캐스터 시그니처용 64비트 혼합 (캐스터별 (포인터, 변경 프레임) / 요청별 누적값) */
+	static uint64 MixSignature(uint64 A, uint64 B);
+
+	FShadowMapCache() = default;
+	~FShadowMapCache();
+	FShadowMapCache(const FShadowMapCache&) = delete;
+	FShadowMapCache& operator=(const FShadowMapCache&) = delete;
+
+	/** 라이브 아틀라스와 같은 desc로 정적 텍스처 생성 (없는 아틀라스는 nullptr) */
+	void Initialize(ID3D11Device* Device, ID3D11Texture2D* LiveAtlas2D, ID3D11Texture2D* LiveAtlasCube);
+	void Release();
+
+	/** 섀도우 패스 시작 시 호출. 라이트별 적중 집계 리셋 */
+	void BeginFrame() { FrameLightHits.clear(); }
+
+	/**
+	 * 정적 레이어를 재사용할 수 있으면 true
+	 * false면 엔트리를 이번 요청 기준으로 갱신하고 같은 영역을 쓰던 다른 엔트리를 무효화한다
+	 * (호출자는 정적 캐스터를 그린 뒤 정적 텍스처로 저장해야 함)
+	 */
+	bool AcquireStaticLayer(const FShadowRenderRequest& Request, uint64 StaticSignature, bool bCube);
+
+	void InvalidateLight(ULightComponent* Light);
+	void RemoveLight(ULightComponent* Light) { Entries.Remove(Light); }
+	void Clear() { Entries.clear(); }
+
+	ID3D11DepthStencilView* GetStaticAtlasDSV2D() const { return StaticAtlasDSV2D; }
+	ID3D11ShaderResourceView* GetStaticAtlasSRV2D() const { return StaticAtlasSRV2D; }
+	ID3D11Texture2D* GetStaticAtlasTextureCube() const { return StaticAtlasTextureCube; }
+
+	/** 이번 프레임 라이트 단위 집계 (라이트의 모든 요청이 재사용되어야 적중) */
+	uint32 GetLightHitCount() const;
+	uint32 GetLightMissCount() const;
+
+private:
+	struct FEntry
+	{
+		FMatrix ViewMatrix;
+		FMatrix ProjectionMatrix;
+		FVector2D AtlasViewportOffset;
+		uint32 Size = 0;
+		int32 SliceIndex = -1;
+		bool bCube = false;
+		uint64 StaticSignature = 0;
+		uint32 ShaderGeneration = 0;
+		bool bValid = false;
+	};
+
+	// 새로 쓰는 영역과 겹치는 다른 엔트리 무효화 (정적 텍스처의 해당 영역이 덮어써짐)
+	void InvalidateOverlapping(const FEntry& Written, int32 WrittenSubViewIndex, const FEntry* Self);
+
+	// Key: 라이트, Value: SubViewIndex별 엔트리 (CSM 캐스케이드 / 큐브 면)
+	TMap<ULightComponent*, TArray<FEntry>> Entries;
+	// 이번 프레임 라이트별 결과 (false가 하나라도 있으면 미스)
+	TMap<ULightComponent*, bool> FrameLightHits;
+
+	// 2D 정적 아틀라스 (라이브 아틀라스와 같은 영역에 정적 캐스터 깊이만 보관)
+	ID3D11Texture2D* StaticAtlasTexture2D = nullptr;
+	ID3D11DepthStencilView* StaticAtlasDSV2D = nullptr;
+	ID3D11ShaderResourceView* StaticAtlasSRV2D = nullptr;
+	// 큐브 정적 아틀라스 (면 단위 CopySubresourceRegion 대상이라 뷰 불필요)
+	ID3D11Texture2D* StaticAtlasTextureCube = nullptr;
+};
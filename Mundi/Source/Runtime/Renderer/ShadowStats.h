@@ -21,6 +21,15 @@ struct FShadowStats
 	float ShadowAtlasCubeMemoryMB = 0.0f;
 	float TotalShadowMemoryMB = 0.0f;
 
+	// 섀도우 캐스터 수집 (요청별 BVH 캐스터 목록 캐시)
+	uint32 CasterListCacheHits = 0;
+	uint32 CasterListCacheMisses = 0;
+	uint32 ShadowCasterDraws = 0;         // 모든 섀도우 요청에서 그린 배치 수 합
+
+	// 섀도우 맵 정적 레이어 캐시 (라이트 단위: 라이트의 모든 요청이 재사용되어야 적중)
+	uint32 ShadowMapCacheLightHits = 0;
+	uint32 ShadowMapCacheLightMisses = 0;
+
 	// 모든 통계를 0으로 리셋
 	void Reset()
 	{
@@ -34,6 +43,11 @@ struct FShadowStats
 		ShadowAtlas2DMemoryMB = 0.0f;
 		ShadowAtlasCubeMemoryMB = 0.0f;
 		TotalShadowMemoryMB = 0.0f;
+		CasterListCacheHits = 0;
+		CasterListCacheMisses = 0;
+		ShadowCasterDraws = 0;
+		ShadowMapCacheLightHits = 0;
+		ShadowMapCacheLightMisses = 0;
 	}
 
 	// 전체 섀도우 캐스팅 라이트 수 계산
@@ -84,6 +98,21 @@ public:
 		CurrentStats = InStats;
 	}
 
+	// 캐스터 수집 통계 갱신 (GatherVisibleProxies의 UpdateStats 뒤, 섀도우 패스에서 호출)
+	void UpdateCasterStats(uint32 InCacheHits, uint32 InCacheMisses, uint32 InCasterDraws)
+	{
+		CurrentStats.CasterListCacheHits = InCacheHits;
+		CurrentStats.CasterListCacheMisses = InCacheMisses;
+		CurrentStats.ShadowCasterDraws = InCasterDraws;
+	}
+
+	// 섀도우 맵 정적 레이어 캐시 통계 갱신 (섀도우 패스 끝에서 호출)
+	void UpdateShadowMapCacheStats(uint32 InLightHits, uint32 InLightMisses)
+	{
+		CurrentStats.ShadowMapCacheLightHits = InLightHits;
+		CurrentStats.ShadowMapCacheLightMisses = InLightMisses;
+	}
+
 	// 통계 조회
 	const FShadowStats& GetStats() const
 	{
@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "SkinnedMeshComponent.h"
+#include "SkeletalMeshComponent.h"
 #include "StatsOverlayD2D.h"
 #include "UEContainer.h"
 
@@ -20,6 +21,15 @@ struct FSkinningStats
 
     FString SkinningType = "CPU";
 
+    // 화면에 보이는 스켈레탈 메시의 URO 평가 주기별 개수 ([0]=매 프레임, [1]=2프레임, [2]=3프레임, [3]=4프레임 이상)
+    uint32 UpdateRateCounts[4] = {};
+    // 본 LOD별 개수
+    uint32 BoneLODCounts[FAnimUpdateRateParams::NumBoneLODs] = {};
+    // 컴포넌트별 "액터 이름 : 1/N, LOD k, 화면 크기" (최대 MaxUpdateRateLines줄)
+    static constexpr uint32 MaxUpdateRateLines = 6;
+    FString UpdateRateLines;
+    uint32 NumUpdateRateLines = 0;
+
     FSkinningStats() {};
 
     FSkinningStats(const FSkinningStats& other)
@@ -28,6 +38,10 @@ struct FSkinningStats
         TotalBones = other.TotalBones;
         TotalVertices = other.TotalVertices;
         SkinningType = other.SkinningType;
+        std::copy(std::begin(other.UpdateRateCounts), std::end(other.UpdateRateCounts), UpdateRateCounts);
+        std::copy(std::begin(other.BoneLODCounts), std::end(other.BoneLODCounts), BoneLODCounts);
+        UpdateRateLines = other.UpdateRateLines;
+        NumUpdateRateLines = other.NumUpdateRateLines;
     };
 
     void AddStats(const FSkinningStats& other)
@@ -42,6 +56,10 @@ struct FSkinningStats
         TotalSkeletals = 0;
         TotalBones = 0;
         TotalVertices = 0;
+        std::fill(std::begin(UpdateRateCounts), std::end(UpdateRateCounts), 0u);
+        std::fill(std::begin(BoneLODCounts), std::end(BoneLODCounts), 0u);
+        UpdateRateLines.clear();
+        NumUpdateRateLines = 0;
     }
 };
 
@@ -92,10 +110,34 @@ public:
                     CurrentStats.TotalVertices += SkeletalMesh->GetVertexCount();
                 }
             }
+
+            if (USkeletalMeshComponent* SkeletalComp = Cast<USkeletalMeshComponent>(MeshComp))
+            {
+                GatherUpdateRate(SkeletalComp);
+            }
         }
     }
 
 private:
+    void GatherUpdateRate(USkeletalMeshComponent* SkeletalComp)
+    {
+        const FAnimUpdateRateParams& Params = SkeletalComp->GetUpdateRateParams();
+        CurrentStats.UpdateRateCounts[FMath::Clamp(Params.UpdateRate, 1, 4) - 1]++;
+        CurrentStats.BoneLODCounts[FMath::Clamp(Params.BoneLOD, 0, FAnimUpdateRateParams::NumBoneLODs - 1)]++;
+
+        if (CurrentStats.NumUpdateRateLines >= FSkinningStats::MaxUpdateRateLines)
+        {
+            return;
+        }
+
+        AActor* Owner = SkeletalComp->GetOwner();
+        char Line[128];
+        std::snprintf(Line, sizeof(Line), " %.20s : 1/%d, LOD %d, %.2f\n",
+            Owner ? Owner->GetName().c_str() : "-", Params.UpdateRate, Params.BoneLOD, Params.ScreenSize);
+        CurrentStats.UpdateRateLines += Line;
+        CurrentStats.NumUpdateRateLines++;
+    }
+
     FSkinningStatManager() = default;
     ~FSkinningStatManager() = default;
     FSkinningStatManager(const FSkinningStatManager&) = delete;
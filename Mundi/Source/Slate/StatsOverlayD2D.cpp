@@ -14,6 +14,9 @@
 #include "LightStats.h"
 #include "ShadowStats.h"
 #include "SkinningStats.h"
+#include "AnimPoseCache.h"
+#include "AnimPosePool.h"
+#include "MeshAutoInstancing.h"
 #include "Source/Runtime/Engine/Particle/ParticleStats.h"
 #include "Source/Runtime/Engine/GameFramework/World.h"
 #include "Source/Runtime/Game/Enemy/BossEnemy.h"
@@ -221,13 +224,22 @@ void UStatsOverlayD2D::Draw()
 		float Fps = Dt > 0.0f ? (1.0f / Dt) : 0.0f;
 		float Ms = Dt * 1000.0f;
 
-		wchar_t Buf[128];
-		swprintf_s(Buf, L"FPS: %.1f\nFrame time: %.2f ms", Fps, Ms);
+		// 불투명 패스 드로우 콜 (자동 인스턴싱 전 → 후)
+		const FMeshInstancingStats& InstancingStats = FMeshAutoInstancing::GetFrameStats();
 
-		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + PanelHeight);
+		wchar_t Buf[256];
+		swprintf_s(Buf, L"FPS: %.1f\nFrame time: %.2f ms\nDraw Calls: %u -> %u\nInstanced: %u draws (%u meshes)",
+			Fps, Ms,
+			InstancingStats.DrawsBeforeInstancing,
+			InstancingStats.DrawsAfterInstancing,
+			InstancingStats.InstancedDraws,
+			InstancingStats.InstancedBatches);
+
+		const float FPSPanelHeight = 88.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + FPSPanelHeight);
 		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushYellow);
 
-		NextY += PanelHeight + Space;
+		NextY += FPSPanelHeight + Space;
 	}
 
 	if (bShowPicking)
@@ -248,15 +260,21 @@ void UStatsOverlayD2D::Draw()
 
 	if (bShowMemory)
 	{
-		double Mb = static_cast<double>(FMemoryManager::TotalAllocationBytes) / (1024.0 * 1024.0);
+		double Mb = static_cast<double>(FMemoryManager::TotalAllocationBytes.load()) / (1024.0 * 1024.0);
+		double PoolMb = static_cast<double>(FMemoryManager::GetPoolReservedBytes()) / (1024.0 * 1024.0);
+
+		const FFrameAllocator& FrameArena = FFrameAllocator::Get();
+		double ArenaKb = static_cast<double>(FrameArena.GetLastFrameBytes()) / 1024.0;
+		double ArenaHwmKb = static_cast<double>(FrameArena.GetHighWaterMark()) / 1024.0;
 
-		wchar_t Buf[128];
-		swprintf_s(Buf, L"Memory: %.1f MB\nAllocs: %u", Mb, FMemoryManager::TotalAllocationCount);
+		wchar_t Buf[192];
+		swprintf_s(Buf, L"Memory: %.1f MB\nAllocs: %u\nPool Reserved: %.1f MB\nFrame Arena: %.1f KB (HWM %.1f KB)", Mb, FMemoryManager::TotalAllocationCount.load(), PoolMb, ArenaKb, ArenaHwmKb);
 
-		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + PanelHeight);
+		const float MemoryPanelHeight = 80.0f;
+		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + MemoryPanelHeight);
 		DrawTextBlock(D2DContext, TextFormat, Buf, Rc, BrushBlack, BrushLightGreen);
 
-		NextY += PanelHeight + Space;
+		NextY += MemoryPanelHeight + Space;
 	}
 
 	if (bShowDecal)
@@ -336,7 +354,7 @@ void UStatsOverlayD2D::Draw()
 		const FShadowStats& ShadowStats = FShadowStatManager::GetInstance().GetStats();
 
 		wchar_t Buf[512];
-		swprintf_s(Buf, L"[Shadow Stats]\nShadow Lights: %u\n  Point: %u\n  Spot: %u\n  Directional: %u\n\nAtlas 2D: %u x %u (%.1f MB)\nAtlas Cube: %u x %u x %u (%.1f MB)\n\nTotal Memory: %.1f MB",
+		swprintf_s(Buf, L"[Shadow Stats]\nShadow Lights: %u\n  Point: %u\n  Spot: %u\n  Directional: %u\n\nAtlas 2D: %u x %u (%.1f MB)\nAtlas Cube: %u x %u x %u (%.1f MB)\n\nTotal Memory: %.1f MB\n\nCaster Lists: %u hit / %u miss\nCaster Draws: %u\nStatic Depth Cache: %u hit / %u miss lights",
 			ShadowStats.TotalShadowCastingLights,
 			ShadowStats.ShadowCastingPointLights,
 			ShadowStats.ShadowCastingSpotLights,
@@ -348,9 +366,14 @@ void UStatsOverlayD2D::Draw()
 			ShadowStats.ShadowAtlasCubeSize,
 			ShadowStats.ShadowCubeArrayCount,
 			ShadowStats.ShadowAtlasCubeMemoryMB,
-			ShadowStats.TotalShadowMemoryMB);
-
-		const float shadowPanelHeight = 260.0f;
+			ShadowStats.TotalShadowMemoryMB,
+			ShadowStats.CasterListCacheHits,
+			ShadowStats.CasterListCacheMisses,
+			ShadowStats.ShadowCasterDraws,
+			ShadowStats.ShadowMapCacheLightHits,
+			ShadowStats.ShadowMapCacheLightMisses);
+
+		const float shadowPanelHeight = 340.0f;
 		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + shadowPanelHeight);
 		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushDeepPink);
 
@@ -374,7 +397,9 @@ void UStatsOverlayD2D::Draw()
 
 		const FSkinningStats& SkinningStats = FSkinningStatManager::GetInstance().GetStats();
 		FWideString AllSkinningType = UTF8ToWide(SkinningStats.SkinningType);		
-		wchar_t Buf[512];
+		FWideString UpdateRateLines = UTF8ToWide(SkinningStats.UpdateRateLines);
+		const FAnimPoseCacheStats& PoseCacheStats = FAnimPoseCache::Get().GetLastFrameStats();
+		wchar_t Buf[1024];
 		swprintf_s(
 			Buf,
 			L"[Skeletal Stats]\n All Skinning Type : %s\n Total Skeletals : %u\n Total Bones : %u\n Total Vertices : %u\n"
@@ -383,7 +408,14 @@ void UStatsOverlayD2D::Draw()
 			L" Vertex Buffer : %.3f\n"
 			L" GPU Draw Time : %.3f\n"
 			L" Structured Buffer : %.3f\n"
-			L" AABB : %.3f\n",
+			L" AABB : %.3f\n"
+			L"[Anim Update Rate]\n"
+			L" 1/1 : %u  1/2 : %u  1/3 : %u  1/4+ : %u\n"
+			L" Bone LOD0 : %u  LOD1 : %u  LOD2 : %u\n"
+			L"[Anim Pose Cache]\n"
+			L" Hit : %u / %u (%.1f%%)  Poses : %u\n"
+			L" Pose Buffer Allocs : %u (Total %llu, Buffers %u)\n"
+			L"%s",
 			AllSkinningType.c_str(),
 			SkinningStats.TotalSkeletals,
 			SkinningStats.TotalBones,
@@ -392,10 +424,26 @@ void UStatsOverlayD2D::Draw()
 			VertexBuffer,
 			GPUSkinning,
 			StructuredBuffer,
-			SkeletalAABB
+			SkeletalAABB,
+			SkinningStats.UpdateRateCounts[0],
+			SkinningStats.UpdateRateCounts[1],
+			SkinningStats.UpdateRateCounts[2],
+			SkinningStats.UpdateRateCounts[3],
+			SkinningStats.BoneLODCounts[0],
+			SkinningStats.BoneLODCounts[1],
+			SkinningStats.BoneLODCounts[2],
+			PoseCacheStats.Hits,
+			PoseCacheStats.Hits + PoseCacheStats.Misses,
+			PoseCacheStats.GetHitRate() * 100.0f,
+			PoseCacheStats.NumEntries,
+			FAnimPosePool::GetLastFrameAllocations(),
+			static_cast<unsigned long long>(FAnimPosePool::GetTotalAllocations()),
+			FAnimPosePool::GetNumBuffers(),
+			UpdateRateLines.c_str()
 		);
 
-		const float SkinningPanelHeight = 180.0f;
+		// 컴포넌트별 URO 줄 수만큼 패널을 늘림
+		const float SkinningPanelHeight = 300.0f + 18.0f * static_cast<float>(SkinningStats.NumUpdateRateLines);
 		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth + 50.0f, NextY + SkinningPanelHeight);
 		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushDeepPink);
 		NextY += SkinningPanelHeight + Space;		
@@ -4,6 +4,18 @@
 #include "GlobalConsole.h"
 #include "StatsOverlayD2D.h"
 #include "USlateManager.h"
+#include "WorldPartitionManager.h"
+#include "BVHierarchy.h"
+#include "MemoryManager.h"
+#include "ContainerBenchmark.h"
+#include "Source/Runtime/Engine/Particle/ParticleBenchmark.h"
+#include "AnimCompressionBenchmark.h"
+#include "SkinningPaletteBenchmark.h"
+#include "CPUSkinningBenchmark.h"
+#include "MeshDrawSortBenchmark.h"
+#include "MeshAutoInstancingBenchmark.h"
+#include "AnimUpdateRate.h"
+#include "AnimPoseCache.h"
 #include <windows.h>
 #include <cstdarg>
 #include <cctype>
@@ -66,6 +78,20 @@ void UConsoleWidget::Initialize()
 	HelpCommandList.Add("STAT NONE");
 	HelpCommandList.Add("STAT LIGHT");
 	HelpCommandList.Add("STAT SHADOW");
+	HelpCommandList.Add("BENCH BVH");
+	HelpCommandList.Add("BENCH CONTAINERS");
+	HelpCommandList.Add("BENCH PARTICLES");
+	HelpCommandList.Add("BENCH ANIM");
+	HelpCommandList.Add("BENCH SKINNING");
+	HelpCommandList.Add("BENCH CPUSKIN");
+	HelpCommandList.Add("BENCH DRAWSORT");
+	HelpCommandList.Add("BENCH INSTANCING");
+	HelpCommandList.Add("ANIM URO ON");
+	HelpCommandList.Add("ANIM URO OFF");
+	HelpCommandList.Add("ANIM POSECACHE ON");
+	HelpCommandList.Add("ANIM POSECACHE OFF");
+	HelpCommandList.Add("ANIM POSECACHE QUANT");
+	HelpCommandList.Add("DUMP MEMORY");
 
 	// Add welcome messages
 	AddLog("=== Console Widget Initialized ===");
@@ -386,6 +412,79 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowTileCulling(false);
 		AddLog("STAT: OFF");
 	}
+	else if (Stricmp(command_line, "BENCH BVH") == 0)
+	{
+		// 현재 로드된 씬(DemoScene, FINALgameScene 등)의 BVH로 이진 LBVH / BVH4 쿼리 비용 비교
+		UWorldPartitionManager* Partition = GWorld ? GWorld->GetPartitionManager() : nullptr;
+		if (Partition && Partition->GetBVH())
+		{
+			Partition->GetBVH()->RunQueryBenchmark();
+		}
+		else
+		{
+			AddLog("BENCH BVH: no world partition");
+		}
+	}
+	else if (Stricmp(command_line, "BENCH CONTAINERS") == 0)
+	{
+		// TMap(오픈 어드레싱)과 std::unordered_map 기반 TStableMap의 삽입/조회/삭제/순회 비교
+		FContainerBenchmark::Run();
+	}
+	else if (Strnicmp(command_line, "BENCH PARTICLES", 15) == 0)
+	{
+		// Data/Particle 에셋을 컴포넌트/렌더링 없이 시뮬레이션만 N프레임 돌려 모듈별 비용 측정 (기본 600프레임)
+		const int32 NumFrames = std::atoi(command_line + 15);
+		FParticleBenchmark::Run(NumFrames > 0 ? NumFrames : 600);
+	}
+	else if (Stricmp(command_line, "BENCH ANIM") == 0)
+	{
+		// 로드된 애니메이션 클립의 원본/압축 트랙 메모리와 본 트랙 평가 비용 비교
+		FAnimCompressionBenchmark::Run();
+	}
+	else if (Stricmp(command_line, "BENCH SKINNING") == 0)
+	{
+		// 60/120/250 본 스켈레톤의 스키닝/노말 행렬 생성: 본별 4x4 역행렬 경로와 SIMD 배치 커널 비교
+		FSkinningPaletteBenchmark::Run();
+	}
+	else if (Stricmp(command_line, "BENCH CPUSKIN") == 0)
+	{
+		// 로드된 스켈레탈 메시의 CPU 스키닝: 기존 스칼라 경로와 8비트 가중치 SSE 경로/멀티스레드 경로 비교
+		FCPUSkinningBenchmark::Run();
+	}
+	else if (Stricmp(command_line, "BENCH DRAWSORT") == 0)
+	{
+		// 10k/30k/100k 합성 드로우 배치: operator< 비교 정렬과 64비트 키 기수 정렬 비교
+		FMeshDrawSortBenchmark::Run();
+	}
+	else if (Stricmp(command_line, "BENCH INSTANCING") == 0)
+	{
+		// 자동 인스턴싱 구간 병합: 번갈아 나오는 키/머티리얼 경계/길이 1 구간 검증 후 10k/30k/100k 합성 배치 병합 시간
+		FMeshAutoInstancingBenchmark::Run();
+	}
+	else if (Stricmp(command_line, "ANIM URO ON") == 0 || Stricmp(command_line, "ANIM URO OFF") == 0)
+	{
+		// 스켈레탈 메시 URO(거리/가시성 기반 평가 주기, 본 LOD) 켜고 끄기, 주기는 STAT 스키닝 패널에 표시
+		FAnimUpdateRate::GetSettings().bEnabled = Stricmp(command_line, "ANIM URO ON") == 0;
+		AddLog("Animation update rate optimization: %s", FAnimUpdateRate::GetSettings().bEnabled ? "ON" : "OFF");
+	}
+	else if (Stricmp(command_line, "ANIM POSECACHE ON") == 0 || Stricmp(command_line, "ANIM POSECACHE OFF") == 0)
+	{
+		// 같은 (시퀀스, 시간) 포즈 평가를 컴포넌트끼리 공유, 히트율은 STAT 스키닝 패널에 표시
+		FAnimPoseCache::Get().GetSettings().bEnabled = Stricmp(command_line, "ANIM POSECACHE ON") == 0;
+		AddLog("Animation pose cache: %s", FAnimPoseCache::Get().GetSettings().bEnabled ? "ON" : "OFF");
+	}
+	else if (Strnicmp(command_line, "ANIM POSECACHE QUANT", 20) == 0)
+	{
+		// 샘플 시간 양자화 간격(ms), 0이면 시간이 정확히 같을 때만 공유
+		const float QuantizationMs = static_cast<float>(std::atof(command_line + 20));
+		FAnimPoseCache::Get().GetSettings().TimeQuantization = FMath::Max(QuantizationMs, 0.0f) * 0.001f;
+		AddLog("Animation pose cache quantization: %.2f ms", FAnimPoseCache::Get().GetSettings().TimeQuantization * 1000.0f);
+	}
+	else if (Stricmp(command_line, "DUMP MEMORY") == 0)
+	{
+		// 사이즈 클래스별 현재/최대 블록 수와 예약 청크 사용률
+		FMemoryManager::DumpStats();
+	}
 	else
 	{
 		AddLog("Unknown command: '%s'", command_line);
@@ -828,6 +828,22 @@ void SParticleViewerWindow::OnRender()
 
 					ImGui::Spacing();
 
+                    // Use SoA Layout
+                    {
+                        ImGui::Text("Use SoA Layout");
+                        if (ImGui::IsItemHovered())
+                        {
+                            ImGui::SetTooltip("파티클 속성을 속성별 배열(SoA)로 저장하고 SIMD로 업데이트\n모든 Update 모듈이 지원할 때만 적용됩니다.\n(지원: Velocity, Color, ColorOverLife, Size, SizeMultiplyLife, RotationRate)");
+                        }
+                        ImGui::NextColumn();
+
+                        // 레이아웃 전환은 다음 Tick에서 살아있는 파티클을 옮기며 처리되므로 재시작 불필요
+                        ImGui::Checkbox("##UseSoALayout", &RequiredModule->bUseSoALayout);
+                        ImGui::NextColumn();
+                    }
+
+					ImGui::Spacing();
+
                     // SubUV Settings (스프라이트 시트 애니메이션)
                     {
                         ImGui::TextColored(ImVec4(0.5f, 0.8f, 1.0f, 1.0f), "SubUV (Sprite Sheet)");
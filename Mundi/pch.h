@@ -52,6 +52,7 @@
 #include "ResourceData.h"
 #include "VertexData.h"
 #include "UEContainer.h"
+#include "FrameAllocator.h"
 #include "Name.h"
 #include "PathUtils.h"
 #include "Object.h"